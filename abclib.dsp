@@ -231,6 +231,10 @@ SOURCE=.\src\base\abci\abcCascade.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\base\abci\abcCkpt.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\base\abci\abcCollapse.c
 # End Source File
 # Begin Source File
@@ -4826,6 +4830,10 @@ SOURCE=.\src\misc\extra\extraUtilMult.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\misc\extra\extraUtilNpn4.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\misc\extra\extraUtilPath.c
 # End Source File
 # Begin Source File
@@ -5042,6 +5050,10 @@ SOURCE=.\src\misc\util\utilCex.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\misc\util\utilCexStore.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\misc\util\utilColor.c
 # End Source File
 # Begin Source File
@@ -5054,6 +5066,10 @@ SOURCE=.\src\misc\util\utilFile.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\misc\util\utilHuge.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\misc\util\utilFloat.h
 # End Source File
 # Begin Source File
@@ -5102,6 +5118,14 @@ SOURCE=.\src\misc\util\utilTruth.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\misc\util\utilTruthSimd.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\misc\util\utilTruthSimdKernels.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\misc\util\utilBipart.c
 # End Source File
 # Begin Source File
@@ -5910,6 +5934,10 @@ SOURCE=.\src\aig\gia\giaCex.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaCkpt.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaClp.c
 # End Source File
 # Begin Source File
@@ -6202,6 +6230,10 @@ SOURCE=.\src\aig\gia\giaSatLE.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaSatLoad.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaSatLut.c
 # End Source File
 # Begin Source File
@@ -6346,6 +6378,10 @@ SOURCE=.\src\aig\gia\giaUtil.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\aig\gia\giaXsim.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\aig\gia\giaDecGraph.cpp
 # End Source File
 # Begin Source File
@@ -6746,6 +6782,10 @@ SOURCE=.\src\proof\dch\dchMan.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\dch\dchPth.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\dch\dchSat.c
 # End Source File
 # Begin Source File
@@ -6950,6 +6990,14 @@ SOURCE=.\src\proof\int\intMan.c
 # End Source File
 # Begin Source File
 
+SOURCE=.\src\proof\int\intPrf.c
+# End Source File
+# Begin Source File
+
+SOURCE=.\src\proof\int\intPth.c
+# End Source File
+# Begin Source File
+
 SOURCE=.\src\proof\int\intUtil.c
 # End Source File
 # End Group
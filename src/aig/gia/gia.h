@@ -42,8 +42,17 @@
 
 ABC_NAMESPACE_HEADER_START
 
+// in the large mode (ABC_USE_GIA_LARGE), objects take 16 bytes instead of 12
+// and the number of objects is limited by 2^30 (because literals are integers)
+#ifdef ABC_USE_GIA_LARGE
+#define GIA_NONE 0x7FFFFFFF
+#define GIA_VOID 0x3FFFFFFF
+#define GIA_OBJ_MAX GIA_VOID
+#else
 #define GIA_NONE 0x1FFFFFFF
 #define GIA_VOID 0x0FFFFFFF
+#define GIA_OBJ_MAX (1 << 29)
+#endif
 
 ////////////////////////////////////////////////////////////////////////
 ///                         BASIC TYPES                              ///
@@ -53,11 +62,21 @@ typedef struct Gia_MmFixed_t_        Gia_MmFixed_t;
 typedef struct Gia_MmFlex_t_         Gia_MmFlex_t;     
 typedef struct Gia_MmStep_t_         Gia_MmStep_t;     
 typedef struct Gia_Dat_t_            Gia_Dat_t;
+typedef struct Gia_SatLoad_t_        Gia_SatLoad_t;
+
+// the SAT solvers used by the incremental loader of the AIG cones
+typedef enum { GIA_SAT_SATOKO = 0, GIA_SAT_GLUCOSE2, GIA_SAT_CADICAL } Gia_SatType_t;
 
+// with ABC_USE_GIA_LARGE, the 30-bit iRepr and the four flags do not fit into
+// 32 bits, so Gia_Rpr_t takes 8 bytes and the memory of pReprs is doubled
 typedef struct Gia_Rpr_t_ Gia_Rpr_t;
 struct Gia_Rpr_t_
 {
+#ifdef ABC_USE_GIA_LARGE
+    unsigned       iRepr   : 30;  // representative node
+#else
     unsigned       iRepr   : 28;  // representative node
+#endif
     unsigned       fProved :  1;  // marks the proved equivalence
     unsigned       fFailed :  1;  // marks the failed equivalence
     unsigned       fColorA :  1;  // marks cone of A
@@ -76,6 +95,17 @@ struct Gia_Plc_t_
 typedef struct Gia_Obj_t_ Gia_Obj_t;
 struct Gia_Obj_t_
 {
+#ifdef ABC_USE_GIA_LARGE
+    unsigned       iDiff0 :  31;  // the diff of the first fanin
+    unsigned       fCompl0:   1;  // the complemented attribute
+    unsigned       iDiff1 :  31;  // the diff of the second fanin
+    unsigned       fCompl1:   1;  // the complemented attribute
+
+    unsigned       fMark0 :   1;  // first user-controlled mark
+    unsigned       fTerm  :   1;  // terminal node (CI/CO)
+    unsigned       fMark1 :   1;  // second user-controlled mark
+    unsigned       fPhase :   1;  // value under 000 pattern
+#else
     unsigned       iDiff0 :  29;  // the diff of the first fanin
     unsigned       fCompl0:   1;  // the complemented attribute
     unsigned       fMark0 :   1;  // first user-controlled mark
@@ -85,6 +115,7 @@ struct Gia_Obj_t_
     unsigned       fCompl1:   1;  // the complemented attribute
     unsigned       fMark1 :   1;  // second user-controlled mark
     unsigned       fPhase :   1;  // value under 000 pattern
+#endif
 
     unsigned       Value;         // application-specific value
 };
@@ -94,6 +125,9 @@ struct Gia_Obj_t_
 
 // new AIG manager
 typedef struct Gia_Man_t_ Gia_Man_t;
+
+// checkpoint writer
+typedef struct Gia_CkptOut_t_ Gia_CkptOut_t;
 struct Gia_Man_t_
 {
     char *         pName;         // name of the AIG
@@ -274,6 +308,7 @@ struct Gps_Par_t_
     int            fSlacks;
     int            fNoColor;
     int            fMapOutStats;
+    int            fMemory;
     char *         pDumpFile;
 };
 
@@ -684,15 +719,14 @@ static inline Gia_Obj_t * Gia_ManAppendObj( Gia_Man_t * p )
 { 
     if ( p->nObjs == p->nObjsAlloc )
     {
-        int nObjNew = Abc_MinInt( 2 * p->nObjsAlloc, (1 << 29) );
-        if ( p->nObjs == (1 << 29) )
-            printf( "Hard limit on the number of nodes (2^29) is reached. Quitting...\n" ), exit(1);
+        int nObjNew = Abc_MinInt( 2 * p->nObjsAlloc, GIA_OBJ_MAX );
+        if ( p->nObjs == GIA_OBJ_MAX )
+            printf( "Hard limit on the number of nodes (%d) is reached. Quitting...\n", GIA_OBJ_MAX ), exit(1);
         assert( p->nObjs < nObjNew );
         if ( p->fVerbose )
             printf("Extending GIA object storage: %d -> %d.\n", p->nObjsAlloc, nObjNew );
         assert( p->nObjsAlloc > 0 );
-        p->pObjs = ABC_REALLOC( Gia_Obj_t, p->pObjs, nObjNew );
-        memset( p->pObjs + p->nObjsAlloc, 0, sizeof(Gia_Obj_t) * (nObjNew - p->nObjsAlloc) );
+        p->pObjs = (Gia_Obj_t *)Util_HugeRealloc( p->pObjs, sizeof(Gia_Obj_t) * (size_t)p->nObjsAlloc, sizeof(Gia_Obj_t) * (size_t)nObjNew );
         if ( p->pMuxes )
         {
             p->pMuxes = ABC_REALLOC( unsigned, p->pMuxes, nObjNew );
@@ -1296,6 +1330,8 @@ extern unsigned *          Gia_ManConvertAigToTruth( Gia_Man_t * p, Gia_Obj_t *
 extern Gia_Man_t *         Gia_ManPerformBidec( Gia_Man_t * p, int fVerbose );
 /*=== giaCex.c ============================================================*/
 extern int                 Gia_ManVerifyCex( Gia_Man_t * pAig, Abc_Cex_t * p, int fDualOut );
+extern void                Gia_ManCexesSimulateFrame( Gia_Man_t * pAig, Vec_Ptr_t * vCexes, int * pBatch, int nBatch, int f, word * pState, word * pSims );
+extern int                 Gia_ManVerifyCexes( Gia_Man_t * pAig, Vec_Ptr_t * vCexes, Vec_Int_t * vFailed );
 extern int                 Gia_ManFindFailedPoCex( Gia_Man_t * pAig, Abc_Cex_t * p, int nOutputs );
 extern int                 Gia_ManSetFailedPoCex( Gia_Man_t * pAig, Abc_Cex_t * p );
 extern void                Gia_ManCounterExampleValueStart( Gia_Man_t * pGia, Abc_Cex_t * pCex );
@@ -1303,6 +1339,14 @@ extern void                Gia_ManCounterExampleValueStop( Gia_Man_t * pGia );
 extern int                 Gia_ManCounterExampleValueLookup( Gia_Man_t * pGia, int Id, int iFrame );
 extern Abc_Cex_t *         Gia_ManCexExtendToIncludeCurrentStates( Gia_Man_t * p, Abc_Cex_t * pCex );
 extern Abc_Cex_t *         Gia_ManCexExtendToIncludeAllObjects( Gia_Man_t * p, Abc_Cex_t * pCex );
+/*=== giaCkpt.c ============================================================*/
+extern Gia_CkptOut_t *     Gia_CkptOutStart( char * pFileName, int fCompress );
+extern int                 Gia_CkptOutStop( Gia_CkptOut_t * p );
+extern void                Gia_CkptOutGia( Gia_CkptOut_t * p, Gia_Man_t * pGia );
+extern void                Gia_CkptOutUser( Gia_CkptOut_t * p, int Type, char * pData, word nBytes );
+extern int                 Gia_ManCkptWrite( Gia_Man_t * p, char * pFileName, int fCompress );
+extern int                 Gia_ManCkptReadUser( char * pFileName, Gia_Man_t ** ppGia, void (*pFuncUser)(void *, int, char *, word), void * pUser, int fVerbose );
+extern Gia_Man_t *         Gia_ManCkptRead( char * pFileName );
 /*=== giaCsatOld.c ============================================================*/
 extern Vec_Int_t *         Cbs_ManSolveMiter( Gia_Man_t * pGia, int nConfs, Vec_Str_t ** pvStatus, int fVerbose );
 /*=== giaCsat.c ============================================================*/
@@ -1563,6 +1607,7 @@ extern Gia_Man_t *         Gia_ManStart( int nObjsMax );
 extern void                Gia_ManStop( Gia_Man_t * p );  
 extern void                Gia_ManStopP( Gia_Man_t ** p );  
 extern double              Gia_ManMemory( Gia_Man_t * p );
+extern void                Gia_ManPrintMemory( Gia_Man_t * p );
 extern void                Gia_ManPrintStats( Gia_Man_t * p, Gps_Par_t * pPars ); 
 extern void                Gia_ManPrintStatsShort( Gia_Man_t * p ); 
 extern void                Gia_ManPrintMiterStatus( Gia_Man_t * p ); 
@@ -1594,6 +1639,7 @@ extern int                 Gia_MmStepReadMemUsage( Gia_MmStep_t * p );
 extern void                Mf_ManSetDefaultPars( Jf_Par_t * pPars );
 extern Gia_Man_t *         Mf_ManPerformMapping( Gia_Man_t * pGia, Jf_Par_t * pPars );
 extern void *              Mf_ManGenerateCnf( Gia_Man_t * pGia, int nLutSize, int fCnfObjIds, int fAddOrCla, int fMapping, int fVerbose );
+extern void *              Mf_ManGenerateCnfPar( Gia_Man_t * pGia, int nLutSize, int fCnfObjIds, int fAddOrCla, int fMapping, int nProcs, int fVerbose );
 /*=== giaMini.c ===========================================================*/
 extern Gia_Man_t *         Gia_ManReadMiniAig( char * pFileName, int fGiaSimple );
 extern void                Gia_ManWriteMiniAig( Gia_Man_t * pGia, char * pFileName );
@@ -1620,6 +1666,18 @@ extern Gia_Man_t *         Gia_ManCleanup( Gia_Man_t * p );
 extern Gia_Man_t *         Gia_ManCleanupOutputs( Gia_Man_t * p, int nOutputs );
 extern Gia_Man_t *         Gia_ManSeqCleanup( Gia_Man_t * p );
 extern Gia_Man_t *         Gia_ManSeqStructSweep( Gia_Man_t * p, int fConst, int fEquiv, int fVerbose );
+/*=== giaSatLoad.c ===========================================================*/
+extern Gia_SatLoad_t *     Gia_SatLoadStart( Gia_Man_t * pGia, int SolverType );
+extern void                Gia_SatLoadStop( Gia_SatLoad_t * p );
+extern void *              Gia_SatLoadSolver( Gia_SatLoad_t * p );
+extern int                 Gia_SatLoadVarNum( Gia_SatLoad_t * p );
+extern void                Gia_SatLoadRecycle( Gia_SatLoad_t * p );
+extern int                 Gia_SatLoadObj( Gia_SatLoad_t * p, int iObj );
+extern int                 Gia_SatLoadLit( Gia_SatLoad_t * p, int iLit );
+extern int                 Gia_SatLoadSolve( Gia_SatLoad_t * p, int * pLits, int nLits, int nConfLimit );
+extern int                 Gia_SatLoadObjValue( Gia_SatLoad_t * p, int iObj );
+extern void                Gia_SatLoadPrintStats( Gia_SatLoad_t * p );
+extern int                 Gia_SatLoadSolveOutputs( Gia_Man_t * p, int SolverType, int nConfLimit, int nVarsMax, int fVerbose );
 /*=== giaShow.c ===========================================================*/
 extern void                Gia_ManShow( Gia_Man_t * pMan, Vec_Int_t * vBold, int fAdders, int fFadds, int fPath );
 /*=== giaShrink.c ===========================================================*/
@@ -1648,6 +1706,7 @@ extern void                Gia_ManBuiltInSimResimulateCone( Gia_Man_t * p, int i
 extern void                Gia_ManBuiltInSimResimulate( Gia_Man_t * p );
 extern int                 Gia_ManBuiltInSimAddPat( Gia_Man_t * p, Vec_Int_t * vPat );
 extern void                Gia_ManIncrSimStart( Gia_Man_t * p, int nWords, int nObjs );
+extern void                Gia_ManIncrSimStop( Gia_Man_t * p );
 extern void                Gia_ManIncrSimSet( Gia_Man_t * p, Vec_Int_t * vObjLits );
 extern int                 Gia_ManIncrSimCheckOver( Gia_Man_t * p, int iLit0, int iLit1 );
 extern int                 Gia_ManIncrSimCheckEqual( Gia_Man_t * p, int iLit0, int iLit1 );
@@ -1749,6 +1808,17 @@ extern void                Gia_ObjComputeTruthTableStop( Gia_Man_t * p );
 extern word *              Gia_ObjComputeTruthTableCut( Gia_Man_t * p, Gia_Obj_t * pObj, Vec_Int_t * vLeaves );
 /*=== giaTsim.c ============================================================*/
 extern Gia_Man_t *         Gia_ManReduceConst( Gia_Man_t * pAig, int fVerbose );
+/*=== giaXsim.c ============================================================*/
+typedef struct Gia_XsimMan_t_ Gia_XsimMan_t;
+extern Gia_XsimMan_t *     Gia_XsimManStart( Gia_Man_t * pGia, int nWordsMax );
+extern void                Gia_XsimManStop( Gia_XsimMan_t * p );
+extern void                Gia_XsimManSetWords( Gia_XsimMan_t * p, int nWords );
+extern void                Gia_XsimManSetCone( Gia_XsimMan_t * p, Vec_Int_t * vCis, Vec_Int_t * vNodes, Vec_Int_t * vCos );
+extern void                Gia_XsimManSetCi( Gia_XsimMan_t * p, int iObj, int Value );
+extern void                Gia_XsimManSetCiX( Gia_XsimMan_t * p, int iObj, word * pMask );
+extern word *              Gia_XsimManSimulate( Gia_XsimMan_t * p );
+extern int                 Gia_XsimManValue( Gia_XsimMan_t * p, int iObj, int iPat );
+extern int                 Gia_XsimManLift( Gia_XsimMan_t * p, Vec_Int_t * vCiVals, Vec_Int_t * vCands, Vec_Int_t * vLifted );
 /*=== giaUtil.c ===========================================================*/
 extern unsigned            Gia_ManRandom( int fReset );
 extern word                Gia_ManRandomW( int fReset );
@@ -238,6 +238,26 @@ Gia_Man_t * Gia_ManFromAigSimple( Aig_Man_t * p )
     return pNew;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Resimulates many counter-examples of the AIG at the same time.]
+
+  Description [Returns the number of counter-examples, which failed
+  verification. See Gia_ManVerifyCexes() for details.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManVerifyCexesAig( Aig_Man_t * p, Vec_Ptr_t * vCexes, Vec_Int_t * vFailed )
+{
+    Gia_Man_t * pGia = Gia_ManFromAigSimple( p );
+    int nFailed = Gia_ManVerifyCexes( pGia, vCexes, vFailed );
+    Gia_ManStop( pGia );
+    return nFailed;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Handles choices as additional combinational outputs.]
@@ -604,6 +624,108 @@ Gia_Man_t * Gia_ManCompress2( Gia_Man_t * p, int fUpdateLevel, int fVerbose )
     return pGia;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Applies DC2 to the partitions of the GIA manager on several threads.]
+
+  Description [The AND nodes are divided into disjoint partitions, each of 
+  which is extracted as a separate AIG whose inputs are the fanins outside
+  of the partition and whose outputs are the nodes used outside of it.
+  The partitions are rewritten concurrently and the results are stitched 
+  back in the order of partitions, with structural hashing across their 
+  boundaries. A partition is replaced only if it became smaller. Since the
+  partitions share no nodes, the boundaries, which are kept unchanged,
+  are the only interaction between them.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Gia_Dc2Part_t_ Gia_Dc2Part_t;
+struct Gia_Dc2Part_t_
+{
+    Gia_Man_t *  pIn;            // the partition
+    Gia_Man_t *  pOut;           // the rewritten partition
+    int          fUpdateLevel;   // level update during rewriting
+};
+int Gia_ManCompress2Part( void * pArg )
+{
+    Gia_Dc2Part_t * pPart = (Gia_Dc2Part_t *)pArg;
+    Aig_Man_t * pNew, * pTemp;
+    pNew = Gia_ManToAig( pPart->pIn, 0 );
+    pNew = Dar_ManCompress2( pTemp = pNew, 1, pPart->fUpdateLevel, 1, 0, 0 );
+    Aig_ManStop( pTemp );
+    pPart->pOut = Gia_ManFromAig( pNew );
+    Aig_ManStop( pNew );
+    if ( Gia_ManAndNum(pPart->pOut) >= Gia_ManAndNum(pPart->pIn) )
+    {
+        Gia_ManStop( pPart->pOut );
+        pPart->pOut = Gia_ManDup( pPart->pIn );
+    }
+    return 1;
+}
+Gia_Man_t * Gia_ManCompress2Par( Gia_Man_t * p, int nProcs, int nPartSize, int fUpdateLevel, int fVerbose )
+{
+    extern Vec_Wec_t * Gia_ManStochNodes( Gia_Man_t * p, int nMaxSize, int Seed );
+    extern Vec_Wec_t * Gia_ManStochInputs( Gia_Man_t * p, Vec_Wec_t * vAnds );
+    extern Vec_Wec_t * Gia_ManStochOutputs( Gia_Man_t * p, Vec_Wec_t * vAnds );
+    extern Gia_Man_t * Gia_ManDupDivideOne( Gia_Man_t * p, Vec_Int_t * vCis, Vec_Int_t * vAnds, Vec_Int_t * vCos, Vec_Int_t * vLevels[2], int nLevels );
+    extern Gia_Man_t * Gia_ManDupStitch( Gia_Man_t * p, Vec_Wec_t * vCis, Vec_Wec_t * vAnds, Vec_Wec_t * vCos, Vec_Ptr_t * vAigs, int fHash );
+    Vec_Int_t * vLevels[2] = {NULL};
+    Vec_Wec_t * vAnds, * vIns, * vOuts;
+    Vec_Ptr_t * vData, * vAigs;
+    Gia_Dc2Part_t * pParts;
+    Gia_Man_t * pGia, * pNew;
+    Dar_RwrPar_t Pars;
+    abctime clk = Abc_Clock();
+    int i;
+    if ( nProcs < 2 || p->pManTime || Gia_ManAndNum(p) == 0 )
+        return Gia_ManCompress2( p, fUpdateLevel, fVerbose );
+    if ( nPartSize == 0 )
+        nPartSize = Abc_MaxInt( 1000, Gia_ManAndNum(p) / (2 * nProcs) );
+    // the library should be prepared before it is used on several threads
+    Dar_ManDefaultRwrParams( &Pars );
+    Dar_LibPrepare( Pars.nSubgMax );
+    // divide the AIG into partitions
+    pGia  = Gia_ManDup( p );
+    vAnds = Gia_ManStochNodes( pGia, nPartSize, 0 );
+    vIns  = Gia_ManStochInputs( pGia, vAnds );
+    vOuts = Gia_ManStochOutputs( pGia, vAnds );
+    pParts = ABC_CALLOC( Gia_Dc2Part_t, Vec_WecSize(vAnds) );
+    vData = Vec_PtrAlloc( Vec_WecSize(vAnds) );
+    for ( i = 0; i < Vec_WecSize(vAnds); i++ )
+    {
+        pParts[i].pIn = Gia_ManDupDivideOne( pGia, Vec_WecEntry(vIns, i), Vec_WecEntry(vAnds, i), Vec_WecEntry(vOuts, i), vLevels, 0 );
+        pParts[i].fUpdateLevel = fUpdateLevel;
+        Vec_PtrPush( vData, pParts + i );
+    }
+    // rewrite the partitions and stitch the results
+    Util_ProcessThreads( Gia_ManCompress2Part, vData, nProcs + 1, 0, 0 );
+    vAigs = Vec_PtrAlloc( Vec_WecSize(vAnds) );
+    for ( i = 0; i < Vec_WecSize(vAnds); i++ )
+    {
+        Vec_PtrPush( vAigs, pParts[i].pOut );
+        Gia_ManStop( pParts[i].pIn );
+    }
+    pNew = Gia_ManDupStitch( pGia, vIns, vAnds, vOuts, vAigs, 1 );
+    if ( fVerbose )
+    {
+        printf( "Rewrote %d partitions (up to %d nodes each) using %d threads. Reduced %d to %d nodes.  ",
+            Vec_PtrSize(vAigs), nPartSize, nProcs, Gia_ManAndNum(p), Gia_ManAndNum(pNew) );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    Vec_PtrFreeFunc( vAigs, (void (*)(void *)) Gia_ManStop );
+    Vec_PtrFree( vData );
+    ABC_FREE( pParts );
+    Vec_WecFree( vAnds );
+    Vec_WecFree( vIns );
+    Vec_WecFree( vOuts );
+    Gia_ManStop( pGia );
+    Gia_ManTransferTiming( pNew, p );
+    return pNew;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
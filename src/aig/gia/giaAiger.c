@@ -240,6 +240,15 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
         fprintf( stdout, "The number of objects does not match.\n" );
         return NULL;
     }
+    if ( (word)nTotal + nLatches + nOutputs + 1 > (word)GIA_OBJ_MAX )
+    {
+#ifdef ABC_USE_GIA_LARGE
+        fprintf( stdout, "The number of objects exceeds the limit (%d).\n", GIA_OBJ_MAX );
+#else
+        fprintf( stdout, "The number of objects exceeds the limit (%d). Compile with ABC_USE_GIA_LARGE to raise it.\n", GIA_OBJ_MAX );
+#endif
+        return NULL;
+    }
     if ( nJust || nFair )
     {
         fprintf( stdout, "Reading AIGER files with liveness properties is currently not supported.\n" );
@@ -77,6 +77,136 @@ int Gia_ManVerifyCex( Gia_Man_t * pAig, Abc_Cex_t * p, int fDualOut )
     return RetValue;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Simulates one frame of a batch of counter-examples.]
+
+  Description [Bit k of the simulation words belongs to the counter-example
+  vCexes[pBatch[k]]. The flop values of the frame are taken from pState.
+  The counter-examples shorter than the frame get zero primary inputs.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManCexesSimulateFrame( Gia_Man_t * pAig, Vec_Ptr_t * vCexes, int * pBatch, int nBatch, int f, word * pState, word * pSims )
+{
+    Gia_Obj_t * pObj; Abc_Cex_t * p;
+    int i, k, iObj;
+    pSims[0] = 0;
+    Gia_ManForEachPi( pAig, pObj, i )
+        pSims[Gia_ObjId(pAig, pObj)] = 0;
+    for ( k = 0; k < nBatch; k++ )
+    {
+        p = (Abc_Cex_t *)Vec_PtrEntry( vCexes, pBatch[k] );
+        if ( f <= p->iFrame )
+            for ( i = 0; i < p->nPis; i++ )
+                if ( Abc_InfoHasBit(p->pData, p->nRegs + p->nPis * f + i) )
+                    pSims[Gia_ManCiIdToId(pAig, i)] |= (word)1 << k;
+    }
+    Gia_ManForEachRo( pAig, pObj, i )
+        pSims[Gia_ObjId(pAig, pObj)] = pState[i];
+    Gia_ManForEachAnd( pAig, pObj, i )
+        pSims[i] = (Gia_ObjFaninC0(pObj) ? ~pSims[Gia_ObjFaninId0(pObj, i)] : pSims[Gia_ObjFaninId0(pObj, i)]) & 
+                   (Gia_ObjFaninC1(pObj) ? ~pSims[Gia_ObjFaninId1(pObj, i)] : pSims[Gia_ObjFaninId1(pObj, i)]);
+    Gia_ManForEachCo( pAig, pObj, i )
+    {
+        iObj = Gia_ObjId( pAig, pObj );
+        pSims[iObj] = Gia_ObjFaninC0(pObj) ? ~pSims[Gia_ObjFaninId0(pObj, iObj)] : pSims[Gia_ObjFaninId0(pObj, iObj)];
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Resimulates many counter-examples at the same time.]
+
+  Description [Packs up to 64 counter-examples into one simulation word
+  and simulates them frame by frame in one pass. The counter-examples are
+  sorted by length, so that the counter-examples of the same batch need
+  a similar number of frames. The entries of the array, which are NULL or
+  the markers of the unrecorded counter-examples, are skipped. Returns 
+  the number of counter-examples, which do not match the AIG or do not 
+  assert their outputs. If vFailed is given, it collects their indexes.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManVerifyCexes( Gia_Man_t * pAig, Vec_Ptr_t * vCexes, Vec_Int_t * vFailed )
+{
+    Vec_Int_t * vOrder = Vec_IntAlloc( Vec_PtrSize(vCexes) );
+    Vec_Int_t * vCosts = Vec_IntStart( Vec_PtrSize(vCexes) );
+    Vec_Wrd_t * vSims  = Vec_WrdStart( Gia_ManObjNum(pAig) );
+    Vec_Wrd_t * vState = Vec_WrdStart( Gia_ManRegNum(pAig) + 1 );
+    word * pSims = Vec_WrdArray( vSims ), * pState = Vec_WrdArray( vState ), Failed;
+    Gia_Obj_t * pObj; Abc_Cex_t * p;
+    int i, k, b, f, nBatch, nFrames, * pBatch, nFailed = 0;
+    if ( vFailed )
+        Vec_IntClear( vFailed );
+    // collect the counter-examples and sort them by length
+    Vec_PtrForEachEntry( Abc_Cex_t *, vCexes, p, i )
+    {
+        if ( p == NULL || p == (Abc_Cex_t *)(ABC_PTRINT_T)1 )
+            continue;
+        if ( p->nPis != Gia_ManPiNum(pAig) || p->nRegs != Gia_ManRegNum(pAig) || p->iPo >= Gia_ManPoNum(pAig) )
+        {
+            if ( vFailed )
+                Vec_IntPush( vFailed, i );
+            nFailed++;
+            continue;
+        }
+        Vec_IntWriteEntry( vCosts, i, p->iFrame );
+        Vec_IntPush( vOrder, i );
+    }
+    Abc_MergeSortCost2( Vec_IntArray(vOrder), Vec_IntSize(vOrder), Vec_IntArray(vCosts) );
+    // simulate the batches
+    for ( b = 0; b < Vec_IntSize(vOrder); b += 64 )
+    {
+        pBatch  = Vec_IntEntryP( vOrder, b );
+        nBatch  = Abc_MinInt( 64, Vec_IntSize(vOrder) - b );
+        nFrames = 0;
+        Failed  = 0;
+        memset( pState, 0, sizeof(word) * Gia_ManRegNum(pAig) );
+        for ( k = 0; k < nBatch; k++ )
+        {
+            p = (Abc_Cex_t *)Vec_PtrEntry( vCexes, pBatch[k] );
+            nFrames = Abc_MaxInt( nFrames, p->iFrame + 1 );
+            for ( i = 0; i < p->nRegs; i++ )
+                if ( Abc_InfoHasBit(p->pData, i) )
+                    pState[i] |= (word)1 << k;
+        }
+        for ( f = 0; f < nFrames; f++ )
+        {
+            Gia_ManCexesSimulateFrame( pAig, vCexes, pBatch, nBatch, f, pState, pSims );
+            // check the outputs failed in this frame
+            for ( k = 0; k < nBatch; k++ )
+            {
+                p = (Abc_Cex_t *)Vec_PtrEntry( vCexes, pBatch[k] );
+                if ( p->iFrame == f && !((pSims[Gia_ObjId(pAig, Gia_ManPo(pAig, p->iPo))] >> k) & 1) )
+                    Failed |= (word)1 << k;
+            }
+            Gia_ManForEachRi( pAig, pObj, i )
+                pState[i] = pSims[Gia_ObjId(pAig, pObj)];
+        }
+        for ( k = 0; k < nBatch; k++ )
+            if ( (Failed >> k) & 1 )
+            {
+                if ( vFailed )
+                    Vec_IntPush( vFailed, pBatch[k] );
+                nFailed++;
+            }
+    }
+    if ( vFailed )
+        Vec_IntSort( vFailed, 0 );
+    Vec_IntFree( vOrder );
+    Vec_IntFree( vCosts );
+    Vec_WrdFree( vSims );
+    Vec_WrdFree( vState );
+    return nFailed;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Resimulates the counter-example.]
@@ -0,0 +1,844 @@
+/**CFile****************************************************************
+
+  FileName    [giaCkpt.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Binary checkpoints of the AIG with all its attributes.]
+
+  Author      []
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 19, 2026.]
+
+  Revision    [$Id: giaCkpt.c,v 1.00 2026/10/19 00:00:00 Exp $]
+
+***********************************************************************/
+
+#include <stddef.h>
+#include "gia.h"
+#include "misc/tim/tim.h"
+#include "misc/zlib/zlib.h"
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The checkpoint is a sequence of sections. Each section starts with
+// a 16-byte header (tag, reserved word, 64-bit payload size) followed
+// by the payload padded to 8 bytes. Object arrays are stored as they
+// are laid out in memory, so an uncompressed checkpoint can be mapped
+// and copied directly into the manager. For this reason, the object
+// size and the large-object mode are recorded with the scalar
+// parameters, and a checkpoint with a different layout is rejected.
+
+#define GIA_CKPT_MAGIC   "ABCCKPT1"
+#define GIA_CKPT_VECINT  100        // the first tag of integer vectors
+
+#ifdef ABC_USE_GIA_LARGE
+#define GIA_CKPT_LARGE   1          // the object layout of the large-object mode
+#else
+#define GIA_CKPT_LARGE   0
+#endif
+
+typedef enum {
+    GIA_CKPT_END = 0,               // end of the checkpoint
+    GIA_CKPT_GIA,                   // start of an AIG
+    GIA_CKPT_GIA_END,               // end of an AIG
+    GIA_CKPT_USER,                  // user data (such as the current network)
+    GIA_CKPT_NAME = 10,             // pName
+    GIA_CKPT_SPEC,                  // pSpec
+    GIA_CKPT_SIZES,                 // scalar parameters
+    GIA_CKPT_OBJS,                  // pObjs
+    GIA_CKPT_CIS,                   // vCis
+    GIA_CKPT_COS,                   // vCos
+    GIA_CKPT_MUXES,                 // pMuxes
+    GIA_CKPT_REPRS,                 // pReprs
+    GIA_CKPT_NEXTS,                 // pNexts
+    GIA_CKPT_SIBLS,                 // pSibls
+    GIA_CKPT_PLACE,                 // pPlacement
+    GIA_CKPT_SWITCH,                // pSwitching
+    GIA_CKPT_TIMES,                 // default arrival/required times
+    GIA_CKPT_INARRS,                // vInArrs
+    GIA_CKPT_OUTREQS,               // vOutReqs
+    GIA_CKPT_MANTIME,               // pManTime
+    GIA_CKPT_CELLSTR,               // pCellStr
+    GIA_CKPT_CONFIGS2,              // vConfigs2
+    GIA_CKPT_NAMESIN,               // vNamesIn
+    GIA_CKPT_NAMESOUT,              // vNamesOut
+    GIA_CKPT_NAMESNODE,             // vNamesNode
+    GIA_CKPT_CEXSEQ,                // pCexSeq
+    GIA_CKPT_CEXCOMB                // pCexComb
+} Gia_CkptTag_t;
+
+// integer vectors saved in the checkpoint (the order defines the tags)
+static int s_GiaCkptVecInts[] = {
+    offsetof(Gia_Man_t, vMapping),
+    offsetof(Gia_Man_t, vCellMapping),
+    offsetof(Gia_Man_t, vPacking),
+    offsetof(Gia_Man_t, vConfigs),
+    offsetof(Gia_Man_t, vLutConfigs),
+    offsetof(Gia_Man_t, vEdgeDelay),
+    offsetof(Gia_Man_t, vEdgeDelayR),
+    offsetof(Gia_Man_t, vEdge1),
+    offsetof(Gia_Man_t, vEdge2),
+    offsetof(Gia_Man_t, vFlopClasses),
+    offsetof(Gia_Man_t, vGateClasses),
+    offsetof(Gia_Man_t, vObjClasses),
+    offsetof(Gia_Man_t, vInitClasses),
+    offsetof(Gia_Man_t, vRegClasses),
+    offsetof(Gia_Man_t, vRegInits),
+    offsetof(Gia_Man_t, vBarBufs),
+    offsetof(Gia_Man_t, vCiArrs),
+    offsetof(Gia_Man_t, vCoReqs),
+    offsetof(Gia_Man_t, vCoArrs),
+    offsetof(Gia_Man_t, vCoAttrs),
+    offsetof(Gia_Man_t, vWeights),
+    offsetof(Gia_Man_t, vSwitching),
+    offsetof(Gia_Man_t, vUserPiIds),
+    offsetof(Gia_Man_t, vUserPoIds),
+    offsetof(Gia_Man_t, vUserFfIds),
+    offsetof(Gia_Man_t, vCiNumsOrig),
+    offsetof(Gia_Man_t, vCoNumsOrig),
+    offsetof(Gia_Man_t, vIdsOrig),
+    offsetof(Gia_Man_t, vIdsEquiv),
+    offsetof(Gia_Man_t, vEquLitIds),
+    offsetof(Gia_Man_t, vCofVars)
+};
+
+static inline Vec_Int_t ** Gia_CkptVecInt( Gia_Man_t * p, int i ) { return (Vec_Int_t **)((char *)p + s_GiaCkptVecInts[i]); }
+
+// output stream
+struct Gia_CkptOut_t_
+{
+    FILE *         pFile;         // uncompressed output
+    gzFile         pGz;           // compressed output
+    word           nBytes;        // bytes written
+    int            fError;        // write error
+};
+
+// input buffer
+typedef struct Gia_CkptIn_t_ Gia_CkptIn_t;
+struct Gia_CkptIn_t_
+{
+    char *         pBuffer;       // file contents
+    size_t         nSize;         // file size
+    size_t         iPos;          // current position
+    int            fError;        // format error
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Writes raw bytes.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_CkptOutBytes( Gia_CkptOut_t * p, void * pData, word nBytes )
+{
+    char * pChar = (char *)pData;
+    p->nBytes += nBytes;
+    if ( p->fError )
+        return;
+    if ( p->pFile )
+    {
+        if ( fwrite( pChar, 1, (size_t)nBytes, p->pFile ) != (size_t)nBytes )
+            p->fError = 1;
+        return;
+    }
+    while ( nBytes > 0 )
+    {
+        unsigned nChunk = (unsigned)Abc_MinWord( nBytes, (word)1 << 30 );
+        if ( gzwrite( p->pGz, pChar, nChunk ) != (int)nChunk )
+        {
+            p->fError = 1;
+            return;
+        }
+        pChar  += nChunk;
+        nBytes -= nChunk;
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes one section.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_CkptOutSection( Gia_CkptOut_t * p, int Tag, void * pData, word nBytes )
+{
+    static char Zeros[8] = {0};
+    int Header[2] = { Tag, 0 };
+    Gia_CkptOutBytes( p, Header, 8 );
+    Gia_CkptOutBytes( p, &nBytes, 8 );
+    if ( nBytes == 0 )
+        return;
+    Gia_CkptOutBytes( p, pData, nBytes );
+    if ( nBytes % 8 )
+        Gia_CkptOutBytes( p, Zeros, 8 - nBytes % 8 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Opens and closes the output stream.]
+
+  Description [The checkpoint is compressed unless fCompress is 0.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_CkptOut_t * Gia_CkptOutStart( char * pFileName, int fCompress )
+{
+    Gia_CkptOut_t * p = ABC_CALLOC( Gia_CkptOut_t, 1 );
+    if ( fCompress )
+        p->pGz = gzopen( pFileName, "wb6" );
+    else
+        p->pFile = fopen( pFileName, "wb" );
+    if ( p->pGz == NULL && p->pFile == NULL )
+    {
+        ABC_FREE( p );
+        return NULL;
+    }
+    Gia_CkptOutBytes( p, (void *)GIA_CKPT_MAGIC, 8 );
+    return p;
+}
+int Gia_CkptOutStop( Gia_CkptOut_t * p )
+{
+    int RetValue;
+    Gia_CkptOutSection( p, GIA_CKPT_END, NULL, 0 );
+    if ( p->pGz && gzclose( p->pGz ) != Z_OK )
+        p->fError = 1;
+    if ( p->pFile && fclose( p->pFile ) )
+        p->fError = 1;
+    RetValue = !p->fError;
+    ABC_FREE( p );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes attributes of different types.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Gia_CkptOutString( Gia_CkptOut_t * p, int Tag, char * pStr )
+{
+    if ( pStr )
+        Gia_CkptOutSection( p, Tag, pStr, strlen(pStr) + 1 );
+}
+static inline void Gia_CkptOutVecInt( Gia_CkptOut_t * p, int Tag, Vec_Int_t * vVec )
+{
+    if ( vVec )
+        Gia_CkptOutSection( p, Tag, Vec_IntArray(vVec), sizeof(int) * (word)Vec_IntSize(vVec) );
+}
+static inline void Gia_CkptOutVecFlt( Gia_CkptOut_t * p, int Tag, Vec_Flt_t * vVec )
+{
+    if ( vVec )
+        Gia_CkptOutSection( p, Tag, Vec_FltArray(vVec), sizeof(float) * (word)Vec_FltSize(vVec) );
+}
+static inline void Gia_CkptOutVecStr( Gia_CkptOut_t * p, int Tag, Vec_Str_t * vVec )
+{
+    if ( vVec )
+        Gia_CkptOutSection( p, Tag, Vec_StrArray(vVec), (word)Vec_StrSize(vVec) );
+}
+static inline void Gia_CkptOutNames( Gia_CkptOut_t * p, int Tag, Vec_Ptr_t * vNames )
+{
+    Vec_Str_t * vStr;
+    char * pName; int i;
+    if ( vNames == NULL )
+        return;
+    vStr = Vec_StrAlloc( 1000 );
+    Vec_PtrForEachEntry( char *, vNames, pName, i )
+    {
+        Vec_StrAppend( vStr, pName ? pName : "" );
+        Vec_StrPush( vStr, '\0' );
+    }
+    Gia_CkptOutSection( p, Tag, Vec_StrArray(vStr), (word)Vec_StrSize(vStr) );
+    Vec_StrFree( vStr );
+}
+static inline void Gia_CkptOutCex( Gia_CkptOut_t * p, int Tag, Abc_Cex_t * pCex )
+{
+    if ( pCex )
+        Gia_CkptOutSection( p, Tag, pCex, sizeof(Abc_Cex_t) + sizeof(unsigned) * (word)Abc_BitWordNum(pCex->nBits) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the AIG with all attributes.]
+
+  Description [Attributes that point to libraries owned by the framework
+  (pLutLib, pCellLib) and temporary data of the algorithms are not saved.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_CkptOutGia( Gia_CkptOut_t * p, Gia_Man_t * pGia )
+{
+    int Sizes[11] = { pGia->nObjs, pGia->nRegs, pGia->nConstrs, pGia->nXors, pGia->nMuxes, pGia->nBufs,
+                      pGia->And2Delay, pGia->nAnd2Delay, pGia->fGiaSimple, (int)sizeof(Gia_Obj_t), GIA_CKPT_LARGE };
+    float Times[2] = { pGia->DefInArrs, pGia->DefOutReqs };
+    word nObjs = (word)pGia->nObjs;
+    int i;
+    Gia_CkptOutSection( p, GIA_CKPT_GIA, NULL, 0 );
+    Gia_CkptOutSection( p, GIA_CKPT_SIZES, Sizes, sizeof(Sizes) );
+    Gia_CkptOutString( p, GIA_CKPT_NAME, pGia->pName );
+    Gia_CkptOutString( p, GIA_CKPT_SPEC, pGia->pSpec );
+    Gia_CkptOutSection( p, GIA_CKPT_OBJS, pGia->pObjs, sizeof(Gia_Obj_t) * nObjs );
+    Gia_CkptOutVecInt( p, GIA_CKPT_CIS, pGia->vCis );
+    Gia_CkptOutVecInt( p, GIA_CKPT_COS, pGia->vCos );
+    if ( pGia->pMuxes )
+        Gia_CkptOutSection( p, GIA_CKPT_MUXES, pGia->pMuxes, sizeof(unsigned) * nObjs );
+    if ( pGia->pReprs )
+        Gia_CkptOutSection( p, GIA_CKPT_REPRS, pGia->pReprs, sizeof(Gia_Rpr_t) * nObjs );
+    if ( pGia->pNexts )
+        Gia_CkptOutSection( p, GIA_CKPT_NEXTS, pGia->pNexts, sizeof(int) * nObjs );
+    if ( pGia->pSibls )
+        Gia_CkptOutSection( p, GIA_CKPT_SIBLS, pGia->pSibls, sizeof(int) * nObjs );
+    if ( pGia->pPlacement )
+        Gia_CkptOutSection( p, GIA_CKPT_PLACE, pGia->pPlacement, sizeof(Gia_Plc_t) * nObjs );
+    if ( pGia->pSwitching )
+        Gia_CkptOutSection( p, GIA_CKPT_SWITCH, pGia->pSwitching, nObjs );
+    Gia_CkptOutSection( p, GIA_CKPT_TIMES, Times, sizeof(Times) );
+    Gia_CkptOutVecFlt( p, GIA_CKPT_INARRS, pGia->vInArrs );
+    Gia_CkptOutVecFlt( p, GIA_CKPT_OUTREQS, pGia->vOutReqs );
+    if ( pGia->pManTime )
+    {
+        Vec_Str_t * vStr = Tim_ManSave( (Tim_Man_t *)pGia->pManTime, 0 );
+        Gia_CkptOutVecStr( p, GIA_CKPT_MANTIME, vStr );
+        Vec_StrFree( vStr );
+    }
+    Gia_CkptOutString( p, GIA_CKPT_CELLSTR, pGia->pCellStr );
+    Gia_CkptOutVecStr( p, GIA_CKPT_CONFIGS2, pGia->vConfigs2 );
+    Gia_CkptOutNames( p, GIA_CKPT_NAMESIN, pGia->vNamesIn );
+    Gia_CkptOutNames( p, GIA_CKPT_NAMESOUT, pGia->vNamesOut );
+    Gia_CkptOutNames( p, GIA_CKPT_NAMESNODE, pGia->vNamesNode );
+    Gia_CkptOutCex( p, GIA_CKPT_CEXSEQ, pGia->pCexSeq );
+    Gia_CkptOutCex( p, GIA_CKPT_CEXCOMB, pGia->pCexComb );
+    for ( i = 0; i < (int)(sizeof(s_GiaCkptVecInts)/sizeof(int)); i++ )
+        Gia_CkptOutVecInt( p, GIA_CKPT_VECINT + i, *Gia_CkptVecInt(pGia, i) );
+    if ( pGia->pAigExtra )
+        Gia_CkptOutGia( p, pGia->pAigExtra );
+    Gia_CkptOutSection( p, GIA_CKPT_GIA_END, NULL, 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes user data, such as the current network.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_CkptOutUser( Gia_CkptOut_t * p, int Type, char * pData, word nBytes )
+{
+    char * pBuffer = ABC_ALLOC( char, nBytes + 8 );
+    memcpy( pBuffer, &Type, sizeof(int) );
+    memset( pBuffer + 4, 0, 4 );
+    memcpy( pBuffer + 8, pData, (size_t)nBytes );
+    Gia_CkptOutSection( p, GIA_CKPT_USER, pBuffer, nBytes + 8 );
+    ABC_FREE( pBuffer );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the AIG into a checkpoint file.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManCkptWrite( Gia_Man_t * p, char * pFileName, int fCompress )
+{
+    Gia_CkptOut_t * pOut = Gia_CkptOutStart( pFileName, fCompress );
+    if ( pOut == NULL )
+        return 0;
+    Gia_CkptOutGia( pOut, p );
+    return Gia_CkptOutStop( pOut );
+}
+
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the contents of a checkpoint file.]
+
+  Description [Uncompressed checkpoints are memory-mapped when the platform
+  allows it. The returned buffer should be released with Gia_CkptInStop().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_CkptIn_t * Gia_CkptInStart( char * pFileName, int * pfMapped )
+{
+    Gia_CkptIn_t * p;
+    unsigned char Magic[2] = {0};
+    gzFile pGz;
+    size_t nAlloc;
+    FILE * pFile = fopen( pFileName, "rb" );
+    *pfMapped = 0;
+    if ( pFile == NULL )
+        return NULL;
+    if ( fread( Magic, 1, 2, pFile ) != 2 )
+        Magic[0] = 0;
+    fclose( pFile );
+    p = ABC_CALLOC( Gia_CkptIn_t, 1 );
+#if !defined(_WIN32)
+    if ( !(Magic[0] == 0x1f && Magic[1] == 0x8b) )
+    {
+        struct stat Stat;
+        int fd = open( pFileName, O_RDONLY );
+        if ( fd >= 0 && fstat( fd, &Stat ) == 0 && Stat.st_size > 0 )
+        {
+            void * pMap = mmap( NULL, (size_t)Stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+            if ( pMap != MAP_FAILED )
+            {
+                p->pBuffer = (char *)pMap;
+                p->nSize   = (size_t)Stat.st_size;
+                *pfMapped  = 1;
+            }
+        }
+        if ( fd >= 0 )
+            close( fd );
+        if ( *pfMapped )
+            return p;
+    }
+#endif
+    // read through zlib, which also handles uncompressed files
+    pGz = gzopen( pFileName, "rb" );
+    if ( pGz == NULL )
+    {
+        ABC_FREE( p );
+        return NULL;
+    }
+    nAlloc = 1 << 20;
+    p->pBuffer = ABC_ALLOC( char, nAlloc );
+    while ( 1 )
+    {
+        int nRead = gzread( pGz, p->pBuffer + p->nSize, (unsigned)Abc_MinWord( nAlloc - p->nSize, (word)1 << 30 ) );
+        if ( nRead <= 0 )
+            break;
+        p->nSize += nRead;
+        if ( p->nSize == nAlloc )
+        {
+            nAlloc *= 2;
+            p->pBuffer = ABC_REALLOC( char, p->pBuffer, nAlloc );
+        }
+    }
+    gzclose( pGz );
+    return p;
+}
+void Gia_CkptInStop( Gia_CkptIn_t * p, int fMapped )
+{
+#if !defined(_WIN32)
+    if ( fMapped )
+        munmap( p->pBuffer, p->nSize );
+    else
+#endif
+    ABC_FREE( p->pBuffer );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the next section.]
+
+  Description [Returns the tag and sets the pointer to the payload.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_CkptInSection( Gia_CkptIn_t * p, char ** ppData, word * pnBytes )
+{
+    int Tag; word nBytes;
+    if ( p->fError || p->iPos + 16 > p->nSize )
+    {
+        p->fError = 1;
+        return GIA_CKPT_END;
+    }
+    memcpy( &Tag, p->pBuffer + p->iPos, sizeof(int) );
+    memcpy( &nBytes, p->pBuffer + p->iPos + 8, sizeof(word) );
+    p->iPos += 16;
+    if ( nBytes > p->nSize - p->iPos )
+    {
+        p->fError = 1;
+        return GIA_CKPT_END;
+    }
+    *ppData  = p->pBuffer + p->iPos;
+    *pnBytes = nBytes;
+    p->iPos += (size_t)((nBytes + 7) / 8 * 8);
+    return Tag;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads attributes of different types.]
+
+  Description [The readers of vectors, names, and counter-examples return
+  NULL if the section does not have the expected format.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline char * Gia_CkptInCopy( char * pData, word nBytes )
+{
+    char * pCopy = ABC_ALLOC( char, nBytes ? nBytes : 1 );
+    memcpy( pCopy, pData, (size_t)nBytes );
+    return pCopy;
+}
+static inline Vec_Int_t * Gia_CkptInVecInt( char * pData, word nBytes )
+{
+    int nSize = (int)(nBytes / sizeof(int));
+    Vec_Int_t * vVec;
+    if ( nBytes % sizeof(int) )
+        return NULL;
+    vVec = Vec_IntAlloc( Abc_MaxInt(nSize, 1) );
+    memcpy( Vec_IntArray(vVec), pData, (size_t)nBytes );
+    vVec->nSize = nSize;
+    return vVec;
+}
+static inline Vec_Flt_t * Gia_CkptInVecFlt( char * pData, word nBytes )
+{
+    int nSize = (int)(nBytes / sizeof(float));
+    Vec_Flt_t * vVec;
+    if ( nBytes % sizeof(float) )
+        return NULL;
+    vVec = Vec_FltAlloc( Abc_MaxInt(nSize, 1) );
+    memcpy( Vec_FltArray(vVec), pData, (size_t)nBytes );
+    vVec->nSize = nSize;
+    return vVec;
+}
+static inline Vec_Str_t * Gia_CkptInVecStr( char * pData, word nBytes )
+{
+    Vec_Str_t * vVec = Vec_StrAlloc( Abc_MaxInt((int)nBytes, 1) );
+    memcpy( Vec_StrArray(vVec), pData, (size_t)nBytes );
+    vVec->nSize = (int)nBytes;
+    return vVec;
+}
+static inline Vec_Ptr_t * Gia_CkptInNames( char * pData, word nBytes )
+{
+    Vec_Ptr_t * vNames = Vec_PtrAlloc( 100 );
+    char * pLimit = pData + nBytes, * pEnd;
+    while ( pData < pLimit )
+    {
+        pEnd = (char *)memchr( pData, 0, (size_t)(pLimit - pData) );
+        if ( pEnd == NULL )
+        {
+            Vec_PtrFreeFree( vNames );
+            return NULL;
+        }
+        Vec_PtrPush( vNames, Abc_UtilStrsav(pData) );
+        pData = pEnd + 1;
+    }
+    return vNames;
+}
+static inline Abc_Cex_t * Gia_CkptInCex( char * pData, word nBytes )
+{
+    Abc_Cex_t Cex;
+    if ( nBytes < sizeof(Abc_Cex_t) )
+        return NULL;
+    memcpy( &Cex, pData, sizeof(Abc_Cex_t) );
+    if ( Cex.nBits < 0 || Cex.nRegs < 0 || Cex.nPis < 0 || Cex.iFrame < 0 ||
+         (word)Cex.nBits < (word)Cex.nRegs + (word)Cex.nPis * (word)(Cex.iFrame + 1) ||
+         nBytes != sizeof(Abc_Cex_t) + sizeof(unsigned) * (word)Abc_BitWordNum(Cex.nBits) )
+        return NULL;
+    return (Abc_Cex_t *)Gia_CkptInCopy( pData, nBytes );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the size of the fixed-size section.]
+
+  Description [Returns 0 if the size of the section is not fixed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static word Gia_CkptInSectionSize( int Tag, int nObjs )
+{
+    switch ( Tag )
+    {
+    case GIA_CKPT_OBJS:   return sizeof(Gia_Obj_t) * (word)nObjs;
+    case GIA_CKPT_MUXES:  return sizeof(unsigned)  * (word)nObjs;
+    case GIA_CKPT_REPRS:  return sizeof(Gia_Rpr_t) * (word)nObjs;
+    case GIA_CKPT_NEXTS:  return sizeof(int)       * (word)nObjs;
+    case GIA_CKPT_SIBLS:  return sizeof(int)       * (word)nObjs;
+    case GIA_CKPT_PLACE:  return sizeof(Gia_Plc_t) * (word)nObjs;
+    case GIA_CKPT_SWITCH: return (word)nObjs;
+    case GIA_CKPT_TIMES:  return 2 * sizeof(float);
+    default:              return 0;
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the AIG with all attributes.]
+
+  Description [Assumes that the section starting the AIG is already read.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_CkptInGia( Gia_CkptIn_t * p )
+{
+    Gia_Man_t * pGia = NULL;
+    char * pData; word nBytes;
+    int Tag = GIA_CKPT_END, nObjs = 0, fObjs = 0;
+    word nExpected;
+    while ( (Tag = Gia_CkptInSection(p, &pData, &nBytes)) != GIA_CKPT_GIA_END )
+    {
+        if ( Tag == GIA_CKPT_END )
+            break;
+        if ( Tag == GIA_CKPT_SIZES )
+        {
+            int Sizes[11] = {0};
+            memcpy( Sizes, pData, (size_t)Abc_MinWord(nBytes, sizeof(Sizes)) );
+            nObjs = Sizes[0];
+            if ( pGia != NULL || nObjs <= 0 )
+                break;
+            if ( Sizes[9] != (int)sizeof(Gia_Obj_t) || Sizes[10] != GIA_CKPT_LARGE )
+            {
+                printf( "The checkpoint has %d-byte objects%s, while this binary uses %d-byte objects%s.\n",
+                    Sizes[9], Sizes[10] ? " (large mode)" : "", (int)sizeof(Gia_Obj_t), GIA_CKPT_LARGE ? " (large mode)" : "" );
+                break;
+            }
+            pGia = Gia_ManStart( nObjs );
+            pGia->nObjs      = nObjs;
+            pGia->nRegs      = Sizes[1];
+            pGia->nConstrs   = Sizes[2];
+            pGia->nXors      = Sizes[3];
+            pGia->nMuxes     = Sizes[4];
+            pGia->nBufs      = Sizes[5];
+            pGia->And2Delay  = Sizes[6];
+            pGia->nAnd2Delay = Sizes[7];
+            pGia->fGiaSimple = Sizes[8];
+            continue;
+        }
+        if ( pGia == NULL )
+            break;
+        nExpected = Gia_CkptInSectionSize( Tag, nObjs );
+        if ( nExpected && nBytes != nExpected )
+        {
+            printf( "Section %d of the checkpoint has %.0f bytes instead of %.0f.\n", Tag, (double)nBytes, (double)nExpected );
+            break;
+        }
+        if ( Tag == GIA_CKPT_NAME )
+            pGia->pName = Gia_CkptInCopy( pData, nBytes );
+        else if ( Tag == GIA_CKPT_SPEC )
+            pGia->pSpec = Gia_CkptInCopy( pData, nBytes );
+        else if ( Tag == GIA_CKPT_OBJS )
+            memcpy( pGia->pObjs, pData, (size_t)nBytes ), fObjs = 1;
+        else if ( Tag == GIA_CKPT_CIS || Tag == GIA_CKPT_COS )
+        {
+            Vec_Int_t ** pvVec = Tag == GIA_CKPT_CIS ? &pGia->vCis : &pGia->vCos;
+            Vec_Int_t * vVec = Gia_CkptInVecInt( pData, nBytes );
+            if ( vVec == NULL )
+                break;
+            Vec_IntFree( *pvVec );
+            *pvVec = vVec;
+        }
+        else if ( Tag == GIA_CKPT_MUXES )
+            pGia->pMuxes = (unsigned *)Gia_CkptInCopy( pData, nBytes );
+        else if ( Tag == GIA_CKPT_REPRS )
+            pGia->pReprs = (Gia_Rpr_t *)Gia_CkptInCopy( pData, nBytes );
+        else if ( Tag == GIA_CKPT_NEXTS )
+            pGia->pNexts = (int *)Gia_CkptInCopy( pData, nBytes );
+        else if ( Tag == GIA_CKPT_SIBLS )
+            pGia->pSibls = (int *)Gia_CkptInCopy( pData, nBytes );
+        else if ( Tag == GIA_CKPT_PLACE )
+            pGia->pPlacement = (Gia_Plc_t *)Gia_CkptInCopy( pData, nBytes );
+        else if ( Tag == GIA_CKPT_SWITCH )
+            pGia->pSwitching = (unsigned char *)Gia_CkptInCopy( pData, nBytes );
+        else if ( Tag == GIA_CKPT_TIMES )
+        {
+            memcpy( &pGia->DefInArrs, pData, sizeof(float) );
+            memcpy( &pGia->DefOutReqs, pData + sizeof(float), sizeof(float) );
+        }
+        else if ( Tag == GIA_CKPT_INARRS || Tag == GIA_CKPT_OUTREQS )
+        {
+            Vec_Flt_t ** pvVec = Tag == GIA_CKPT_INARRS ? &pGia->vInArrs : &pGia->vOutReqs;
+            Vec_FltFreeP( pvVec );
+            if ( (*pvVec = Gia_CkptInVecFlt( pData, nBytes )) == NULL )
+                break;
+        }
+        else if ( Tag == GIA_CKPT_MANTIME )
+        {
+            Vec_Str_t * vStr = Gia_CkptInVecStr( pData, nBytes );
+            pGia->pManTime = Tim_ManLoad( vStr, 0 );
+            Vec_StrFree( vStr );
+        }
+        else if ( Tag == GIA_CKPT_CELLSTR )
+            pGia->pCellStr = Gia_CkptInCopy( pData, nBytes );
+        else if ( Tag == GIA_CKPT_CONFIGS2 )
+            pGia->vConfigs2 = Gia_CkptInVecStr( pData, nBytes );
+        else if ( Tag == GIA_CKPT_NAMESIN || Tag == GIA_CKPT_NAMESOUT || Tag == GIA_CKPT_NAMESNODE )
+        {
+            Vec_Ptr_t ** pvVec = Tag == GIA_CKPT_NAMESIN ? &pGia->vNamesIn : Tag == GIA_CKPT_NAMESOUT ? &pGia->vNamesOut : &pGia->vNamesNode;
+            if ( *pvVec )
+                Vec_PtrFreeFree( *pvVec );
+            if ( (*pvVec = Gia_CkptInNames( pData, nBytes )) == NULL )
+                break;
+        }
+        else if ( Tag == GIA_CKPT_CEXSEQ || Tag == GIA_CKPT_CEXCOMB )
+        {
+            Abc_Cex_t ** ppCex = Tag == GIA_CKPT_CEXSEQ ? &pGia->pCexSeq : &pGia->pCexComb;
+            ABC_FREE( *ppCex );
+            if ( (*ppCex = Gia_CkptInCex( pData, nBytes )) == NULL )
+                break;
+        }
+        else if ( Tag == GIA_CKPT_GIA )
+            pGia->pAigExtra = Gia_CkptInGia( p );
+        else if ( Tag >= GIA_CKPT_VECINT && Tag < GIA_CKPT_VECINT + (int)(sizeof(s_GiaCkptVecInts)/sizeof(int)) )
+        {
+            Vec_Int_t ** pvVec = Gia_CkptVecInt( pGia, Tag - GIA_CKPT_VECINT );
+            Vec_IntFreeP( pvVec );
+            if ( (*pvVec = Gia_CkptInVecInt( pData, nBytes )) == NULL )
+                break;
+        }
+        // unknown sections are skipped to let newer checkpoints load
+    }
+    if ( Tag != GIA_CKPT_GIA_END || pGia == NULL || nObjs == 0 || !fObjs ||
+         Vec_IntSize(pGia->vCis) + Vec_IntSize(pGia->vCos) > nObjs ||
+         Gia_ManRegNum(pGia) < 0 || Gia_ManRegNum(pGia) > Abc_MinInt(Gia_ManCiNum(pGia), Gia_ManCoNum(pGia)) ||
+         (pGia->pCexSeq && (pGia->pCexSeq->nPis != Gia_ManPiNum(pGia) || pGia->pCexSeq->nRegs != Gia_ManRegNum(pGia))) ||
+         (pGia->pCexComb && pGia->pCexComb->nPis + pGia->pCexComb->nRegs != Gia_ManCiNum(pGia)) )
+    {
+        p->fError = 1;
+        if ( pGia )
+            Gia_ManStop( pGia );
+        return NULL;
+    }
+    return pGia;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the checkpoint.]
+
+  Description [Returns the first AIG in the checkpoint, if present, in
+  ppGia. The optional callback is invoked for each user section. Returns
+  0 if the checkpoint cannot be read, in which case the data passed to
+  the callback should be discarded.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManCkptReadUser( char * pFileName, Gia_Man_t ** ppGia, void (*pFuncUser)(void *, int, char *, word), void * pUser, int fVerbose )
+{
+    Gia_Man_t * pGia = NULL, * pTemp;
+    Gia_CkptIn_t * p;
+    char * pData; word nBytes;
+    int Tag, fMapped, RetValue;
+    abctime clk = Abc_Clock();
+    *ppGia = NULL;
+    p = Gia_CkptInStart( pFileName, &fMapped );
+    if ( p == NULL )
+    {
+        printf( "Cannot open checkpoint file \"%s\".\n", pFileName );
+        return 0;
+    }
+    if ( p->nSize < 8 || strncmp(p->pBuffer, GIA_CKPT_MAGIC, 8) )
+    {
+        printf( "File \"%s\" is not an ABC checkpoint.\n", pFileName );
+        Gia_CkptInStop( p, fMapped );
+        return 0;
+    }
+    p->iPos = 8;
+    while ( (Tag = Gia_CkptInSection(p, &pData, &nBytes)) != GIA_CKPT_END )
+    {
+        if ( Tag == GIA_CKPT_GIA )
+        {
+            pTemp = Gia_CkptInGia( p );
+            if ( pGia == NULL )
+                pGia = pTemp;
+            else if ( pTemp )
+                Gia_ManStop( pTemp );
+        }
+        else if ( Tag == GIA_CKPT_USER && nBytes >= 8 && pFuncUser )
+        {
+            int Type;
+            memcpy( &Type, pData, sizeof(int) );
+            pFuncUser( pUser, Type, pData + 8, nBytes - 8 );
+        }
+    }
+    RetValue = !p->fError;
+    if ( p->fError )
+    {
+        printf( "Checkpoint file \"%s\" is truncated or corrupted.\n", pFileName );
+        if ( pGia )
+            Gia_ManStop( pGia );
+        pGia = NULL;
+    }
+    else if ( fVerbose )
+    {
+        printf( "Read %.2f MB from %s checkpoint.  ", 1.0*p->nSize/(1<<20), fMapped ? "mapped" : "compressed" );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    Gia_CkptInStop( p, fMapped );
+    *ppGia = pGia;
+    return RetValue;
+}
+Gia_Man_t * Gia_ManCkptRead( char * pFileName )
+{
+    Gia_Man_t * pGia;
+    Gia_ManCkptReadUser( pFileName, &pGia, NULL, NULL, 0 );
+    return pGia;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
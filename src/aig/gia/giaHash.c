@@ -102,10 +102,17 @@ int Gia_ManHashLookup( Gia_Man_t * p, Gia_Obj_t * p0, Gia_Obj_t * p1 )
   SeeAlso     []
 
 ***********************************************************************/
+static void Gia_ManHashTableStart( Vec_Int_t * vTable, int nSize )  
+{
+    // huge pages should be requested before the table is touched
+    Vec_IntGrow( vTable, nSize );
+    Util_HugeAdvise( Vec_IntArray(vTable), sizeof(int) * (size_t)nSize );
+    Vec_IntFill( vTable, nSize, 0 );
+}
 void Gia_ManHashAlloc( Gia_Man_t * p )  
 {
     assert( Vec_IntSize(&p->vHTable) == 0 );
-    Vec_IntFill( &p->vHTable, Abc_PrimeCudd( Gia_ManAndNum(p) ? Gia_ManAndNum(p) + 1000 : p->nObjsAlloc ), 0 );
+    Gia_ManHashTableStart( &p->vHTable, Abc_PrimeCudd( Gia_ManAndNum(p) ? Gia_ManAndNum(p) + 1000 : p->nObjsAlloc ) );
     Vec_IntGrow( &p->vHash, Abc_MaxInt(Vec_IntSize(&p->vHTable), Gia_ManObjNum(p)) );
     Vec_IntFill( &p->vHash, Gia_ManObjNum(p), 0 );
 //printf( "Alloced table with %d entries.\n", Vec_IntSize(&p->vHTable) );
@@ -170,7 +177,7 @@ void Gia_ManHashResize( Gia_Man_t * p )
     assert( Vec_IntSize(&vOld) > 0 );
     // replace the table
     Vec_IntZero( &p->vHTable );
-    Vec_IntFill( &p->vHTable, Abc_PrimeCudd( 2 * Gia_ManAndNum(p) ), 0 ); 
+    Gia_ManHashTableStart( &p->vHTable, Abc_PrimeCudd( 2 * Gia_ManAndNum(p) ) );
     // rehash the entries from the old table
     Counter = 0;
     Vec_IntForEachEntry( &vOld, iThis, i )
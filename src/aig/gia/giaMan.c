@@ -60,7 +60,7 @@ Gia_Man_t * Gia_ManStart( int nObjsMax )
     assert( nObjsMax > 0 );
     p = ABC_CALLOC( Gia_Man_t, 1 );
     p->nObjsAlloc = nObjsMax;
-    p->pObjs = ABC_CALLOC( Gia_Obj_t, nObjsMax );
+    p->pObjs = (Gia_Obj_t *)Util_HugeAlloc( sizeof(Gia_Obj_t) * (size_t)nObjsMax );
     p->pObjs->iDiff0 = p->pObjs->iDiff1 = GIA_NONE;
     p->nObjs = 1;
     p->vCis  = Vec_IntAlloc( nObjsMax / 20 );
@@ -176,7 +176,7 @@ void Gia_ManStop( Gia_Man_t * p )
     ABC_FREE( p->pRefs );
     ABC_FREE( p->pLutRefs );
     ABC_FREE( p->pMuxes );
-    ABC_FREE( p->pObjs );
+    Util_HugeFree( p->pObjs, sizeof(Gia_Obj_t) * (size_t)p->nObjsAlloc );
     ABC_FREE( p->pSpec );
     ABC_FREE( p->pName );
     ABC_FREE( p );
@@ -212,6 +212,53 @@ double Gia_ManMemory( Gia_Man_t * p )
     return Memory;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Prints memory used by the main arrays of the AIG.]
+
+  Description [For each array, prints the allocated memory in megabytes
+  and in bytes per object.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_ManPrintMemoryOne( char * pName, double Memory, int nObjs )
+{
+    if ( Memory == 0 )
+        return;
+    Abc_Print( 1, "%-12s : %10.2f MB  %8.2f bytes/obj\n", pName, Memory / (1<<20), Memory / Abc_MaxInt(nObjs, 1) );
+}
+void Gia_ManPrintMemory( Gia_Man_t * p )
+{
+    int nObjs = Gia_ManObjNum(p);
+    double Memory[12] = {0}, Total = 0;
+    char * pNames[12] = { "Objects", "MUX ctrls", "Hash table", "CI/CO", "References", "Levels", 
+                          "Copies", "Equivs", "Choices", "Mapping", "Names", "Other" };
+    int i;
+    Memory[0]  = (double)sizeof(Gia_Obj_t) * p->nObjsAlloc;
+    Memory[1]  = p->pMuxes ? (double)sizeof(unsigned) * p->nObjsAlloc : 0;
+    Memory[2]  = sizeof(int) * Vec_IntCap(&p->vHTable) + sizeof(int) * Vec_IntCap(&p->vHash);
+    Memory[3]  = Vec_IntMemory( p->vCis ) + Vec_IntMemory( p->vCos );
+    Memory[4]  = (p->pRefs ? (double)sizeof(int) * nObjs : 0) + sizeof(int) * Vec_IntCap(&p->vRefs);
+    Memory[5]  = Vec_IntMemory( p->vLevels );
+    Memory[6]  = sizeof(int) * Vec_IntCap(&p->vCopies) + sizeof(int) * Vec_IntCap(&p->vCopies2);
+    Memory[7]  = (p->pReprs ? (double)sizeof(Gia_Rpr_t) * nObjs : 0) + (p->pNexts ? (double)sizeof(int) * nObjs : 0);
+    Memory[8]  = p->pSibls ? (double)sizeof(int) * nObjs : 0;
+    Memory[9]  = Vec_IntMemory( p->vMapping ) + Vec_IntMemory( p->vCellMapping );
+    Memory[10] = Vec_PtrMemory( p->vNamesIn ) + Vec_PtrMemory( p->vNamesOut ) + Vec_PtrMemory( p->vNamesNode );
+    Memory[11] = sizeof(Gia_Man_t) + Vec_FltMemory( p->vInArrs ) + Vec_FltMemory( p->vOutReqs );
+    Abc_Print( 1, "Memory used by %d objects (%d allocated, %d bytes each, limit %d):\n", 
+        nObjs, p->nObjsAlloc, (int)sizeof(Gia_Obj_t), GIA_OBJ_MAX );
+    for ( i = 0; i < 12; i++ )
+    {
+        Gia_ManPrintMemoryOne( pNames[i], Memory[i], nObjs );
+        Total += Memory[i];
+    }
+    Gia_ManPrintMemoryOne( "Total", Total, nObjs );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Stops the AIG manager.]
@@ -642,6 +689,8 @@ void Gia_ManPrintStats( Gia_Man_t * p, Gps_Par_t * pPars )
     }
     if ( pPars && pPars->fSlacks )
         Gia_ManDfsSlacksPrint( p );
+    if ( pPars && pPars->fMemory )
+        Gia_ManPrintMemory( p );
     if ( Gia_ManHasMapping(p) && pPars && pPars->fMapOutStats )
         Gia_ManPrintOutputLutStats( p );
 }
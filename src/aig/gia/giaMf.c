@@ -82,6 +82,21 @@ struct Mf_Man_t_
     int             nCutCounts[MF_LEAF_MAX+1];
 };
 
+// the range of mapped nodes whose clauses are written by one thread
+typedef struct Mf_CnfSlice_t_ Mf_CnfSlice_t; 
+struct Mf_CnfSlice_t_
+{
+    Mf_Man_t *      p;              // the mapping manager
+    Cnf_Dat_t *     pCnf;           // the CNF being written
+    Vec_Int_t *     vCnfs;          // the CNFs of the cut functions
+    Vec_Int_t *     vNodes;         // the mapped nodes
+    int *           pCnfIds;        // the CNF variables of the nodes
+    int             iStart;         // the first node of the slice
+    int             iStop;          // the node following the last one
+    int             iCla;           // the first clause of the slice
+    int             iLit;           // the first literal of the slice
+};
+
 static inline Mf_Obj_t * Mf_ManObj( Mf_Man_t * p, int i )            { return p->pLfObjs + i;                                          }
 static inline int *      Mf_ManCutSet( Mf_Man_t * p, int i )         { return (int *)Vec_PtrEntry(&p->vPages, i >> 16) + (i & 0xFFFF); }
 static inline int *      Mf_ObjCutSet( Mf_Man_t * p, int i )         { return Mf_ManCutSet(p, Mf_ManObj(p, i)->iCutSet);               }
@@ -268,7 +283,7 @@ static inline int Mf_ManCountLits( int * pCnf, int nCubes, int nVars )
                 nLits++;
     return nLits;
 }
-Vec_Int_t * Mf_ManDeriveCnfs( Mf_Man_t * p, int * pnVars, int * pnClas, int * pnLits )
+Vec_Int_t * Mf_ManDeriveCnfs( Mf_Man_t * p, int * pnVars, int * pnClas, int * pnLits, Vec_Int_t ** pvLits )
 {
     int i, k, iFunc, nCubes, nLits, * pCut, pCnf[512];
     Vec_Int_t * vLits = Vec_IntStart( Vec_IntSize(&p->vCnfSizes) );
@@ -319,10 +334,131 @@ Vec_Int_t * Mf_ManDeriveCnfs( Mf_Man_t * p, int * pnVars, int * pnClas, int * pn
         *pnClas += Vec_IntEntry(&p->vCnfSizes, iFunc);
         *pnLits += Vec_IntEntry(vLits, iFunc);
     }
-    Vec_IntFree( vLits );
+    if ( pvLits )
+        *pvLits = vLits;
+    else
+        Vec_IntFree( vLits );
     return vCnfs;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Writes clauses of one mapped node.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Mf_ManDeriveCnfNode( Mf_Man_t * p, Cnf_Dat_t * pCnf, Vec_Int_t * vCnfs, int * pCnfIds, int Id, int * piCla, int * piLit )
+{
+    int * pCut = Mf_ObjCutBest( p, Id );
+    int iFunc = Abc_Lit2Var( Mf_CutFunc(pCut) );
+    int fComplLast = Abc_LitIsCompl( Mf_CutFunc(pCut) );
+    int pFanins[16], * pCubes, nCubes, c, k;
+    int iCla = *piCla, iLit = *piLit;
+    if ( iFunc == 0 ) // constant cut
+    {
+        pCnf->pClauses[iCla++] = pCnf->pClauses[0] + iLit;
+        pCnf->pClauses[0][iLit++] = Abc_Var2Lit(pCnfIds[Id], !fComplLast);
+        *piCla = iCla, *piLit = iLit;
+        return;
+    }
+    for ( k = 0; k < Mf_CutSize(pCut); k++ )
+        pFanins[k] = pCnfIds[pCut[k+1]];
+    pFanins[k++] = pCnfIds[Id];
+    // get clauses
+    pCubes = Vec_IntEntryP( vCnfs, Vec_IntEntry(vCnfs, iFunc) );
+    nCubes = *pCubes++;
+    for ( c = 0; c < nCubes; c++ )
+    {
+        pCnf->pClauses[iCla++] = pCnf->pClauses[0] + iLit;
+        k = Mf_CutSize(pCut);
+        assert( Mf_CubeLit(pCubes[c], k) );
+        pCnf->pClauses[0][iLit++] = Abc_Var2Lit( pFanins[k], (Mf_CubeLit(pCubes[c], k) == 2) ^ fComplLast );
+        for ( k = 0; k < Mf_CutSize(pCut); k++ )
+            if ( Mf_CubeLit(pCubes[c], k) )
+                pCnf->pClauses[0][iLit++] = Abc_Var2Lit( pFanins[k], Mf_CubeLit(pCubes[c], k) == 2 );
+    }
+    *piCla = iCla, *piLit = iLit;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes clauses of the mapped nodes using several threads.]
+
+  Description [The mapped nodes are divided into slices with about the
+  same number of literals. The first clause and literal of each slice
+  are known from the clause and literal counts of the cut functions,
+  so each thread writes its slice where the sequential procedure would 
+  have written it. As a result, the CNF does not depend on the number 
+  of threads.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Mf_ManDeriveCnfSlice( void * pArg )
+{
+    Mf_CnfSlice_t * pSlice = (Mf_CnfSlice_t *)pArg;
+    int i, iCla = pSlice->iCla, iLit = pSlice->iLit;
+    for ( i = pSlice->iStart; i < pSlice->iStop; i++ )
+        Mf_ManDeriveCnfNode( pSlice->p, pSlice->pCnf, pSlice->vCnfs, pSlice->pCnfIds, Vec_IntEntry(pSlice->vNodes, i), &iCla, &iLit );
+    return 1;
+}
+static void Mf_ManDeriveCnfPar( Mf_Man_t * p, Cnf_Dat_t * pCnf, Vec_Int_t * vCnfs, Vec_Int_t * vLits, int * pCnfIds, int * piCla, int * piLit )
+{
+    int nProcs = p->pPars->nProcNum;
+    Mf_CnfSlice_t * pSlices = ABC_CALLOC( Mf_CnfSlice_t, nProcs );
+    Vec_Ptr_t * vSlices = Vec_PtrAlloc( nProcs );
+    Vec_Int_t * vNodes = Vec_IntAlloc( Gia_ManAndNum(p->pGia) );
+    word nLitsAll = 0, nLits = 0;
+    int i, Id, iFunc, iCla = *piCla, iLit = *piLit;
+    // collect the mapped nodes in the order, in which their clauses are written
+    Gia_ManForEachAndReverseId( p->pGia, Id )
+        if ( Mf_ObjMapRefNum(p, Id) )
+        {
+            Vec_IntPush( vNodes, Id );
+            nLitsAll += Vec_IntEntry( vLits, Abc_Lit2Var(Mf_CutFunc(Mf_ObjCutBest(p, Id))) );
+        }
+    for ( i = 0; i < nProcs; i++ )
+    {
+        pSlices[i].p       = p;
+        pSlices[i].pCnf    = pCnf;
+        pSlices[i].vCnfs   = vCnfs;
+        pSlices[i].vNodes  = vNodes;
+        pSlices[i].pCnfIds = pCnfIds;
+    }
+    // find the boundaries of the slices
+    pSlices[0].iCla = iCla;
+    pSlices[0].iLit = iLit;
+    Vec_PtrPush( vSlices, pSlices );
+    Vec_IntForEachEntry( vNodes, Id, i )
+    {
+        if ( Vec_PtrSize(vSlices) < nProcs && nLits * nProcs >= nLitsAll * Vec_PtrSize(vSlices) )
+        {
+            pSlices[Vec_PtrSize(vSlices)-1].iStop = i;
+            pSlices[Vec_PtrSize(vSlices)].iStart  = i;
+            pSlices[Vec_PtrSize(vSlices)].iCla    = iCla;
+            pSlices[Vec_PtrSize(vSlices)].iLit    = iLit;
+            Vec_PtrPush( vSlices, pSlices + Vec_PtrSize(vSlices) );
+        }
+        iFunc = Abc_Lit2Var( Mf_CutFunc(Mf_ObjCutBest(p, Id)) );
+        iCla += Vec_IntEntry( &p->vCnfSizes, iFunc );
+        iLit += Vec_IntEntry( vLits, iFunc );
+        nLits += Vec_IntEntry( vLits, iFunc );
+    }
+    pSlices[Vec_PtrSize(vSlices)-1].iStop = Vec_IntSize(vNodes);
+    Util_ProcessThreads( Mf_ManDeriveCnfSlice, vSlices, nProcs + 1, 0, 0 );
+    *piCla = iCla, *piLit = iLit;
+    Vec_IntFree( vNodes );
+    Vec_PtrFree( vSlices );
+    ABC_FREE( pSlices );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Derives CNF for the AIG using the mapping.]
@@ -339,10 +475,10 @@ Cnf_Dat_t * Mf_ManDeriveCnf( Mf_Man_t * p, int fCnfObjIds, int fAddOrCla )
     Cnf_Dat_t * pCnf; 
     Gia_Obj_t * pObj;
     int Id, DriId, nVars, nClas, nLits, iVar = 1, iCla = 0, iLit = 0;
-    Vec_Int_t * vCnfs = Mf_ManDeriveCnfs( p, &nVars, &nClas, &nLits );
+    Vec_Int_t * vLits = NULL, * vCnfs = Mf_ManDeriveCnfs( p, &nVars, &nClas, &nLits, &vLits );
     Vec_Int_t * vCnfIds = Vec_IntStartFull( Gia_ManObjNum(p->pGia) );
-    int pFanins[16], * pCut, * pCnfIds = Vec_IntArray( vCnfIds );
-    int i, k, c, iFunc, nCubes, * pCubes, fComplLast;
+    int * pCut, * pCnfIds = Vec_IntArray( vCnfIds );
+    int i, k, iFunc;
     nVars++;  // zero-ID to remain unused
     if ( fAddOrCla )
     {
@@ -415,62 +551,49 @@ Cnf_Dat_t * Mf_ManDeriveCnf( Mf_Man_t * p, int fCnfObjIds, int fAddOrCla )
         }
     }
     // add clauses for the mapping
-    Gia_ManForEachAndReverseId( p->pGia, Id )
+    if ( p->pPars->nProcNum > 1 && pCnf->vMapping == NULL && Gia_ManAndNum(p->pGia) >= 1000 * p->pPars->nProcNum )
+        Mf_ManDeriveCnfPar( p, pCnf, vCnfs, vLits, pCnfIds, &iCla, &iLit );
+    else
     {
-        if ( !Mf_ObjMapRefNum(p, Id) )
-            continue;
-        pCut = Mf_ObjCutBest( p, Id );
-        iFunc = Abc_Lit2Var( Mf_CutFunc(pCut) );
-        fComplLast = Abc_LitIsCompl( Mf_CutFunc(pCut) );
-        if ( iFunc == 0 ) // constant cut
-        {
-            pCnf->pClauses[iCla++] = pCnf->pClauses[0] + iLit;
-            pCnf->pClauses[0][iLit++] = Abc_Var2Lit(pCnfIds[Id], !fComplLast);
-            assert( pCnf->vMapping == NULL ); // bug fix does not handle generated mapping
-            continue;
-        }
-        for ( k = 0; k < Mf_CutSize(pCut); k++ )
-            pFanins[k] = pCnfIds[pCut[k+1]];
-        pFanins[k++] = pCnfIds[Id];
-        // get clauses
-        pCubes = Vec_IntEntryP( vCnfs, Vec_IntEntry(vCnfs, iFunc) );
-        nCubes = *pCubes++;
-        for ( c = 0; c < nCubes; c++ )
-        {
-            pCnf->pClauses[iCla++] = pCnf->pClauses[0] + iLit;
-            k = Mf_CutSize(pCut);
-            assert( Mf_CubeLit(pCubes[c], k) );
-            pCnf->pClauses[0][iLit++] = Abc_Var2Lit( pFanins[k], (Mf_CubeLit(pCubes[c], k) == 2) ^ fComplLast );
-            for ( k = 0; k < Mf_CutSize(pCut); k++ )
-                if ( Mf_CubeLit(pCubes[c], k) )
-                    pCnf->pClauses[0][iLit++] = Abc_Var2Lit( pFanins[k], Mf_CubeLit(pCubes[c], k) == 2 );
-        }
-        // generate mapping
-        if ( pCnf->vMapping )
+        Gia_ManForEachAndReverseId( p->pGia, Id )
         {
-            word pTruth[4], * pTruthP = Vec_MemReadEntry(p->vTtMem, iFunc);
-            assert( p->pPars->nLutSize <= 8 );
-            Abc_TtCopy( pTruth, pTruthP, Abc_Truth6WordNum(p->pPars->nLutSize), Abc_LitIsCompl(iFunc) );
-            assert( pCnfIds[Id] >= 0 && pCnfIds[Id] < nVars );
-            Vec_IntWriteEntry( pCnf->vMapping, pCnfIds[Id], Vec_IntSize(pCnf->vMapping) );
-            Vec_IntPush( pCnf->vMapping, Mf_CutSize(pCut) );
-            for ( k = 0; k < Mf_CutSize(pCut); k++ )
-                Vec_IntPush( pCnf->vMapping, pCnfIds[pCut[k+1]] );
-            Vec_IntPush( pCnf->vMapping, (unsigned)pTruth[0] );
-            if ( Mf_CutSize(pCut) >= 6 )
+            if ( !Mf_ObjMapRefNum(p, Id) )
+                continue;
+            pCut = Mf_ObjCutBest( p, Id );
+            iFunc = Abc_Lit2Var( Mf_CutFunc(pCut) );
+            Mf_ManDeriveCnfNode( p, pCnf, vCnfs, pCnfIds, Id, &iCla, &iLit );
+            if ( iFunc == 0 ) // constant cut
             {
-                Vec_IntPush( pCnf->vMapping, (unsigned)(pTruth[0] >> 32) );
-                if ( Mf_CutSize(pCut) >= 7 )
-                {
-                    Vec_IntPush( pCnf->vMapping, (unsigned)(pTruth[1]) );
-                    Vec_IntPush( pCnf->vMapping, (unsigned)(pTruth[1] >> 32) );
-                }
-                if ( Mf_CutSize(pCut) >= 8 )
+                assert( pCnf->vMapping == NULL ); // bug fix does not handle generated mapping
+                continue;
+            }
+            // generate mapping
+            if ( pCnf->vMapping )
+            {
+                word pTruth[4], * pTruthP = Vec_MemReadEntry(p->vTtMem, iFunc);
+                assert( p->pPars->nLutSize <= 8 );
+                Abc_TtCopy( pTruth, pTruthP, Abc_Truth6WordNum(p->pPars->nLutSize), Abc_LitIsCompl(iFunc) );
+                assert( pCnfIds[Id] >= 0 && pCnfIds[Id] < nVars );
+                Vec_IntWriteEntry( pCnf->vMapping, pCnfIds[Id], Vec_IntSize(pCnf->vMapping) );
+                Vec_IntPush( pCnf->vMapping, Mf_CutSize(pCut) );
+                for ( k = 0; k < Mf_CutSize(pCut); k++ )
+                    Vec_IntPush( pCnf->vMapping, pCnfIds[pCut[k+1]] );
+                Vec_IntPush( pCnf->vMapping, (unsigned)pTruth[0] );
+                if ( Mf_CutSize(pCut) >= 6 )
                 {
-                    Vec_IntPush( pCnf->vMapping, (unsigned)(pTruth[2]) );
-                    Vec_IntPush( pCnf->vMapping, (unsigned)(pTruth[2] >> 32) );
-                    Vec_IntPush( pCnf->vMapping, (unsigned)(pTruth[3]) );
-                    Vec_IntPush( pCnf->vMapping, (unsigned)(pTruth[3] >> 32) );
+                    Vec_IntPush( pCnf->vMapping, (unsigned)(pTruth[0] >> 32) );
+                    if ( Mf_CutSize(pCut) >= 7 )
+                    {
+                        Vec_IntPush( pCnf->vMapping, (unsigned)(pTruth[1]) );
+                        Vec_IntPush( pCnf->vMapping, (unsigned)(pTruth[1] >> 32) );
+                    }
+                    if ( Mf_CutSize(pCut) >= 8 )
+                    {
+                        Vec_IntPush( pCnf->vMapping, (unsigned)(pTruth[2]) );
+                        Vec_IntPush( pCnf->vMapping, (unsigned)(pTruth[2] >> 32) );
+                        Vec_IntPush( pCnf->vMapping, (unsigned)(pTruth[3]) );
+                        Vec_IntPush( pCnf->vMapping, (unsigned)(pTruth[3] >> 32) );
+                    }
                 }
             }
         }
@@ -484,6 +607,7 @@ Cnf_Dat_t * Mf_ManDeriveCnf( Mf_Man_t * p, int fCnfObjIds, int fAddOrCla )
     pCnf->pClauses[iCla++] = pCnf->pClauses[0] + iLit;
     // cleanup
     Vec_IntFree( vCnfs );
+    Vec_IntFree( vLits );
     // create mapping of objects into their clauses
     if ( fCnfObjIds )
     {
@@ -1874,7 +1998,7 @@ Gia_Man_t * Mf_ManPerformMapping( Gia_Man_t * pGia, Jf_Par_t * pPars )
   SeeAlso     []
 
 ***********************************************************************/
-void * Mf_ManGenerateCnf( Gia_Man_t * pGia, int nLutSize, int fCnfObjIds, int fAddOrCla, int fMapping, int fVerbose )
+void * Mf_ManGenerateCnfPar( Gia_Man_t * pGia, int nLutSize, int fCnfObjIds, int fAddOrCla, int fMapping, int nProcs, int fVerbose )
 {
     Gia_Man_t * pNew;
     Jf_Par_t Pars, * pPars = &Pars;
@@ -1886,17 +2010,22 @@ void * Mf_ManGenerateCnf( Gia_Man_t * pGia, int nLutSize, int fCnfObjIds, int fA
     pPars->fCnfObjIds  = fCnfObjIds;
     pPars->fAddOrCla   = fAddOrCla;
     pPars->fCnfMapping = fMapping;
+    pPars->nProcNum    = nProcs;
     pPars->fVerbose    = fVerbose;
     pNew = Mf_ManPerformMapping( pGia, pPars );
     Gia_ManStopP( &pNew );
 //    Cnf_DataPrint( (Cnf_Dat_t *)pGia->pData, 1 );
     return pGia->pData;
 }
-void Mf_ManDumpCnf( Gia_Man_t * p, char * pFileName, int nLutSize, int fCnfObjIds, int fAddOrCla, int fVerbose )
+void * Mf_ManGenerateCnf( Gia_Man_t * pGia, int nLutSize, int fCnfObjIds, int fAddOrCla, int fMapping, int fVerbose )
+{
+    return Mf_ManGenerateCnfPar( pGia, nLutSize, fCnfObjIds, fAddOrCla, fMapping, 0, fVerbose );
+}
+void Mf_ManDumpCnf( Gia_Man_t * p, char * pFileName, int nLutSize, int fCnfObjIds, int fAddOrCla, int nProcs, int fVerbose )
 {
     abctime clk = Abc_Clock();
     Cnf_Dat_t * pCnf;
-    pCnf = (Cnf_Dat_t *)Mf_ManGenerateCnf( p, nLutSize, fCnfObjIds, fAddOrCla, 0, fVerbose );
+    pCnf = (Cnf_Dat_t *)Mf_ManGenerateCnfPar( p, nLutSize, fCnfObjIds, fAddOrCla, 0, nProcs, fVerbose );
     Cnf_DataWriteIntoFile( pCnf, pFileName, 0, NULL, NULL );
 //    if ( fVerbose )
     {
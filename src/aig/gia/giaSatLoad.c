@@ -0,0 +1,459 @@
+/**CFile****************************************************************
+
+  FileName    [giaSatLoad.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Lazy loading of logic cones into incremental SAT solvers.]
+
+  Author      []
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 19, 2026.]
+
+  Revision    [$Id: giaSatLoad.c,v 1.00 2026/10/19 00:00:00 Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+#include "sat/satoko/satoko.h"
+#include "sat/glucose2/AbcGlucose2.h"
+#include "sat/cadical/cadicalSolver.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the SAT solver with the logic cones loaded on demand
+struct Gia_SatLoad_t_
+{
+    Gia_Man_t *      pGia;          // the AIG whose cones are loaded
+    int              SolverType;    // the solver type (GIA_SAT_SATOKO, etc)
+    void *           pSat;          // the SAT solver
+    int              fUnsat;        // the clauses are unsatisfiable
+    Vec_Int_t        vObj2Var;      // maps AIG objects into SAT variables (-1 if not loaded)
+    Vec_Int_t        vVar2Obj;      // maps SAT variables into AIG objects
+    Vec_Int_t        vStack;        // the nodes to be loaded
+    Vec_Int_t        vLits;         // the assumptions
+    // statistics
+    int              nClauses;      // the clauses added since the last recycling
+    int              nLoadedAll;    // the objects loaded since the start
+    int              nRecycles;     // the number of recyclings
+    int              nCalls;        // the number of SAT calls
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Interface with the SAT solvers.]
+
+  Description [The solvers use the same representation of literals.
+  Solving returns 1 if satisfiable, -1 if unsatisfiable, and 0 if
+  undecided.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * Gia_SatLoadSolverStart( int SolverType )
+{
+    if ( SolverType == GIA_SAT_SATOKO )
+        return satoko_create();
+    if ( SolverType == GIA_SAT_GLUCOSE2 )
+        return bmcg2_sat_solver_start();
+    if ( SolverType == GIA_SAT_CADICAL )
+        return cadical_solver_new();
+    assert( 0 );
+    return NULL;
+}
+static void Gia_SatLoadSolverStop( int SolverType, void * pSat )
+{
+    if ( SolverType == GIA_SAT_SATOKO )
+        satoko_destroy( (satoko_t *)pSat );
+    else if ( SolverType == GIA_SAT_GLUCOSE2 )
+        bmcg2_sat_solver_stop( (bmcg2_sat_solver *)pSat );
+    else if ( SolverType == GIA_SAT_CADICAL )
+        cadical_solver_delete( (cadical_solver *)pSat );
+    else assert( 0 );
+}
+static inline int Gia_SatLoadSolverAddVar( Gia_SatLoad_t * p )
+{
+    if ( p->SolverType == GIA_SAT_SATOKO )
+        return satoko_add_variable( (satoko_t *)p->pSat, 0 );
+    if ( p->SolverType == GIA_SAT_GLUCOSE2 )
+        return bmcg2_sat_solver_addvar( (bmcg2_sat_solver *)p->pSat );
+    return cadical_solver_addvar( (cadical_solver *)p->pSat );
+}
+static inline void Gia_SatLoadSolverAddClause( Gia_SatLoad_t * p, int * pLits, int nLits )
+{
+    int RetValue;
+    if ( p->SolverType == GIA_SAT_SATOKO )
+        RetValue = satoko_add_clause( (satoko_t *)p->pSat, pLits, nLits );
+    else if ( p->SolverType == GIA_SAT_GLUCOSE2 )
+        RetValue = bmcg2_sat_solver_addclause( (bmcg2_sat_solver *)p->pSat, pLits, nLits );
+    else
+        RetValue = cadical_solver_addclause( (cadical_solver *)p->pSat, pLits, pLits + nLits );
+    if ( !RetValue )
+        p->fUnsat = 1;
+    p->nClauses++;
+}
+static inline int Gia_SatLoadSolverSolve( Gia_SatLoad_t * p, int * pLits, int nLits, int nConfLimit )
+{
+    if ( p->SolverType == GIA_SAT_SATOKO )
+        return satoko_solve_assumptions_limit( (satoko_t *)p->pSat, pLits, nLits, nConfLimit );
+    if ( p->SolverType == GIA_SAT_GLUCOSE2 )
+    {
+        bmcg2_sat_solver_set_conflict_budget( (bmcg2_sat_solver *)p->pSat, nConfLimit );
+        return bmcg2_sat_solver_solve( (bmcg2_sat_solver *)p->pSat, pLits, nLits );
+    }
+    return cadical_solver_solve( (cadical_solver *)p->pSat, pLits, pLits + nLits, nConfLimit, 0, 0, 0 );
+}
+static inline int Gia_SatLoadSolverValue( Gia_SatLoad_t * p, int iVar )
+{
+    if ( p->SolverType == GIA_SAT_SATOKO )
+        return satoko_read_cex_varvalue( (satoko_t *)p->pSat, iVar );
+    if ( p->SolverType == GIA_SAT_GLUCOSE2 )
+        return bmcg2_sat_solver_read_cex_varvalue( (bmcg2_sat_solver *)p->pSat, iVar );
+    return cadical_solver_get_var_value( (cadical_solver *)p->pSat, iVar );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the loader.]
+
+  Description [Creates the SAT solver of the given type. The solver is
+  empty until the cones are loaded.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_SatLoad_t * Gia_SatLoadStart( Gia_Man_t * pGia, int SolverType )
+{
+    Gia_SatLoad_t * p = ABC_CALLOC( Gia_SatLoad_t, 1 );
+    p->pGia       = pGia;
+    p->SolverType = SolverType;
+    p->pSat       = Gia_SatLoadSolverStart( SolverType );
+    Vec_IntFill( &p->vObj2Var, Gia_ManObjNum(pGia), -1 );
+    Vec_IntGrow( &p->vVar2Obj, 1000 );
+    Vec_IntGrow( &p->vStack, 1000 );
+    return p;
+}
+void Gia_SatLoadStop( Gia_SatLoad_t * p )
+{
+    Gia_SatLoadSolverStop( p->SolverType, p->pSat );
+    Vec_IntErase( &p->vObj2Var );
+    Vec_IntErase( &p->vVar2Obj );
+    Vec_IntErase( &p->vStack );
+    Vec_IntErase( &p->vLits );
+    ABC_FREE( p );
+}
+void * Gia_SatLoadSolver( Gia_SatLoad_t * p )
+{
+    return p->pSat;
+}
+int Gia_SatLoadVarNum( Gia_SatLoad_t * p )
+{
+    return Vec_IntSize(&p->vVar2Obj);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Replaces the SAT solver by an empty one.]
+
+  Description [Only the objects loaded into the old solver are visited,
+  so recycling does not depend on the size of the AIG. The cones are
+  loaded again when they are used by the following queries.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_SatLoadRecycle( Gia_SatLoad_t * p )
+{
+    int i, iObj;
+    Vec_IntForEachEntry( &p->vVar2Obj, iObj, i )
+        Vec_IntWriteEntry( &p->vObj2Var, iObj, -1 );
+    Vec_IntClear( &p->vVar2Obj );
+    Gia_SatLoadSolverStop( p->SolverType, p->pSat );
+    p->pSat     = Gia_SatLoadSolverStart( p->SolverType );
+    p->fUnsat   = 0;
+    p->nClauses = 0;
+    p->nRecycles++;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the clauses of one object whose fanins are loaded.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_SatLoadFaninLit( Gia_SatLoad_t * p, int iLit )
+{
+    int iVar = Vec_IntEntry( &p->vObj2Var, Abc_Lit2Var(iLit) );
+    assert( iVar >= 0 );
+    return Abc_Var2Lit( iVar, Abc_LitIsCompl(iLit) );
+}
+static int Gia_SatLoadAddObj( Gia_SatLoad_t * p, int iObj )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p->pGia, iObj );
+    int iVar = Gia_SatLoadSolverAddVar( p );
+    int Lit  = Abc_Var2Lit( iVar, 0 );
+    int pLits[3], Lit0, Lit1, LitC;
+    assert( iVar == Vec_IntSize(&p->vVar2Obj) );
+    Vec_IntWriteEntry( &p->vObj2Var, iObj, iVar );
+    Vec_IntPush( &p->vVar2Obj, iObj );
+    p->nLoadedAll++;
+    if ( iObj == 0 )
+    {
+        pLits[0] = Abc_LitNot(Lit);
+        Gia_SatLoadSolverAddClause( p, pLits, 1 );
+        return iVar;
+    }
+    if ( Gia_ObjIsCi(pObj) )
+        return iVar;
+    assert( Gia_ObjIsAnd(pObj) );
+    Lit0 = Gia_SatLoadFaninLit( p, Gia_ObjFaninLit0(pObj, iObj) );
+    Lit1 = Gia_SatLoadFaninLit( p, Gia_ObjFaninLit1(pObj, iObj) );
+    if ( Gia_ObjIsMuxId(p->pGia, iObj) ) // Lit = LitC ? Lit1 : Lit0
+    {
+        LitC = Gia_SatLoadFaninLit( p, Gia_ObjFaninLit2(p->pGia, iObj) );
+        pLits[0] = Abc_LitNot(LitC); pLits[1] = Abc_LitNot(Lit1); pLits[2] = Lit;
+        Gia_SatLoadSolverAddClause( p, pLits, 3 );
+        pLits[0] = Abc_LitNot(LitC); pLits[1] = Lit1; pLits[2] = Abc_LitNot(Lit);
+        Gia_SatLoadSolverAddClause( p, pLits, 3 );
+        pLits[0] = LitC; pLits[1] = Abc_LitNot(Lit0); pLits[2] = Lit;
+        Gia_SatLoadSolverAddClause( p, pLits, 3 );
+        pLits[0] = LitC; pLits[1] = Lit0; pLits[2] = Abc_LitNot(Lit);
+        Gia_SatLoadSolverAddClause( p, pLits, 3 );
+    }
+    else if ( Gia_ObjIsXor(pObj) ) // Lit = Lit0 ^ Lit1
+    {
+        pLits[0] = Abc_LitNot(Lit0); pLits[1] = Abc_LitNot(Lit1); pLits[2] = Abc_LitNot(Lit);
+        Gia_SatLoadSolverAddClause( p, pLits, 3 );
+        pLits[0] = Lit0; pLits[1] = Lit1; pLits[2] = Abc_LitNot(Lit);
+        Gia_SatLoadSolverAddClause( p, pLits, 3 );
+        pLits[0] = Abc_LitNot(Lit0); pLits[1] = Lit1; pLits[2] = Lit;
+        Gia_SatLoadSolverAddClause( p, pLits, 3 );
+        pLits[0] = Lit0; pLits[1] = Abc_LitNot(Lit1); pLits[2] = Lit;
+        Gia_SatLoadSolverAddClause( p, pLits, 3 );
+    }
+    else if ( Lit0 == Lit1 ) // buffer
+    {
+        pLits[0] = Abc_LitNot(Lit0); pLits[1] = Lit;
+        Gia_SatLoadSolverAddClause( p, pLits, 2 );
+        pLits[0] = Lit0; pLits[1] = Abc_LitNot(Lit);
+        Gia_SatLoadSolverAddClause( p, pLits, 2 );
+    }
+    else // Lit = Lit0 & Lit1
+    {
+        pLits[0] = Lit0; pLits[1] = Abc_LitNot(Lit);
+        Gia_SatLoadSolverAddClause( p, pLits, 2 );
+        pLits[0] = Lit1; pLits[1] = Abc_LitNot(Lit);
+        Gia_SatLoadSolverAddClause( p, pLits, 2 );
+        pLits[0] = Abc_LitNot(Lit0); pLits[1] = Abc_LitNot(Lit1); pLits[2] = Lit;
+        Gia_SatLoadSolverAddClause( p, pLits, 3 );
+    }
+    return iVar;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the SAT literal of the object.]
+
+  Description [Loads the part of the cone of the object, which is not yet
+  in the SAT solver. The cone is traversed without recursion, so that
+  deep AIGs can be loaded. For a combinational output, returns the
+  literal of its driver, complemented if the output is complemented.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_SatLoadObj( Gia_SatLoad_t * p, int iObj )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p->pGia, iObj );
+    int iCur, fReady, fCompl = 0;
+    if ( Gia_ObjIsCo(pObj) )
+    {
+        fCompl = Gia_ObjFaninC0(pObj);
+        iObj = Gia_ObjFaninId0p( p->pGia, pObj );
+    }
+    if ( Vec_IntEntry(&p->vObj2Var, iObj) >= 0 )
+        return Abc_Var2Lit( Vec_IntEntry(&p->vObj2Var, iObj), fCompl );
+    Vec_IntClear( &p->vStack );
+    Vec_IntPush( &p->vStack, iObj );
+    while ( Vec_IntSize(&p->vStack) )
+    {
+        iCur = Vec_IntEntryLast( &p->vStack );
+        if ( Vec_IntEntry(&p->vObj2Var, iCur) >= 0 )
+        {
+            Vec_IntPop( &p->vStack );
+            continue;
+        }
+        pObj = Gia_ManObj( p->pGia, iCur );
+        fReady = 1;
+        if ( Gia_ObjIsAnd(pObj) )
+        {
+            if ( Vec_IntEntry(&p->vObj2Var, Gia_ObjFaninId0(pObj, iCur)) < 0 )
+                Vec_IntPush( &p->vStack, Gia_ObjFaninId0(pObj, iCur) ), fReady = 0;
+            if ( Vec_IntEntry(&p->vObj2Var, Gia_ObjFaninId1(pObj, iCur)) < 0 )
+                Vec_IntPush( &p->vStack, Gia_ObjFaninId1(pObj, iCur) ), fReady = 0;
+            if ( Gia_ObjIsMuxId(p->pGia, iCur) && Vec_IntEntry(&p->vObj2Var, Gia_ObjFaninId2(p->pGia, iCur)) < 0 )
+                Vec_IntPush( &p->vStack, Gia_ObjFaninId2(p->pGia, iCur) ), fReady = 0;
+        }
+        if ( !fReady )
+            continue;
+        Vec_IntPop( &p->vStack );
+        Gia_SatLoadAddObj( p, iCur );
+    }
+    return Abc_Var2Lit( Vec_IntEntry(&p->vObj2Var, iObj), fCompl );
+}
+int Gia_SatLoadLit( Gia_SatLoad_t * p, int iLit )
+{
+    return Abc_LitNotCond( Gia_SatLoadObj(p, Abc_Lit2Var(iLit)), Abc_LitIsCompl(iLit) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the problem under the given assumptions.]
+
+  Description [The assumptions are literals of the AIG. Their cones
+  are loaded if needed. Returns 1 if satisfiable, -1 if unsatisfiable,
+  and 0 if the conflict limit (0 = no limit) is reached.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_SatLoadSolve( Gia_SatLoad_t * p, int * pLits, int nLits, int nConfLimit )
+{
+    int i;
+    Vec_IntClear( &p->vLits );
+    for ( i = 0; i < nLits; i++ )
+        Vec_IntPush( &p->vLits, Gia_SatLoadLit(p, pLits[i]) );
+    p->nCalls++;
+    if ( p->fUnsat )
+        return -1;
+    return Gia_SatLoadSolverSolve( p, Vec_IntArray(&p->vLits), Vec_IntSize(&p->vLits), nConfLimit );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the value of the object in the satisfying assignment.]
+
+  Description [Returns -1 if the object is not loaded. For a combinational
+  output, returns the value of its driver, complemented if the output
+  is complemented.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_SatLoadObjValue( Gia_SatLoad_t * p, int iObj )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p->pGia, iObj );
+    int iVar, fCompl = 0;
+    if ( Gia_ObjIsCo(pObj) )
+    {
+        fCompl = Gia_ObjFaninC0(pObj);
+        iObj = Gia_ObjFaninId0p( p->pGia, pObj );
+    }
+    iVar = Vec_IntEntry( &p->vObj2Var, iObj );
+    return iVar >= 0 ? Gia_SatLoadSolverValue(p, iVar) ^ fCompl : -1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints statistics of the loader.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_SatLoadPrintStats( Gia_SatLoad_t * p )
+{
+    char * pNames[3] = { "satoko", "glucose2", "cadical" };
+    printf( "Solver = %s.  Calls = %d.  Recycles = %d.  Vars = %d.  Clauses = %d.  Loaded = %d (%.2f %% of objects).\n",
+        pNames[p->SolverType], p->nCalls, p->nRecycles, Vec_IntSize(&p->vVar2Obj), p->nClauses,
+        p->nLoadedAll, 100.0 * p->nLoadedAll / Abc_MaxInt(1, Gia_ManCandNum(p->pGia)) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the outputs one at a time in the same solver.]
+
+  Description [The cone of each output is loaded when the output is
+  solved, so the logic shared with the previous outputs is reused.
+  The solver is recycled when the number of variables exceeds the limit
+  (0 = no limit). Returns the number of outputs proved unsatisfiable.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_SatLoadSolveOutputs( Gia_Man_t * p, int SolverType, int nConfLimit, int nVarsMax, int fVerbose )
+{
+    abctime clk, clkTotal = Abc_Clock();
+    Gia_SatLoad_t * pLoad = Gia_SatLoadStart( p, SolverType );
+    Gia_Obj_t * pObj;
+    int i, iLit, status, nUnsat = 0, nSat = 0, nUndec = 0;
+    Gia_ManForEachCo( p, pObj, i )
+    {
+        clk = Abc_Clock();
+        if ( nVarsMax && Gia_SatLoadVarNum(pLoad) > nVarsMax )
+            Gia_SatLoadRecycle( pLoad );
+        iLit = Gia_ObjFaninLit0p( p, pObj );
+        if ( iLit == 0 )
+            status = -1;
+        else if ( iLit == 1 )
+            status = 1;
+        else
+            status = Gia_SatLoadSolve( pLoad, &iLit, 1, nConfLimit );
+        nUnsat += (status == -1);
+        nSat   += (status ==  1);
+        nUndec += (status ==  0);
+        if ( !fVerbose )
+            continue;
+        printf( "Output %6d : %-12s  Vars = %8d.  ", i, status == 1 ? "SATISFIABLE" : status == -1 ? "UNSATISFIABLE" : "UNDECIDED", Gia_SatLoadVarNum(pLoad) );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    printf( "Outputs = %d.  UNSAT = %d.  SAT = %d.  UNDEC = %d.  ", Gia_ManCoNum(p), nUnsat, nSat, nUndec );
+    Abc_PrintTime( 1, "Time", Abc_Clock() - clkTotal );
+    if ( fVerbose )
+        Gia_SatLoadPrintStats( pLoad );
+    Gia_SatLoadStop( pLoad );
+    return nUnsat;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
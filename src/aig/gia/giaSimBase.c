@@ -126,8 +126,11 @@ Vec_Wrd_t * Gia_ManSimPatSim( Gia_Man_t * pGia )
 {
     Gia_Obj_t * pObj;
     int i, nWords = Vec_WrdSize(pGia->vSimsPi) / Gia_ManCiNum(pGia);
-    Vec_Wrd_t * vSims = Vec_WrdStart( Gia_ManObjNum(pGia) * nWords );
+    Vec_Wrd_t * vSims = Vec_WrdAlloc( Gia_ManObjNum(pGia) * nWords );
     assert( Vec_WrdSize(pGia->vSimsPi) % Gia_ManCiNum(pGia) == 0 );
+    // huge pages should be requested before the array is touched
+    Util_HugeAdvise( Vec_WrdArray(vSims), sizeof(word) * (size_t)Gia_ManObjNum(pGia) * nWords );
+    Vec_WrdFill( vSims, Gia_ManObjNum(pGia) * nWords, 0 );
     Gia_ManSimPatAssignInputs( pGia, nWords, vSims, pGia->vSimsPi );
     Gia_ManForEachAnd( pGia, pObj, i ) 
         Gia_ManSimPatSimAnd( pGia, i, pObj, nWords, vSims );
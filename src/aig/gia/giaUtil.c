@@ -781,7 +781,10 @@ void Gia_ManCreateRefs( Gia_Man_t * p )
     Gia_Obj_t * pObj;
     int i;
     assert( p->pRefs == NULL );
-    p->pRefs = ABC_CALLOC( int, Gia_ManObjNum(p) );
+    p->pRefs = ABC_ALLOC( int, Gia_ManObjNum(p) );
+    // huge pages should be requested before the array is touched
+    Util_HugeAdvise( p->pRefs, sizeof(int) * (size_t)Gia_ManObjNum(p) );
+    memset( p->pRefs, 0, sizeof(int) * (size_t)Gia_ManObjNum(p) );
     Gia_ManForEachObj( p, pObj, i )
     {
         if ( Gia_ObjIsAnd(pObj) )
@@ -0,0 +1,425 @@
+/**CFile****************************************************************
+
+  FileName    [giaXsim.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Bit-parallel dual-rail ternary simulation.]
+
+  Author      []
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 19, 2026.]
+
+  Revision    [$Id: giaXsim.c,v 1.00 2026/10/19 00:00:00 Exp $]
+
+***********************************************************************/
+
+#include "gia.h"
+#include "misc/util/utilTruth.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// Each object of the cone has two rails of simulation info with one bit
+// per pattern: rail 0 is set when the value is 0, rail 1 is set when the
+// value is 1, and the ternary value X has both rails equal to 0.
+// The cone is given by its CIs, internal nodes in a topological order,
+// and COs. Only the cone objects have simulation info, which is stored
+// in the order of slots: constant 0, CIs, nodes, COs. The number of words
+// per rail can be changed between the rounds of simulation; in this case,
+// the CI values should be assigned again.
+
+struct Gia_XsimMan_t_
+{
+    Gia_Man_t *    pGia;         // user's AIG
+    int            nWordsMax;    // the largest number of words per rail
+    int            nWords;       // the number of words per rail in this round
+    Vec_Int_t *    vSlots;       // slot of each object in the cone (or -1)
+    Vec_Int_t *    vCis;         // cone CIs (object IDs)
+    Vec_Int_t *    vNodes;       // cone nodes (object IDs)
+    Vec_Int_t *    vCos;         // cone COs (object IDs)
+    Vec_Int_t *    vFanins;      // fanin literals of nodes and COs in terms of slots
+    Vec_Int_t *    vCiVals;      // binary values of the CIs
+    Vec_Int_t *    vCands;       // candidates remaining after the first phase
+    word *         pSims;        // simulation info
+    int            nSimsAlloc;   // the number of words allocated
+    word *         pMask;        // patterns with X-valued COs
+};
+
+static inline word * Gia_XsimRail( Gia_XsimMan_t * p, int iSlot, int fRail ) { return p->pSims + (2 * iSlot + fRail) * p->nWords; }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the simulation manager.]
+
+  Description [The manager simulates up to 64 * nWordsMax patterns
+  at the same time.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_XsimMan_t * Gia_XsimManStart( Gia_Man_t * pGia, int nWordsMax )
+{
+    Gia_XsimMan_t * p;
+    assert( nWordsMax > 0 );
+    p = ABC_CALLOC( Gia_XsimMan_t, 1 );
+    p->pGia      = pGia;
+    p->nWordsMax = nWordsMax;
+    p->nWords    = nWordsMax;
+    p->vSlots    = Vec_IntStartFull( Gia_ManObjNum(pGia) );
+    p->vCis      = Vec_IntAlloc( 100 );
+    p->vNodes    = Vec_IntAlloc( 100 );
+    p->vCos      = Vec_IntAlloc( 100 );
+    p->vFanins   = Vec_IntAlloc( 100 );
+    p->vCiVals   = Vec_IntAlloc( 100 );
+    p->vCands    = Vec_IntAlloc( 100 );
+    p->pMask     = ABC_CALLOC( word, nWordsMax );
+    return p;
+}
+void Gia_XsimManStop( Gia_XsimMan_t * p )
+{
+    Vec_IntFree( p->vSlots );
+    Vec_IntFree( p->vCis );
+    Vec_IntFree( p->vNodes );
+    Vec_IntFree( p->vCos );
+    Vec_IntFree( p->vFanins );
+    Vec_IntFree( p->vCiVals );
+    Vec_IntFree( p->vCands );
+    ABC_FREE( p->pSims );
+    ABC_FREE( p->pMask );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Sets the number of words per rail.]
+
+  Description [Assigns the constant. The CI values should be assigned
+  after calling this procedure.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_XsimManSetWords( Gia_XsimMan_t * p, int nWords )
+{
+    assert( nWords > 0 && nWords <= p->nWordsMax );
+    p->nWords = nWords;
+    memset( Gia_XsimRail(p, 0, 0), 0xFF, sizeof(word) * nWords );
+    memset( Gia_XsimRail(p, 0, 1), 0x00, sizeof(word) * nWords );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Sets the cone to be simulated.]
+
+  Description [The CIs and the COs are given by their object IDs.
+  The nodes are in a topological order and include all internal nodes
+  between the CIs and the COs.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_XsimManFaninLit( Gia_XsimMan_t * p, int iObj, int fCompl )
+{
+    int iSlot = Vec_IntEntry( p->vSlots, iObj );
+    assert( iSlot >= 0 );
+    return Abc_Var2Lit( iSlot, fCompl );
+}
+void Gia_XsimManSetCone( Gia_XsimMan_t * p, Vec_Int_t * vCis, Vec_Int_t * vNodes, Vec_Int_t * vCos )
+{
+    Gia_Obj_t * pObj;
+    int i, iObj, nSlots = 1;
+    // clean the previous cone
+    Vec_IntForEachEntry( p->vCis, iObj, i )
+        Vec_IntWriteEntry( p->vSlots, iObj, -1 );
+    Vec_IntForEachEntry( p->vNodes, iObj, i )
+        Vec_IntWriteEntry( p->vSlots, iObj, -1 );
+    Vec_IntForEachEntry( p->vCos, iObj, i )
+        Vec_IntWriteEntry( p->vSlots, iObj, -1 );
+    // assign slots
+    Vec_IntWriteEntry( p->vSlots, 0, 0 );
+    Vec_IntClear( p->vFanins );
+    Vec_IntClear( p->vCis );
+    Vec_IntForEachEntry( vCis, iObj, i )
+    {
+        assert( Gia_ObjIsCi(Gia_ManObj(p->pGia, iObj)) );
+        Vec_IntWriteEntry( p->vSlots, iObj, nSlots++ );
+        Vec_IntPush( p->vCis, iObj );
+    }
+    Vec_IntClear( p->vNodes );
+    Gia_ManForEachObjVec( vNodes, p->pGia, pObj, i )
+    {
+        assert( Gia_ObjIsAnd(pObj) );
+        Vec_IntPush( p->vFanins, Gia_XsimManFaninLit(p, Gia_ObjFaninId0p(p->pGia, pObj), Gia_ObjFaninC0(pObj)) );
+        Vec_IntPush( p->vFanins, Gia_XsimManFaninLit(p, Gia_ObjFaninId1p(p->pGia, pObj), Gia_ObjFaninC1(pObj)) );
+        Vec_IntWriteEntry( p->vSlots, Gia_ObjId(p->pGia, pObj), nSlots++ );
+        Vec_IntPush( p->vNodes, Gia_ObjId(p->pGia, pObj) );
+    }
+    Vec_IntClear( p->vCos );
+    Gia_ManForEachObjVec( vCos, p->pGia, pObj, i )
+    {
+        assert( Gia_ObjIsCo(pObj) );
+        Vec_IntPush( p->vFanins, Gia_XsimManFaninLit(p, Gia_ObjFaninId0p(p->pGia, pObj), Gia_ObjFaninC0(pObj)) );
+        Vec_IntWriteEntry( p->vSlots, Gia_ObjId(p->pGia, pObj), nSlots++ );
+        Vec_IntPush( p->vCos, Gia_ObjId(p->pGia, pObj) );
+    }
+    // allocate simulation info and set the constant
+    if ( p->nSimsAlloc < 2 * nSlots * p->nWordsMax )
+    {
+        p->nSimsAlloc = 2 * 2 * nSlots * p->nWordsMax;
+        p->pSims = ABC_REALLOC( word, p->pSims, p->nSimsAlloc );
+    }
+    Gia_XsimManSetWords( p, p->nWordsMax );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Assigns the CI values.]
+
+  Description [Value 0 or 1 is assigned to all patterns of the CI
+  while value X is assigned to the patterns selected by the mask.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Gia_XsimManSetCiSlot( Gia_XsimMan_t * p, int iSlot, int Value )
+{
+    word * pSim0 = Gia_XsimRail( p, iSlot, 0 );
+    word * pSim1 = Gia_XsimRail( p, iSlot, 1 );
+    int w;
+    assert( Value == 0 || Value == 1 );
+    for ( w = 0; w < p->nWords; w++ )
+    {
+        pSim0[w] = Value ? 0 : ~(word)0;
+        pSim1[w] = Value ? ~(word)0 : 0;
+    }
+}
+void Gia_XsimManSetCi( Gia_XsimMan_t * p, int iObj, int Value )
+{
+    Gia_XsimManSetCiSlot( p, Vec_IntEntry(p->vSlots, iObj), Value );
+}
+void Gia_XsimManSetCiX( Gia_XsimMan_t * p, int iObj, word * pMask )
+{
+    int iSlot = Vec_IntEntry( p->vSlots, iObj ), w;
+    word * pSim0 = Gia_XsimRail( p, iSlot, 0 );
+    word * pSim1 = Gia_XsimRail( p, iSlot, 1 );
+    assert( iSlot > 0 && iSlot <= Vec_IntSize(p->vCis) );
+    for ( w = 0; w < p->nWords; w++ )
+    {
+        pSim0[w] &= ~pMask[w];
+        pSim1[w] &= ~pMask[w];
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates the cone.]
+
+  Description [Returns the mask of patterns, in which at least one
+  of the COs is X-valued. The mask has p->nWords words.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+word * Gia_XsimManSimulate( Gia_XsimMan_t * p )
+{
+    // the rail of a fanin literal is found by complementing the literal
+    int * pFanins = Vec_IntArray( p->vFanins );
+    int i, w, nWords = p->nWords, iSlot = 1 + Vec_IntSize(p->vCis);
+    word * pSims = p->pSims, * pSim, * pA, * pB;
+    if ( nWords == 1 )
+    {
+        for ( i = 0; i < Vec_IntSize(p->vNodes); i++, iSlot++, pFanins += 2 )
+        {
+            pSims[2*iSlot+0] = pSims[pFanins[0]]   | pSims[pFanins[1]];
+            pSims[2*iSlot+1] = pSims[pFanins[0]^1] & pSims[pFanins[1]^1];
+        }
+        p->pMask[0] = 0;
+        for ( i = 0; i < Vec_IntSize(p->vCos); i++, iSlot++, pFanins++ )
+        {
+            pSims[2*iSlot+0] = pSims[pFanins[0]];
+            pSims[2*iSlot+1] = pSims[pFanins[0]^1];
+            p->pMask[0] |= ~(pSims[2*iSlot+0] | pSims[2*iSlot+1]);
+        }
+        return p->pMask;
+    }
+    for ( i = 0; i < Vec_IntSize(p->vNodes); i++, iSlot++, pFanins += 2 )
+    {
+        pSim = pSims + 2 * iSlot * nWords;
+        pA = pSims + pFanins[0] * nWords;
+        pB = pSims + pFanins[1] * nWords;
+        for ( w = 0; w < nWords; w++ )
+            pSim[w] = pA[w] | pB[w];
+        pSim += nWords;
+        pA = pSims + (pFanins[0] ^ 1) * nWords;
+        pB = pSims + (pFanins[1] ^ 1) * nWords;
+        for ( w = 0; w < nWords; w++ )
+            pSim[w] = pA[w] & pB[w];
+    }
+    memset( p->pMask, 0, sizeof(word) * nWords );
+    for ( i = 0; i < Vec_IntSize(p->vCos); i++, iSlot++, pFanins++ )
+    {
+        pSim = pSims + 2 * iSlot * nWords;
+        pA = pSims + pFanins[0] * nWords;
+        pB = pSims + (pFanins[0] ^ 1) * nWords;
+        for ( w = 0; w < nWords; w++ )
+        {
+            pSim[w] = pA[w];
+            pSim[w + nWords] = pB[w];
+            p->pMask[w] |= ~(pA[w] | pB[w]);
+        }
+    }
+    return p->pMask;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the ternary value of the object in the pattern.]
+
+  Description [The object should belong to the cone. Returns GIA_ZER,
+  GIA_ONE, or GIA_UND.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_XsimManValue( Gia_XsimMan_t * p, int iObj, int iPat )
+{
+    int iSlot = Vec_IntEntry( p->vSlots, iObj );
+    assert( iSlot >= 0 && iPat < 64 * p->nWords );
+    if ( Abc_TtGetBit(Gia_XsimRail(p, iSlot, 0), iPat) )
+        return GIA_ZER;
+    if ( Abc_TtGetBit(Gia_XsimRail(p, iSlot, 1), iPat) )
+        return GIA_ONE;
+    return GIA_UND;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Assigns the binary values to the CIs and X to the lifted CIs.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_XsimManLiftStart( Gia_XsimMan_t * p, int nPats, Vec_Int_t * vLifted )
+{
+    int i, iObj, Value;
+    Gia_XsimManSetWords( p, Abc_Bit6WordNum(nPats) );
+    Vec_IntForEachEntryTwo( p->vCis, p->vCiVals, iObj, Value, i )
+        Gia_XsimManSetCiSlot( p, 1 + i, Value );
+    Vec_IntForEachEntry( vLifted, iObj, i )
+    {
+        word * pSim0 = Gia_XsimRail( p, Vec_IntEntry(p->vSlots, iObj), 0 );
+        word * pSim1 = Gia_XsimRail( p, Vec_IntEntry(p->vSlots, iObj), 1 );
+        memset( pSim0, 0, sizeof(word) * p->nWords );
+        memset( pSim1, 0, sizeof(word) * p->nWords );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Lifts the CI assignment using ternary simulation.]
+
+  Description [Given the binary values of the CIs of the cone (vCiVals,
+  in the order of the CIs in Gia_XsimManSetCone), and the candidate CIs
+  (vCands, object IDs in the order of preference), finds the candidates
+  that can be made X-valued while all COs of the cone remain binary.
+  The result (vLifted) is the same as when the candidates are tried one
+  at a time in the given order, but many candidates are tried at once.
+  In the first phase, each pattern tries one candidate on its own;
+  because ternary simulation is monotone, the candidates failing alone
+  are never lifted. In the second phase, pattern i tries the remaining
+  candidates 0,1,...,i together and the first failing pattern gives the
+  next candidate to be skipped. Returns the number of lifted candidates.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_XsimManLift( Gia_XsimMan_t * p, Vec_Int_t * vCiVals, Vec_Int_t * vCands, Vec_Int_t * vLifted )
+{
+    word * pMask;
+    int nPatsMax = 64 * p->nWordsMax;
+    int i, k, iStart, nPats, iFail;
+    assert( Vec_IntSize(vCiVals) == Vec_IntSize(p->vCis) );
+    Vec_IntClear( vLifted );
+    Vec_IntClear( p->vCands );
+    Vec_IntClear( p->vCiVals );
+    Vec_IntAppend( p->vCiVals, vCiVals );
+    // the first phase: each candidate is tried alone
+    for ( iStart = 0; iStart < Vec_IntSize(vCands); iStart += nPats )
+    {
+        nPats = Abc_MinInt( nPatsMax, Vec_IntSize(vCands) - iStart );
+        Gia_XsimManLiftStart( p, nPats, vLifted );
+        for ( i = 0; i < nPats; i++ )
+        {
+            int iSlot = Vec_IntEntry( p->vSlots, Vec_IntEntry(vCands, iStart + i) );
+            assert( iSlot > 0 && iSlot <= Vec_IntSize(p->vCis) );
+            Abc_TtXorBit( Gia_XsimRail(p, iSlot, Vec_IntEntry(p->vCiVals, iSlot - 1)), i );
+        }
+        pMask = Gia_XsimManSimulate( p );
+        for ( i = 0; i < nPats; i++ )
+            if ( !Abc_TtGetBit(pMask, i) )
+                Vec_IntPush( p->vCands, Vec_IntEntry(vCands, iStart + i) );
+    }
+    // the second phase: the prefixes of the remaining candidates are tried
+    for ( iStart = 0; iStart < Vec_IntSize(p->vCands); )
+    {
+        nPats = Abc_MinInt( nPatsMax, Vec_IntSize(p->vCands) - iStart );
+        Gia_XsimManLiftStart( p, nPats, vLifted );
+        for ( i = 0; i < nPats; i++ )
+        {
+            int iSlot = Vec_IntEntry( p->vSlots, Vec_IntEntry(p->vCands, iStart + i) );
+            word * pSim = Gia_XsimRail( p, iSlot, Vec_IntEntry(p->vCiVals, iSlot - 1) );
+            // patterns i, i+1, ..., nPats-1 have this candidate X-valued
+            pSim[i >> 6] &= (((word)1) << (i & 63)) - 1;
+            for ( k = (i >> 6) + 1; k < p->nWords; k++ )
+                pSim[k] = 0;
+        }
+        pMask = Gia_XsimManSimulate( p );
+        // mask out unused patterns in the last word
+        if ( nPats & 63 )
+            pMask[p->nWords-1] &= (((word)1) << (nPats & 63)) - 1;
+        iFail = Abc_TtFindFirstBit2( pMask, p->nWords );
+        for ( i = 0; i < (iFail == -1 ? nPats : iFail); i++ )
+            Vec_IntPush( vLifted, Vec_IntEntry(p->vCands, iStart + i) );
+        // if no pattern failed, all candidates are lifted; otherwise, the failing one is skipped
+        iStart += (iFail == -1) ? nPats : iFail + 1;
+    }
+    return Vec_IntSize(vLifted);
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -0,0 +1,259 @@
+/**CFile****************************************************************
+
+  FileName    [abcCkpt.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Network and node package.]
+
+  Synopsis    [Checkpointing the state of the framework.]
+
+  Author      []
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 19, 2026.]
+
+  Revision    [$Id: abcCkpt.c,v 1.00 2026/10/19 00:00:00 Exp $]
+
+***********************************************************************/
+
+#include "base/abc/abc.h"
+#include "base/main/main.h"
+#include "base/main/mainInt.h"
+#include "base/io/ioAbc.h"
+#include "misc/util/utilSignal.h"
+
+#ifdef WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// types of the current network saved in the checkpoint
+#define ABC_CKPT_NTK_AIG   1   // structurally hashed AIG in AIGER format
+#define ABC_CKPT_NTK_BLIF  2   // logic network in BLIF format
+
+typedef struct Abc_CkptNtk_t_ Abc_CkptNtk_t;
+struct Abc_CkptNtk_t_
+{
+    Abc_Ntk_t *    pNtk;      // the restored network
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Creates a temporary file name with the given suffix.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static char * Abc_CkptTempFile( char * pSuffix )
+{
+    char * pFileName = NULL;
+    int fd = Util_SignalTmpFile( "__abcckpt_", pSuffix, &pFileName );
+    if ( fd == -1 )
+        return NULL;
+#ifdef WIN32
+    _close( fd );
+#else
+    close( fd );
+#endif
+    return pFileName;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Saves the current network as user data of the checkpoint.]
+
+  Description [Structurally hashed networks are saved in AIGER, other
+  networks are saved in BLIF. Returns 0 if the network was not saved.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_NtkCkptWrite( Gia_CkptOut_t * pOut, Abc_Ntk_t * pNtk )
+{
+    int Type = Abc_NtkIsStrash(pNtk) ? ABC_CKPT_NTK_AIG : ABC_CKPT_NTK_BLIF;
+    char * pFileName = Abc_CkptTempFile( Type == ABC_CKPT_NTK_AIG ? ".aig" : ".blif" );
+    Vec_Str_t * vData;
+    char * pContents;
+    int nSize;
+    if ( pFileName == NULL )
+        return 0;
+    Io_Write( pNtk, pFileName, Type == ABC_CKPT_NTK_AIG ? IO_FILE_AIGER : IO_FILE_BLIF );
+    nSize = Extra_FileSize( pFileName );
+    pContents = nSize > 0 ? Extra_FileReadContents( pFileName ) : NULL;
+    Util_SignalTmpFileRemove( pFileName, 0 );
+    ABC_FREE( pFileName );
+    if ( pContents == NULL )
+        return 0;
+    // prepend the name and the spec, which are lost when the file is read
+    vData = Vec_StrAlloc( nSize + 1000 );
+    Vec_StrPrintStr( vData, pNtk->pName ? pNtk->pName : "" );
+    Vec_StrPush( vData, '\0' );
+    Vec_StrPrintStr( vData, pNtk->pSpec ? pNtk->pSpec : "" );
+    Vec_StrPush( vData, '\0' );
+    Vec_StrPushBuffer( vData, pContents, nSize );
+    Gia_CkptOutUser( pOut, Type, Vec_StrArray(vData), (word)Vec_StrSize(vData) );
+    Vec_StrFree( vData );
+    ABC_FREE( pContents );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Restores the current network from user data of the checkpoint.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NtkCkptRead( void * pUser, int Type, char * pData, word nBytes )
+{
+    Abc_CkptNtk_t * p = (Abc_CkptNtk_t *)pUser;
+    char * pName, * pSpec, * pLimit = pData + nBytes;
+    char * pFileName;
+    FILE * pFile;
+    if ( Type != ABC_CKPT_NTK_AIG && Type != ABC_CKPT_NTK_BLIF )
+        return;
+    pName = pData;
+    pSpec = pName + strnlen( pName, (size_t)(pLimit - pName) ) + 1;
+    if ( pSpec >= pLimit )
+        return;
+    pData = pSpec + strnlen( pSpec, (size_t)(pLimit - pSpec) ) + 1;
+    if ( pData > pLimit )
+        return;
+    nBytes = (word)(pLimit - pData);
+    pFileName = Abc_CkptTempFile( Type == ABC_CKPT_NTK_AIG ? ".aig" : ".blif" );
+    if ( pFileName == NULL )
+        return;
+    pFile = fopen( pFileName, "wb" );
+    if ( pFile && fwrite( pData, 1, (size_t)nBytes, pFile ) == (size_t)nBytes && fclose( pFile ) == 0 )
+    {
+        if ( p->pNtk )
+            Abc_NtkDelete( p->pNtk );
+        p->pNtk = Io_Read( pFileName, Type == ABC_CKPT_NTK_AIG ? IO_FILE_AIGER : IO_FILE_BLIF, 1, 0 );
+        if ( p->pNtk && *pName )
+            ABC_FREE( p->pNtk->pName ), p->pNtk->pName = Extra_UtilStrsav( pName );
+        if ( p->pNtk && *pSpec )
+            ABC_FREE( p->pNtk->pSpec ), p->pNtk->pSpec = Extra_UtilStrsav( pSpec );
+    }
+    else if ( pFile )
+        fclose( pFile );
+    Util_SignalTmpFileRemove( pFileName, 0 );
+    ABC_FREE( pFileName );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the current AIG and the current network into a checkpoint.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_FrameCkptWrite( Abc_Frame_t * pAbc, char * pFileName, int fCompress, int fVerbose )
+{
+    Gia_CkptOut_t * pOut;
+    abctime clk = Abc_Clock();
+    if ( pAbc->pGia == NULL && pAbc->pNtkCur == NULL )
+    {
+        Abc_Print( -1, "There is no AIG or network to save.\n" );
+        return 0;
+    }
+    pOut = Gia_CkptOutStart( pFileName, fCompress );
+    if ( pOut == NULL )
+    {
+        Abc_Print( -1, "Cannot open checkpoint file \"%s\" for writing.\n", pFileName );
+        return 0;
+    }
+    if ( pAbc->pGia )
+        Gia_CkptOutGia( pOut, pAbc->pGia );
+    if ( pAbc->pNtkCur && !Abc_NtkCkptWrite( pOut, pAbc->pNtkCur ) )
+        Abc_Print( 0, "The current network could not be saved.\n" );
+    if ( !Gia_CkptOutStop( pOut ) )
+    {
+        Abc_Print( -1, "Writing checkpoint file \"%s\" has failed.\n", pFileName );
+        return 0;
+    }
+    if ( fVerbose )
+    {
+        Abc_Print( 1, "Saved %s%s%s into %s checkpoint \"%s\".  ",
+            pAbc->pGia ? "AIG" : "", pAbc->pGia && pAbc->pNtkCur ? " and " : "", pAbc->pNtkCur ? "network" : "",
+            fCompress ? "compressed" : "uncompressed", pFileName );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Restores the current AIG and the current network from a checkpoint.]
+
+  Description [The current AIG and network are replaced only if the
+  whole checkpoint is read successfully.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_FrameCkptRead( Abc_Frame_t * pAbc, char * pFileName, int fVerbose )
+{
+    Abc_CkptNtk_t Data = { NULL };
+    Gia_Man_t * pGia;
+    FILE * pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+    {
+        Abc_Print( -1, "Cannot open checkpoint file \"%s\".\n", pFileName );
+        return 0;
+    }
+    fclose( pFile );
+    if ( !Gia_ManCkptReadUser( pFileName, &pGia, Abc_NtkCkptRead, &Data, fVerbose ) )
+    {
+        if ( Data.pNtk )
+            Abc_NtkDelete( Data.pNtk );
+        return 0;
+    }
+    if ( pGia == NULL && Data.pNtk == NULL )
+    {
+        Abc_Print( -1, "Checkpoint file \"%s\" contains neither an AIG nor a network.\n", pFileName );
+        return 0;
+    }
+    if ( pGia )
+        Abc_FrameUpdateGia( pAbc, pGia );
+    if ( Data.pNtk )
+        Abc_FrameReplaceCurrentNetwork( pAbc, Data.pNtk );
+    return 1;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -51,6 +51,7 @@ struct Abc_TtStore_t_
 extern Abc_TtStore_t * Abc_TtStoreLoad( char * pFileName, int nVarNum );
 extern void            Abc_TtStoreFree( Abc_TtStore_t * p, int nVarNum );
 extern void            Abc_TtStoreWrite( char * pFileName, Abc_TtStore_t * p, int fBinary );
+extern Abc_TtStore_t * Abc_TruthStoreAlloc( int nVars, int nFuncs );
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -165,19 +166,255 @@ void Abc_TruthNpnPrint( char * pCanonPermInit, unsigned uCanonPhase, int nVars )
 
 /**Function*************************************************************
 
-  Synopsis    [Apply decomposition to the truth table.]
+  Synopsis    [Computes the semi-canonical form of one function.]
 
-  Description [Returns the number of AIG nodes.]
+  Description [The hierarchical manager is needed for types 7-11. The
+  permutation info is needed for type 1. Returns the phase.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_TruthNpnPerform( Abc_TtStore_t * p, int NpnType, int fVerbose )
+unsigned Abc_TruthNpnCanonicizeOne( int NpnType, word * pFunc, int nVars, Abc_TtHieMan_t * pMan, permInfo * pi, char * pCanonPerm )
 {
     unsigned pAux[2048];
     word pAuxWord[1024], pAuxWord1[1024];
+    unsigned uCanonPhase = 0;
+    if ( NpnType == 1 )
+        simpleMinimal( pFunc, pAuxWord, pAuxWord1, pi, nVars );
+    else if ( NpnType == 2 )
+    {
+        resetPCanonPermArray( pCanonPerm, nVars );
+        uCanonPhase = Kit_TruthSemiCanonicize( (unsigned *)pFunc, pAux, nVars, pCanonPerm );
+    }
+    else if ( NpnType == 3 )
+    {
+        resetPCanonPermArray( pCanonPerm, nVars );
+        uCanonPhase = luckyCanonicizer_final_fast( pFunc, nVars, pCanonPerm );
+    }
+    else if ( NpnType == 4 )
+    {
+        resetPCanonPermArray( pCanonPerm, nVars );
+        uCanonPhase = luckyCanonicizer_final_fast1( pFunc, nVars, pCanonPerm );
+    }
+    else if ( NpnType == 5 )
+        uCanonPhase = Abc_TtCanonicize( pFunc, nVars, pCanonPerm );
+    else if ( NpnType == 6 )
+        uCanonPhase = Abc_TtCanonicizePhase( pFunc, nVars );
+    else if ( NpnType == 7 )
+        uCanonPhase = Abc_TtCanonicizeHie( pMan, pFunc, nVars, pCanonPerm, 0 );
+    else if ( NpnType == 8 )
+        uCanonPhase = Abc_TtCanonicizeWrap( Abc_TtCanonicizeAda, pMan, pFunc, nVars, pCanonPerm,  125 ); // fHigh = 1, iEnumThres = 25
+    else if ( NpnType == 9 )
+        uCanonPhase = Abc_TtCanonicizeWrap( Abc_TtCanonicizeAda, pMan, pFunc, nVars, pCanonPerm,  125 ); // -A 8, adjustable algorithm (heuristic)
+    else if ( NpnType == 10 )
+        uCanonPhase = Abc_TtCanonicizeWrap( Abc_TtCanonicizeAda, pMan, pFunc, nVars, pCanonPerm, 1199 ); // -A 9, adjustable algorithm (exact)
+    else if ( NpnType == 11 )
+        uCanonPhase = Abc_TtCanonicizeWrap( Abc_TtCanonicizeCA,  pMan, pFunc, nVars, pCanonPerm,    1 ); // -A 10, new cost-aware exact algorithm
+    else if ( NpnType == 12 )
+        uCanonPhase = Abc_TtCanonicizePerm( pFunc, nVars, pCanonPerm );
+    else assert( NpnType == 0 );
+    return uCanonPhase;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints the semi-canonical form of one function.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_TruthNpnPrintOne( int NpnType, int iFunc, word * pFunc, int nVars, char * pCanonPerm, unsigned uCanonPhase )
+{
+    printf( "%7d : ", iFunc );
+    if ( NpnType == 7 )
+    {
+        printf( "\n" );
+        return;
+    }
+    Extra_PrintHex( stdout, (unsigned *)pFunc, nVars );
+    if ( NpnType == 1 || NpnType == 6 )
+        Abc_TruthNpnPrint( NULL, uCanonPhase, nVars );
+    else if ( NpnType != 0 )
+        Abc_TruthNpnPrint( pCanonPerm, uCanonPhase, nVars );
+    printf( "\n" );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes semi-canonical forms of a range of functions.]
+
+  Description [Each range uses its own managers and scratch memory, so 
+  that the ranges can be processed concurrently. Also computes the hash 
+  keys of the resulting functions.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Abc_NpnPart_t_ Abc_NpnPart_t;
+struct Abc_NpnPart_t_ 
+{
+    Abc_TtStore_t *    p;           // truth tables
+    int                NpnType;     // semi-canonical form type
+    int                iStart;      // the first function of the range
+    int                iStop;       // the first function after the range
+    int                iBegin;      // the first hash bucket owned by this range
+    int                iEnd;        // the first hash bucket after the range
+    int                nTableSize;  // hash table size
+    int *              pKeys;       // hash keys of all functions
+    int *              pTable;      // hash table shared by all ranges
+    int *              pNexts;      // next functions in the hash table
+    unsigned *         pPhases;     // phases of all functions (verbose mode only)
+    char *             pPerms;      // permutations of all functions (verbose mode only)
+};
+int Abc_TruthNpnPerformPart( void * pArg )
+{
+    Abc_NpnPart_t * pPart = (Abc_NpnPart_t *)pArg;
+    Abc_TtStore_t * p = pPart->p;
+    Abc_TtHieMan_t * pMan = NULL;
+    permInfo * pi = NULL;
+    char pCanonPerm[16] = {0};
+    unsigned uCanonPhase;
+    int i;
+    if ( pPart->NpnType == 1 )
+        pi = setPermInfoPtr( p->nVars );
+    if ( pPart->NpnType >= 7 && pPart->NpnType <= 11 )
+        pMan = Abc_TtHieManStart( p->nVars, 5 );
+    for ( i = pPart->iStart; i < pPart->iStop; i++ )
+    {
+        uCanonPhase = Abc_TruthNpnCanonicizeOne( pPart->NpnType, p->pFuncs[i], p->nVars, pMan, pi, pCanonPerm );
+        if ( pPart->pPhases )
+        {
+            pPart->pPhases[i] = uCanonPhase;
+            memcpy( pPart->pPerms + 16 * i, pCanonPerm, 16 );
+        }
+        pPart->pKeys[i] = Abc_TruthHashKey( p->pFuncs[i], p->nWords, pPart->nTableSize );
+    }
+    if ( pi )
+        freePermInfoPtr( pi );
+    if ( pMan )
+        Abc_TtHieManStop( pMan );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Hashes the functions whose keys fall into the range of buckets.]
+
+  Description [The ranges of buckets are disjoint, so the ranges can be 
+  hashed concurrently. The functions are visited in the same order as 
+  in Abc_TruthNpnCountUnique(), so the same functions are kept.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_TruthNpnHashPart( void * pArg )
+{
+    Abc_NpnPart_t * pPart = (Abc_NpnPart_t *)pArg;
+    Abc_TtStore_t * p = pPart->p;
+    int i, Key;
+    for ( i = 0; i < p->nFuncs; i++ )
+    {
+        Key = pPart->pKeys[i];
+        if ( Key < pPart->iBegin || Key >= pPart->iEnd )
+            continue;
+        if ( Abc_TruthHashLookup( p->pFuncs, i, p->nWords, pPart->pTable, pPart->pNexts, Key ) ) // found equal
+            p->pFuncs[i] = NULL;
+        else // there is no equal (the first time this one occurs so far)
+            pPart->pNexts[i] = pPart->pTable[Key], pPart->pTable[Key] = i;
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes semi-canonical forms and counts classes using threads.]
+
+  Description [The functions are divided into ranges canonicized by 
+  different threads. The classes are counted in the hash table, whose 
+  buckets are divided between the threads. Returns the number of classes
+  and leaves one representative of each class in the store.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_TruthNpnPerformPar( Abc_TtStore_t * p, int NpnType, int nProcs, int fVerbose )
+{
+    int nParts = Abc_MaxInt( 1, Abc_MinInt(nProcs, p->nFuncs) );
+    int nTableSize = Abc_PrimeCudd( p->nFuncs );
+    int * pKeys  = ABC_ALLOC( int, p->nFuncs );
+    int * pTable = ABC_FALLOC( int, nTableSize );
+    int * pNexts = ABC_FALLOC( int, p->nFuncs );
+    unsigned * pPhases = fVerbose ? ABC_CALLOC( unsigned, p->nFuncs ) : NULL;
+    char * pPerms = fVerbose ? ABC_CALLOC( char, 16 * p->nFuncs ) : NULL;
+    Abc_NpnPart_t * pParts = ABC_CALLOC( Abc_NpnPart_t, nParts );
+    Vec_Ptr_t * vData = Vec_PtrAlloc( nParts );
+    int i, k;
+    assert( p->nFuncs > 0 );
+    for ( i = 0; i < nParts; i++ )
+    {
+        pParts[i].p          = p;
+        pParts[i].NpnType    = NpnType;
+        pParts[i].iStart     = (int)((word)p->nFuncs * i / nParts);
+        pParts[i].iStop      = (int)((word)p->nFuncs * (i+1) / nParts);
+        pParts[i].iBegin     = (int)((word)nTableSize * i / nParts);
+        pParts[i].iEnd       = (int)((word)nTableSize * (i+1) / nParts);
+        pParts[i].nTableSize = nTableSize;
+        pParts[i].pKeys      = pKeys;
+        pParts[i].pTable     = pTable;
+        pParts[i].pNexts     = pNexts;
+        pParts[i].pPhases    = pPhases;
+        pParts[i].pPerms     = pPerms;
+        Vec_PtrPush( vData, pParts + i );
+    }
+    // the threads proceed only after all functions are canonicized
+    Util_ProcessThreads( Abc_TruthNpnPerformPart, vData, nParts + 1, 0, 0 );
+    // print the canonical forms in the same order as the serial computation
+    if ( fVerbose )
+        for ( i = 0; i < p->nFuncs; i++ )
+            Abc_TruthNpnPrintOne( NpnType, i, p->pFuncs[i], p->nVars, pPerms + 16 * i, pPhases[i] );
+    Util_ProcessThreads( Abc_TruthNpnHashPart, vData, nParts + 1, 0, 0 );
+    Vec_PtrFree( vData );
+    ABC_FREE( pParts );
+    ABC_FREE( pPhases );
+    ABC_FREE( pPerms );
+    ABC_FREE( pKeys );
+    ABC_FREE( pTable );
+    ABC_FREE( pNexts );
+    // count the number of unqiue functions
+    assert( p->pFuncs[0] != NULL );
+    for ( i = k = 1; i < p->nFuncs; i++ )
+        if ( p->pFuncs[i] != NULL )
+            p->pFuncs[k++] = p->pFuncs[i];
+    return (p->nFuncs = k);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Apply decomposition to the truth table.]
+
+  Description [Returns the number of AIG nodes.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_TruthNpnPerform( Abc_TtStore_t * p, int NpnType, int nProcs, int fVerbose )
+{
+    Abc_TtHieMan_t * pMan = NULL;
+    permInfo * pi = NULL;
     char pCanonPerm[16];
     unsigned uCanonPhase=0;
     abctime clk = Abc_Clock();
@@ -218,152 +455,136 @@ void Abc_TruthNpnPerform( Abc_TtStore_t * p, int NpnType, int fVerbose )
     if ( fVerbose )
         printf( "\n" );
 
-    if ( NpnType == 0 )
+    if ( nProcs > 1 )
     {
-        for ( i = 0; i < p->nFuncs; i++ )
-        {
-            if ( fVerbose )
-                printf( "%7d : ", i );
-            if ( fVerbose )
-                Extra_PrintHex( stdout, (unsigned *)p->pFuncs[i], p->nVars ), printf( "\n" );
-        }
+        if ( NpnType == 1 )
+            Abc_TruthNpnPerformPar( p, 0, nProcs, 0 );
+        printf( "Classes =%9d  ", Abc_TruthNpnPerformPar(p, NpnType, nProcs, fVerbose) );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+        return;
     }
-    else if ( NpnType == 1 )
+    if ( NpnType == 1 )
     {
-        permInfo* pi; 
         Abc_TruthNpnCountUnique(p);
         pi = setPermInfoPtr(p->nVars);
-        for ( i = 0; i < p->nFuncs; i++ )
-        {
-            if ( fVerbose )
-                printf( "%7d : ", i );
-            simpleMinimal(p->pFuncs[i], pAuxWord, pAuxWord1, pi, p->nVars);
-            if ( fVerbose )
-                Extra_PrintHex( stdout, (unsigned *)p->pFuncs[i], p->nVars ), Abc_TruthNpnPrint(pCanonPerm, uCanonPhase, p->nVars), printf( "\n" );
-        }
-        freePermInfoPtr(pi);
     }
-    else if ( NpnType == 2 )
-    {
-        for ( i = 0; i < p->nFuncs; i++ )
-        {
-            if ( fVerbose )
-                printf( "%7d : ", i );
-            resetPCanonPermArray(pCanonPerm, p->nVars);
-            uCanonPhase = Kit_TruthSemiCanonicize( (unsigned *)p->pFuncs[i], pAux, p->nVars, pCanonPerm );
-            if ( fVerbose )
-                Extra_PrintHex( stdout, (unsigned *)p->pFuncs[i], p->nVars ), Abc_TruthNpnPrint(pCanonPerm, uCanonPhase, p->nVars), printf( "\n" );
-        }
-    }
-    else if ( NpnType == 3 )
-    {
-        for ( i = 0; i < p->nFuncs; i++ )
-        {
-            if ( fVerbose )
-                printf( "%7d : ", i );
-            resetPCanonPermArray(pCanonPerm, p->nVars);
-            uCanonPhase = luckyCanonicizer_final_fast( p->pFuncs[i], p->nVars, pCanonPerm );
-            if ( fVerbose )
-                Extra_PrintHex( stdout, (unsigned *)p->pFuncs[i], p->nVars ), Abc_TruthNpnPrint(pCanonPerm, uCanonPhase, p->nVars), printf( "\n" );
-        }
-    }
-    else if ( NpnType == 4 )
-    {
-        for ( i = 0; i < p->nFuncs; i++ )
-        {
-            if ( fVerbose )
-                printf( "%7d : ", i );
-            resetPCanonPermArray(pCanonPerm, p->nVars);
-            uCanonPhase = luckyCanonicizer_final_fast1( p->pFuncs[i], p->nVars, pCanonPerm );
-            if ( fVerbose )
-                Extra_PrintHex( stdout, (unsigned *)p->pFuncs[i], p->nVars ), Abc_TruthNpnPrint(pCanonPerm, uCanonPhase, p->nVars), printf( "\n" );
-        }
-    }
-    else if ( NpnType == 5 )
+    if ( NpnType >= 7 && NpnType <= 11 )
+        pMan = Abc_TtHieManStart(p->nVars, 5);
+    for ( i = 0; i < p->nFuncs; i++ )
     {
-        for ( i = 0; i < p->nFuncs; i++ )
-        {
-            if ( fVerbose )
-                printf( "%7d : ", i );
-            uCanonPhase = Abc_TtCanonicize( p->pFuncs[i], p->nVars, pCanonPerm );
-            if ( fVerbose )
-                Extra_PrintHex( stdout, (unsigned *)p->pFuncs[i], p->nVars ), Abc_TruthNpnPrint(pCanonPerm, uCanonPhase, p->nVars), printf( "\n" );
-        }
+        uCanonPhase = Abc_TruthNpnCanonicizeOne( NpnType, p->pFuncs[i], p->nVars, pMan, pi, pCanonPerm );
+        if ( fVerbose )
+            Abc_TruthNpnPrintOne( NpnType, i, p->pFuncs[i], p->nVars, pCanonPerm, uCanonPhase );
     }
-    else if ( NpnType == 6 )
+    if ( pi )
+        freePermInfoPtr(pi);
+    if ( pMan )
+        Abc_TtHieManStop(pMan);
+    clk = Abc_Clock() - clk;
+    printf( "Classes =%9d  ", Abc_TruthNpnCountUnique(p) );
+    Abc_PrintTime( 1, "Time", clk );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the name of the canonical form.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static char * Abc_TruthNpnName( int NpnType )
+{
+    char * pNames[13] = { "uniqifying", "exact NPN", "counting 1s", "Jake's hybrid fast", "Jake's hybrid good", 
+        "new hybrid fast", "new phase flipping", "new hier. matching", "new adap. matching", "adjustable algorithm (heuristic)",
+        "adjustable algorithm (exact)", "new cost-aware exact algorithm", "new hybrid fast (P)" };
+    return (NpnType >= 0 && NpnType <= 12) ? pNames[NpnType] : "unknown";
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes semi-canonical forms of functions streamed from a binary file.]
+
+  Description [Reads the file by batches of the given number of functions.
+  Each batch is canonicized and uniqified using threads, after which its 
+  representatives are added to the table of classes. Only the classes are
+  kept in memory, so the file can be larger than the available memory.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_TruthNpnStream( char * pFileName, int NpnType, int nVarNum, int nProcs, int nBatch, int fDumpRes, int fBinary, int fVerbose )
+{
+    Abc_TtStore_t * p, * pClasses;
+    Vec_Mem_t * vTtMem;
+    FILE * pFile;
+    char * pFileNameOut;
+    word nFuncs = 0;
+    int i, nBatches = 0;
+    abctime clk = Abc_Clock();
+    assert( nVarNum >= 6 && nBatch > 0 );
+    pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
     {
-        for ( i = 0; i < p->nFuncs; i++ )
-        {
-            if ( fVerbose )
-                printf( "%7d : ", i );
-            uCanonPhase = Abc_TtCanonicizePhase( p->pFuncs[i], p->nVars );
-            if ( fVerbose )
-                Extra_PrintHex( stdout, (unsigned *)p->pFuncs[i], p->nVars ), Abc_TruthNpnPrint(NULL, uCanonPhase, p->nVars), printf( "\n" );
-        }
+        printf( "Cannot open file \"%s\" for reading.\n", pFileName );
+        return;
     }
-    else if ( NpnType == 7 )
+    p = Abc_TruthStoreAlloc( nVarNum, nBatch );
+    vTtMem = Vec_MemAllocForTTSimple( nVarNum );
+    printf( "Applying %-20s to funcs of %2d vars from file \"%s\" in batches of %d...  ", 
+        Abc_TruthNpnName(NpnType), p->nVars, pFileName, nBatch );
+    if ( fVerbose )
+        printf( "\n" );
+    while ( 1 )
     {
-        int fExact = 0;
-		Abc_TtHieMan_t * pMan = Abc_TtHieManStart( p->nVars, 5 );
+        word * pBuffer = (word *)(p->pFuncs + nBatch);
+        int nRead = (int)fread( pBuffer, sizeof(word) * p->nWords, (size_t)nBatch, pFile );
+        if ( nRead == 0 )
+            break;
+        // restore the truth table pointers changed by uniqifying the previous batch
+        for ( i = 0; i < nRead; i++ )
+            p->pFuncs[i] = pBuffer + (size_t)i * p->nWords;
+        p->nFuncs = nRead;
+        nFuncs += nRead;
+        if ( NpnType == 1 )
+            Abc_TruthNpnPerformPar( p, 0, nProcs, 0 );
+        Abc_TruthNpnPerformPar( p, NpnType, nProcs, 0 );
         for ( i = 0; i < p->nFuncs; i++ )
-        {
-            if ( fVerbose )
-                printf( "%7d : ", i );
-            uCanonPhase = Abc_TtCanonicizeHie( pMan, p->pFuncs[i], p->nVars, pCanonPerm, fExact );
-            if ( fVerbose )
-//                Extra_PrintHex( stdout, (unsigned *)p->pFuncs[i], p->nVars ), Abc_TruthNpnPrint(NULL, uCanonPhase, p->nVars), printf( "\n" );
-                printf( "\n" );
-        }
-        // nClasses = Abc_TtManNumClasses( pMan );
-		Abc_TtHieManStop( pMan );
-    }
-    else if ( NpnType == 8 )
-    {
-		int fHigh = 1, iEnumThres = 25;
-		Abc_TtHieMan_t * pMan = Abc_TtHieManStart(p->nVars, 5);
-		for ( i = 0; i < p->nFuncs; i++ )
-        {
-            if ( fVerbose )
-                printf( "%7d : ", i );
-            uCanonPhase = Abc_TtCanonicizeWrap(Abc_TtCanonicizeAda, pMan, p->pFuncs[i], p->nVars, pCanonPerm, fHigh*100 + iEnumThres);
-            if ( fVerbose )
-                Extra_PrintHex( stdout, (unsigned *)p->pFuncs[i], p->nVars ), Abc_TruthNpnPrint(pCanonPerm, uCanonPhase, p->nVars), printf( "\n" );
-        }
-		Abc_TtHieManStop(pMan);
-    }
-    else if ( NpnType == 9 || NpnType == 10 || NpnType == 11 )
-    {
-		Abc_TtHieMan_t * pMan = Abc_TtHieManStart(p->nVars, 5);
-		for ( i = 0; i < p->nFuncs; i++ )
-        {
-            if ( fVerbose )
-                printf( "%7d : ", i );
-            if ( NpnType == 9 )
-                uCanonPhase = Abc_TtCanonicizeWrap(Abc_TtCanonicizeAda, pMan, p->pFuncs[i], p->nVars, pCanonPerm,  125); // -A 8, adjustable algorithm (heuristic)
-            else if ( NpnType == 10 )
-                uCanonPhase = Abc_TtCanonicizeWrap(Abc_TtCanonicizeAda, pMan, p->pFuncs[i], p->nVars, pCanonPerm, 1199); // -A 9, adjustable algorithm (exact)
-            else if ( NpnType == 11 )
-                uCanonPhase = Abc_TtCanonicizeWrap(Abc_TtCanonicizeCA,  pMan, p->pFuncs[i], p->nVars, pCanonPerm,    1); // -A 10, new cost-aware exact algorithm
-            if ( fVerbose )
-                Extra_PrintHex( stdout, (unsigned *)p->pFuncs[i], p->nVars ), Abc_TruthNpnPrint(pCanonPerm, uCanonPhase, p->nVars), printf( "\n" );
-        }
-		Abc_TtHieManStop(pMan);
+            Vec_MemHashInsert( vTtMem, p->pFuncs[i] );
+        if ( fVerbose )
+            printf( "Batch %5d : Funcs =%10d.  Unique =%10d.  Classes =%10d.\n", 
+                nBatches, nRead, p->nFuncs, Vec_MemEntryNum(vTtMem) );
+        nBatches++;
+        if ( nRead < nBatch )
+            break;
     }
-    else if ( NpnType == 12 )
+    fclose( pFile );
+    printf( "Funcs =%12.0f  Classes =%9d  ", (double)nFuncs, Vec_MemEntryNum(vTtMem) );
+    Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    // write the classes
+    if ( fDumpRes && Vec_MemEntryNum(vTtMem) > 0 )
     {
-        for ( i = 0; i < p->nFuncs; i++ )
-        {
-            if ( fVerbose )
-                printf( "%7d : ", i );
-            uCanonPhase = Abc_TtCanonicizePerm( p->pFuncs[i], p->nVars, pCanonPerm );
-            if ( fVerbose )
-                Extra_PrintHex( stdout, (unsigned *)p->pFuncs[i], p->nVars ), Abc_TruthNpnPrint(pCanonPerm, uCanonPhase, p->nVars), printf( "\n" );
-        }
+        pClasses = ABC_CALLOC( Abc_TtStore_t, 1 );
+        pClasses->nVars  = p->nVars;
+        pClasses->nWords = p->nWords;
+        pClasses->nFuncs = Vec_MemEntryNum(vTtMem);
+        pClasses->pFuncs = ABC_ALLOC( word *, pClasses->nFuncs );
+        for ( i = 0; i < pClasses->nFuncs; i++ )
+            pClasses->pFuncs[i] = Vec_MemReadEntry( vTtMem, i );
+        pFileNameOut = Extra_FileNameGenericAppend( pFileName, fBinary ? "_out.tt" : "_out.txt" );
+        Abc_TtStoreWrite( pFileNameOut, pClasses, fBinary );
+        if ( fVerbose )
+            printf( "The resulting functions are written into file \"%s\".\n", pFileNameOut );
+        Abc_TtStoreFree( pClasses, -1 );
     }
-    else assert( 0 );
-    clk = Abc_Clock() - clk;
-    printf( "Classes =%9d  ", Abc_TruthNpnCountUnique(p) );
-    Abc_PrintTime( 1, "Time", clk );
+    Vec_MemHashFree( vTtMem );
+    Vec_MemFree( vTtMem );
+    Abc_TtStoreFree( p, -1 );
 }
 
 /**Function*************************************************************
@@ -377,18 +598,25 @@ void Abc_TruthNpnPerform( Abc_TtStore_t * p, int NpnType, int fVerbose )
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_TruthNpnTest( char * pFileName, int NpnType, int nVarNum, int fDumpRes, int fBinary, int fVerbose )
+void Abc_TruthNpnTest( char * pFileName, int NpnType, int nVarNum, int nProcs, int nBatch, int fDumpRes, int fBinary, int fVerbose )
 {
     Abc_TtStore_t * p;
     char * pFileNameOut;
 
+    // stream functions from a binary file
+    if ( nBatch > 0 )
+    {
+        Abc_TruthNpnStream( pFileName, NpnType, nVarNum, nProcs, nBatch, fDumpRes, fBinary, fVerbose );
+        return;
+    }
+
     // read info from file
     p = Abc_TtStoreLoad( pFileName, nVarNum );
     if ( p == NULL )
         return;
 
     // consider functions from the file
-    Abc_TruthNpnPerform( p, NpnType, fVerbose );
+    Abc_TruthNpnPerform( p, NpnType, nProcs, fVerbose );
 
     // write the result
     if ( fDumpRes )
@@ -419,12 +647,12 @@ void Abc_TruthNpnTest( char * pFileName, int NpnType, int nVarNum, int fDumpRes,
   SeeAlso     []
 
 ***********************************************************************/
-int Abc_NpnTest( char * pFileName, int NpnType, int nVarNum, int fDumpRes, int fBinary, int fVerbose )
+int Abc_NpnTest( char * pFileName, int NpnType, int nVarNum, int nProcs, int nBatch, int fDumpRes, int fBinary, int fVerbose )
 {
     if ( fVerbose )
         printf( "Using truth tables from file \"%s\"...\n", pFileName );
     if ( NpnType >= 0 && NpnType <= 12 )
-        Abc_TruthNpnTest( pFileName, NpnType, nVarNum, fDumpRes, fBinary, fVerbose );
+        Abc_TruthNpnTest( pFileName, NpnType, nVarNum, nProcs, nBatch, fDumpRes, fBinary, fVerbose );
     else
         printf( "Unknown canonical form value (%d).\n", NpnType );
     fflush( stdout );
@@ -29,6 +29,17 @@
 #include "base/main/main.h"
 #include "base/cmd/cmd.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#if defined(_WIN32) && !defined(__MINGW32__)
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
@@ -55,6 +66,36 @@ typedef enum {
     ACB_UNUSED     // 14: unused
 } Acb_KeyWords_t; 
 
+// the output of the concurrent patch computation is collected separately
+// for each worker and printed after the workers finish
+#ifdef _MSC_VER
+static __declspec(thread) Vec_Str_t * s_vEcoLog = NULL;
+#else
+static __thread Vec_Str_t * s_vEcoLog = NULL;
+#endif
+
+static void Acb_EcoPrintf( const char * format, ... )
+{
+    va_list args;
+    va_start( args, format );
+    if ( s_vEcoLog == NULL )
+        vprintf( format, args );
+    else
+    {
+        char Buffer[1000];
+        vsnprintf( Buffer, 1000, format, args );
+        Vec_StrAppend( s_vEcoLog, Buffer );
+    }
+    va_end( args );
+}
+static void Acb_EcoPrintTime( const char * pStr, abctime time )
+{
+    if ( s_vEcoLog == NULL )
+        Abc_PrintTime( 1, pStr, time );
+    else
+        Acb_EcoPrintf( "%s =%9.2f sec\n", pStr, 1.0*((double)(time))/((double)CLOCKS_PER_SEC) );
+}
+
 static inline char * Acb_Num2Name( int i )
 {
     if ( i == 1  )  return "module";
@@ -1074,7 +1115,7 @@ int Acb_NtkSaveNames( Acb_Ntk_t * p, Vec_Int_t * vSupp, Vec_Int_t * vNodes, Vec_
   SeeAlso     []
 
 ***********************************************************************/
-Gia_Man_t * Acb_CreateMiter( Gia_Man_t * pF, Gia_Man_t * pG )
+Gia_Man_t * Acb_CreateMiterRoots( Gia_Man_t * pF, Gia_Man_t * pG, Vec_Bit_t * vRoots )
 {
     Gia_Man_t * pNew, * pOne;
     Gia_Obj_t * pObj;
@@ -1095,6 +1136,8 @@ Gia_Man_t * Acb_CreateMiter( Gia_Man_t * pF, Gia_Man_t * pG )
         pObj->Value = Gia_ManHashAnd( pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
     Gia_ManForEachCo( pG, pObj, i )
     {
+        if ( vRoots && !Vec_BitEntry(vRoots, i) )
+            continue;
         iXor = Gia_ManHashXor( pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin0Copy(Gia_ManCo(pF, i)) );
         iMiter = Gia_ManHashOr( pNew, iMiter, iXor );
     }
@@ -1107,6 +1150,10 @@ Gia_Man_t * Acb_CreateMiter( Gia_Man_t * pF, Gia_Man_t * pG )
     Gia_ManStop( pOne );
     return pNew;
 }
+Gia_Man_t * Acb_CreateMiter( Gia_Man_t * pF, Gia_Man_t * pG )
+{
+    return Acb_CreateMiterRoots( pF, pG, NULL );
+}
 
 /**Function*************************************************************
 
@@ -1331,7 +1378,7 @@ Vec_Int_t * Acb_FindSupportNext( sat_solver * pSat, int iFirstDiv, Vec_Int_t * v
         (*pnPats)++;
         if ( *pnPats == NWORDS*64 )
         {
-            printf( "Exceeded %d words.\n", NWORDS );
+            Acb_EcoPrintf( "Exceeded %d words.\n", NWORDS );
             Vec_IntFreeP( &vSupp );
             return NULL;
         }
@@ -1441,14 +1488,14 @@ Vec_Int_t * Acb_FindSupport( sat_solver * pSat, int iFirstDiv, Vec_Int_t * vWeig
     // find initial best
     CostBest = Acb_ComputeSuppCost( vSuppStart, vWeights, iFirstDiv );
     vSuppBest = Vec_IntDup( vSuppStart );
-    printf( "Starting cost = %d.\n", CostBest );
+    Acb_EcoPrintf( "Starting cost = %d.\n", CostBest );
 
     // iteratively find the one with the most ones in the uncovered rows
     for ( Iter = 0; Iter < 500; Iter++ )
     {
         if ( Abc_Clock() > clkLimit )
         {
-            printf( "Timeout after %d sec.\n", TimeOut );
+            Acb_EcoPrintf( "Timeout after %d sec.\n", TimeOut );
             break;
         }
         if ( Iter == 0 )
@@ -1467,8 +1514,8 @@ Vec_Int_t * Acb_FindSupport( sat_solver * pSat, int iFirstDiv, Vec_Int_t * vWeig
         {
             CostBest = Cost;
             ABC_SWAP( Vec_Int_t *, vSuppBest, vSupp );
-            printf( "Iter %4d:  Next cost = %5d.  ", Iter, Cost );
-            printf( "Updating best solution.\n" );
+            Acb_EcoPrintf( "Iter %4d:  Next cost = %5d.  ", Iter, Cost );
+            Acb_EcoPrintf( "Updating best solution.\n" );
         }
         Vec_IntFree( vSupp );
     }
@@ -1550,7 +1597,7 @@ Vec_Int_t * Acb_DerivePatchSupport( Cnf_Dat_t * pCnf, int iTar, int nTargets, in
                 pLits[1] = Abc_Var2Lit( iVar1, 1 );
                 if ( !sat_solver_addclause( pSat, pLits, pLits+2 ) )
                 {
-                    printf( "Unsat is detected earlier.\n" );
+                    Acb_EcoPrintf( "Unsat is detected earlier.\n" );
                     status = l_False;
                     break;
                 }
@@ -1558,7 +1605,7 @@ Vec_Int_t * Acb_DerivePatchSupport( Cnf_Dat_t * pCnf, int iTar, int nTargets, in
                 pLits[1] = Abc_Var2Lit( iVar1, 0 );
                 if ( !sat_solver_addclause( pSat, pLits, pLits+2 ) )
                 {
-                    printf( "Unsat is detected earlier.\n" );
+                    Acb_EcoPrintf( "Unsat is detected earlier.\n" );
                     status = l_False;
                     break;
                 }
@@ -1577,21 +1624,21 @@ Vec_Int_t * Acb_DerivePatchSupport( Cnf_Dat_t * pCnf, int iTar, int nTargets, in
             if ( TimeOut ) sat_solver_set_runtime_limit( pSat, 0 );
             if ( status == l_True )
             {
-                printf( "ECO does not exist.\n" );
+                Acb_EcoPrintf( "ECO does not exist.\n" );
                 sat_solver_delete( pSat );
                 Vec_IntFree( vSupp );
                 return NULL;
             }
             if ( status == l_Undef )
             {
-                printf( "Support computation timed out after %d sec.\n", TimeOut );
+                Acb_EcoPrintf( "Support computation timed out after %d sec.\n", TimeOut );
                 sat_solver_delete( pSat );
                 Vec_IntFree( vSupp );
                 return NULL;
             }
             assert( status == l_False );
-            printf( "Proved that the problem has a solution.  " );
-            Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+            Acb_EcoPrintf( "Proved that the problem has a solution.  " );
+            Acb_EcoPrintTime( "Time", Abc_Clock() - clk );
             // find minimum subset
             if ( fUseMinAssump )
             {
@@ -1601,8 +1648,8 @@ Vec_Int_t * Acb_DerivePatchSupport( Cnf_Dat_t * pCnf, int iTar, int nTargets, in
                 nSuppNew = sat_solver_minimize_assumptions( pSat, Vec_IntArray(vSupp), Vec_IntSize(vSupp), 0 );
                 Vec_IntShrink( vSupp, nSuppNew );
                 Vec_IntSort( vSupp, 0 );
-                printf( "Found one feasible set of %d divisors.  ", Vec_IntSize(vSupp) );
-                Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+                Acb_EcoPrintf( "Found one feasible set of %d divisors.  ", Vec_IntSize(vSupp) );
+                Acb_EcoPrintTime( "Time", Abc_Clock() - clk );
 
                 // perform minimization
                 if ( fUseSuppMin && Vec_IntSize(vSupp) > 0 )
@@ -1615,22 +1662,22 @@ Vec_Int_t * Acb_DerivePatchSupport( Cnf_Dat_t * pCnf, int iTar, int nTargets, in
                     Vec_IntFree( vTemp );
                     if ( vSupp == NULL )
                     {
-                        printf( "Support minimization did not succeed.  " );
+                        Acb_EcoPrintf( "Support minimization did not succeed.  " );
                         //sat_solver_delete( pSat );
                         vSupp = vSupp2;
                     }
                     else
                     {
                         Vec_IntFree( vSupp2 );
-                        printf( "Minimized support to %d supp vars.  ", Vec_IntSize(vSupp) );
+                        Acb_EcoPrintf( "Minimized support to %d supp vars.  ", Vec_IntSize(vSupp) );
                     }
-                    Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+                    Acb_EcoPrintTime( "Time", Abc_Clock() - clk );
                 }
             }
             else
             {
                 int * pFinal, nFinal = sat_solver_final( pSat, &pFinal );
-                printf( "AnalyzeFinal returned %d (out of %d).\n", nFinal, Vec_IntSize(vSupp) );
+                Acb_EcoPrintf( "AnalyzeFinal returned %d (out of %d).\n", nFinal, Vec_IntSize(vSupp) );
                 Vec_IntClear( vSupp ); 
                 for ( i = 0; i < nFinal; i++ )
                     Vec_IntPush( vSupp, Abc_LitNot(pFinal[i]) );
@@ -1639,7 +1686,7 @@ Vec_Int_t * Acb_DerivePatchSupport( Cnf_Dat_t * pCnf, int iTar, int nTargets, in
                 assert( status == l_False );
                 // try again
                 nFinal = sat_solver_final( pSat, &pFinal );
-                printf( "AnalyzeFinal returned %d (out of %d).\n", nFinal, Vec_IntSize(vSupp) );
+                Acb_EcoPrintf( "AnalyzeFinal returned %d (out of %d).\n", nFinal, Vec_IntSize(vSupp) );
             }
             // remap them into numbers
             Vec_IntForEachEntry( vSupp, iLit, i )
@@ -1768,15 +1815,15 @@ Vec_Int_t * Acb_DerivePatchSupportS( Cnf_Dat_t * pCnf, int nCiTars, int nCoDivs,
         status = satoko_solve_assumptions( pSat, Vec_IntArray(vSupp), Vec_IntSize(vSupp) );
         if ( status != l_False )
         {
-            printf( "Demonstrated that the problem has NO solution.  " );
-            Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+            Acb_EcoPrintf( "Demonstrated that the problem has NO solution.  " );
+            Acb_EcoPrintTime( "Time", Abc_Clock() - clk );
             satoko_destroy( pSat );
             Vec_IntFree( vSupp );
             return NULL;
         }
         assert( status == l_False );
-        printf( "Proved that the problem has a solution.  " );
-        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+        Acb_EcoPrintf( "Proved that the problem has a solution.  " );
+        Acb_EcoPrintTime( "Time", Abc_Clock() - clk );
 
         // find minimum subset
         if ( fUseMinAssump )
@@ -1784,13 +1831,13 @@ Vec_Int_t * Acb_DerivePatchSupportS( Cnf_Dat_t * pCnf, int nCiTars, int nCoDivs,
             abctime clk = Abc_Clock();
             nSuppNew = satoko_minimize_assumptions( pSat, Vec_IntArray(vSupp), Vec_IntSize(vSupp), 0 );
             Vec_IntShrink( vSupp, nSuppNew );
-            printf( "Solved the problem with %d supp vars.  ", Vec_IntSize(vSupp) );
-            Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+            Acb_EcoPrintf( "Solved the problem with %d supp vars.  ", Vec_IntSize(vSupp) );
+            Acb_EcoPrintTime( "Time", Abc_Clock() - clk );
         }
         else
         {
             int * pFinal, nFinal = satoko_final_conflict( pSat, &pFinal );
-            printf( "AnalyzeFinal returned %d (out of %d).\n", nFinal, Vec_IntSize(vSupp) );
+            Acb_EcoPrintf( "AnalyzeFinal returned %d (out of %d).\n", nFinal, Vec_IntSize(vSupp) );
             Vec_IntClear( vSupp ); 
             for ( i = 0; i < nFinal; i++ )
                 Vec_IntPush( vSupp, Abc_LitNot(pFinal[i]) );
@@ -1799,7 +1846,7 @@ Vec_Int_t * Acb_DerivePatchSupportS( Cnf_Dat_t * pCnf, int nCiTars, int nCoDivs,
             assert( status == l_False );
             // try again
             nFinal = satoko_final_conflict( pSat, &pFinal );
-            printf( "AnalyzeFinal returned %d (out of %d).\n", nFinal, Vec_IntSize(vSupp) );
+            Acb_EcoPrintf( "AnalyzeFinal returned %d (out of %d).\n", nFinal, Vec_IntSize(vSupp) );
         }
 
         // remap them into numbers
@@ -1866,7 +1913,7 @@ char * Acb_EnumerateSatAssigns( sat_solver * pSat, int PivotVar, int FreeVar, Ve
         {
             if ( Vec_IntSize(vDivVars) == 0 )
             {
-                printf( "Assuming constant 0 function.\n" );
+                Acb_EcoPrintf( "Assuming constant 0 function.\n" );
                 Vec_StrClear( vTempSop );
                 Vec_StrPush( vTempSop, ' ' );
                 Vec_StrPush( vTempSop, '0' );
@@ -1875,7 +1922,7 @@ char * Acb_EnumerateSatAssigns( sat_solver * pSat, int PivotVar, int FreeVar, Ve
                 return Vec_StrReleaseArray(vTempSop);
             }
 
-            printf( "Reached the limit on the number of cubes (1000).\n" );
+            Acb_EcoPrintf( "Reached the limit on the number of cubes (1000).\n" );
             Vec_IntFree( vTemp );
             Vec_IntFree( vLits );
             return NULL;
@@ -1885,7 +1932,7 @@ char * Acb_EnumerateSatAssigns( sat_solver * pSat, int PivotVar, int FreeVar, Ve
         status = sat_solver_solve( pSat, pLits, pLits + 2, 0, 0, 0, 0 );
         if ( status == l_False )
         {
-            printf( "Finished enumerating %d cubes.\n", iMint );
+            Acb_EcoPrintf( "Finished enumerating %d cubes.\n", iMint );
             Vec_IntFree( vTemp );
             Vec_IntFree( vLits );
             Vec_StrPush( vTempSop, '\0' );
@@ -1929,7 +1976,7 @@ char * Acb_EnumerateSatAssigns( sat_solver * pSat, int PivotVar, int FreeVar, Ve
             // expand against offset
             status = sat_solver_solve( pSat, Vec_IntArray(vTempLits), Vec_IntLimit(vTempLits), 0, 0, 0, 0 );
             if ( status != l_False )
-                printf( "Selected onset minterm number %d belongs to the offset (this is a bug).\n", iMint );
+                Acb_EcoPrintf( "Selected onset minterm number %d belongs to the offset (this is a bug).\n", iMint );
             assert( status == l_False );
 
             // compute cube and add clause
@@ -2649,6 +2696,34 @@ Cnf_Dat_t * Acb_NtkDeriveMiterCnf( Gia_Man_t * p, int iTar, int nTars, int fVerb
     Gia_ManStop( pCof );
     return pCnf;
 }
+Cnf_Dat_t * Acb_NtkDeriveMiterCnfCone( Gia_Man_t * p, int iTar, int nTars )
+{
+    Gia_Man_t * pCof = Gia_ManDup( p ), * pTemp;
+    Vec_Bit_t * vUsed = Vec_BitStart( nTars );
+    Cnf_Dat_t * pCnf; int v;
+    // quantification is skipped for the targets outside of the cone
+    Gia_ManCreateRefs( pCof );
+    for ( v = 0; v < iTar; v++ )
+        if ( Gia_ObjRefNum(pCof, Gia_ManCi(pCof, Gia_ManCiNum(pCof) - nTars + v)) )
+            Vec_BitWriteEntry( vUsed, v, 1 );
+    ABC_FREE( pCof->pRefs );
+    for ( v = 0; v < iTar; v++ )
+    {
+        if ( !Vec_BitEntry(vUsed, v) )
+            continue;
+        pCof = Gia_ManDupUniv( pTemp = pCof, Gia_ManCiNum(pCof) - nTars + v );
+        Gia_ManStop( pTemp );
+        pCof = Gia_ManAigSyn2( pTemp = pCof, 0, 1, 0, 100, 0, 0, 0 );
+        Gia_ManStop( pTemp );
+        if ( Gia_ManAndNum(pCof) > 10000 )
+            Acb_EcoPrintf( "Quantifying target %3d : And = %d.\n", v, Gia_ManAndNum(pCof) );
+        assert( Gia_ManCiNum(pCof) == Gia_ManCiNum(p) );
+    }
+    pCnf = (Cnf_Dat_t *)Mf_ManGenerateCnf( pCof, 8, 0, 0, 0, 0 );
+    Gia_ManStop( pCof );
+    Vec_BitFree( vUsed );
+    return pCnf;
+}
 Gia_Man_t * Gia_ManInterOneInt( Gia_Man_t * pCof1, Gia_Man_t * pCof0, int Depth )
 {
     extern Gia_Man_t * Gia_ManInterOne( Gia_Man_t * pNtkOn, Gia_Man_t * pNtkOff, int fVerbose );
@@ -2860,6 +2935,298 @@ Vec_Ptr_t * Acb_TransformPatchFunctions( Vec_Ptr_t * vSops, Vec_Wec_t * vSupps,
     return vFuncs;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Groups the targets whose output cones overlap.]
+
+  Description [Returns the clusters of target indices. The targets of
+  different clusters affect disjoint sets of roots, so their patches can
+  be computed independently. The positions of the roots of each cluster
+  are returned in the second array.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Acb_NtkEcoFindRepr( Vec_Int_t * vParents, int i )
+{
+    while ( Vec_IntEntry(vParents, i) != i )
+    {
+        Vec_IntWriteEntry( vParents, i, Vec_IntEntry(vParents, Vec_IntEntry(vParents, i)) );
+        i = Vec_IntEntry( vParents, i );
+    }
+    return i;
+}
+Vec_Wec_t * Acb_NtkEcoClusters( Acb_Ntk_t * p, Vec_Int_t * vRoots, Vec_Wec_t ** pvRootSets )
+{
+    int nTargets = Vec_IntSize(&p->vTargets);
+    Vec_Int_t * vParents  = Vec_IntStartNatural( nTargets );
+    Vec_Int_t * vRoot2Pos = Vec_IntStartFull( Acb_NtkCoNum(p) );
+    Vec_Int_t * vRoot2Tar = Vec_IntStartFull( Vec_IntSize(vRoots) );
+    Vec_Int_t * vRepr2Clu = Vec_IntStartFull( nTargets );
+    Vec_Int_t * vOne = Vec_IntAlloc( 1 ), * vRootsOne;
+    Vec_Wec_t * vClusters = Vec_WecAlloc( nTargets );
+    Vec_Bit_t * vBlock;
+    int i, k, iRoot, iPos, iRepr;
+    Vec_IntForEachEntry( vRoots, iRoot, i )
+        Vec_IntWriteEntry( vRoot2Pos, iRoot, i );
+    for ( i = 0; i < nTargets; i++ )
+    {
+        Vec_IntFill( vOne, 1, Vec_IntEntry(&p->vTargets, i) );
+        vRootsOne = Acb_NtkFindRoots( p, vOne, &vBlock );
+        Vec_IntForEachEntry( vRootsOne, iRoot, k )
+        {
+            iPos = Vec_IntEntry( vRoot2Pos, iRoot );
+            assert( iPos >= 0 );
+            if ( Vec_IntEntry(vRoot2Tar, iPos) == -1 )
+                Vec_IntWriteEntry( vRoot2Tar, iPos, i );
+            else
+                Vec_IntWriteEntry( vParents, Acb_NtkEcoFindRepr(vParents, i), Acb_NtkEcoFindRepr(vParents, Vec_IntEntry(vRoot2Tar, iPos)) );
+        }
+        Vec_IntFree( vRootsOne );
+        Vec_BitFree( vBlock );
+    }
+    for ( i = 0; i < nTargets; i++ )
+    {
+        iRepr = Acb_NtkEcoFindRepr( vParents, i );
+        if ( Vec_IntEntry(vRepr2Clu, iRepr) == -1 )
+        {
+            Vec_IntWriteEntry( vRepr2Clu, iRepr, Vec_WecSize(vClusters) );
+            Vec_WecPushLevel( vClusters );
+        }
+        Vec_WecPush( vClusters, Vec_IntEntry(vRepr2Clu, iRepr), i );
+    }
+    *pvRootSets = Vec_WecStart( Vec_WecSize(vClusters) );
+    Vec_IntForEachEntry( vRoot2Tar, i, iPos )
+        if ( i >= 0 )
+            Vec_WecPush( *pvRootSets, Vec_IntEntry(vRepr2Clu, Acb_NtkEcoFindRepr(vParents, i)), iPos );
+    Vec_IntFree( vParents );
+    Vec_IntFree( vRoot2Pos );
+    Vec_IntFree( vRoot2Tar );
+    Vec_IntFree( vRepr2Clu );
+    Vec_IntFree( vOne );
+    return vClusters;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the patches of the clusters of targets concurrently.]
+
+  Description [Each worker solves the targets of one cluster in the same
+  order as the sequential computation, using its own miter restricted
+  to the roots of the cluster and its own SAT solvers. The structural
+  data (roots, divisors, AIGs of the networks) is computed once and
+  shared by the workers. Only the SAT-based support and function
+  computation runs concurrently, while restructuring of the miters is
+  serialized. The support and function computation is safe without the
+  lock: each call creates its own SAT solver from the CNF of the worker,
+  and the shared data it reads (the divisors and the object weights of
+  pNtkF used by Acb_DeriveWeights) is not modified while the workers
+  run. Unlike the sequential computation, the targets outside of the
+  cone of the cluster miter are not quantified. The output of each
+  worker is buffered and printed after all of them finish. The patches
+  are inserted into the original miter in the order of targets. Returns 1 if the patches are found, 0 if failed, and -1
+  if the targets form one cluster.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+typedef struct Acb_EcoShare_t_ Acb_EcoShare_t;
+struct Acb_EcoShare_t_
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t  Mutex;          // serializes miter restructuring
+#endif
+    volatile int     fStop;          // set when one of the workers fails
+    abctime          clkStart;       // the starting time
+    int              nTimeout;       // the total runtime limit
+    int              TimeOut;        // the runtime limit of support computation
+    int              nTargets;       // the number of targets
+    Acb_Ntk_t *      pNtkF;          // the implementation
+    Vec_Int_t *      vDivs;          // the divisors
+    char **          pSops;          // the patch of each target
+    Vec_Int_t **     pSupps;         // the support of each target
+};
+typedef struct Acb_EcoWorker_t_ Acb_EcoWorker_t;
+struct Acb_EcoWorker_t_
+{
+    Acb_EcoShare_t * pShare;         // the shared state
+    Gia_Man_t *      pGiaM;          // the miter of this cluster
+    Vec_Int_t *      vTars;          // the targets of this cluster
+    Vec_Str_t *      vLog;           // the output printed by this worker
+};
+static inline void Acb_EcoShareLock( Acb_EcoShare_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    int status = pthread_mutex_lock( &p->Mutex );  assert( status == 0 );
+#endif
+}
+static inline void Acb_EcoShareUnlock( Acb_EcoShare_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    int status = pthread_mutex_unlock( &p->Mutex );  assert( status == 0 );
+#endif
+}
+int Acb_NtkEcoWorkerThread( void * pArg )
+{
+    extern Gia_Man_t * Abc_SopSynthesizeOne( char * pSop, int fClp );
+    Acb_EcoWorker_t * pWorker = (Acb_EcoWorker_t *)pArg;
+    Acb_EcoShare_t * p = pWorker->pShare;
+    Vec_Int_t * vSuppOld = Vec_IntAlloc( 100 ), * vSupp;
+    Gia_Man_t * pTemp, * pOne;
+    Cnf_Dat_t * pCnf;
+    char * pSop;
+    int k, iTar;
+    s_vEcoLog = pWorker->vLog;
+    Vec_IntForEachEntryReverse( pWorker->vTars, iTar, k )
+    {
+        if ( p->fStop )
+            break;
+        Acb_EcoShareLock( p );
+        pCnf = Acb_NtkDeriveMiterCnfCone( pWorker->pGiaM, iTar, p->nTargets );
+        Acb_EcoShareUnlock( p );
+        // reads only the shared divisors and weights, which stay unchanged
+        vSupp = Acb_DerivePatchSupport( pCnf, iTar, p->nTargets, Vec_IntSize(p->vDivs), p->vDivs, p->pNtkF, vSuppOld, p->TimeOut );
+        if ( vSupp == NULL )
+        {
+            Cnf_DataFree( pCnf );
+            p->fStop = 1;
+            break;
+        }
+        Vec_IntAppend( vSuppOld, vSupp );
+        Vec_IntClear( vSupp );
+        Vec_IntAppend( vSupp, vSuppOld );
+        // derive function of this target
+        pSop = Acb_DeriveOnePatchFunction( pCnf, iTar, p->nTargets, Vec_IntSize(p->vDivs), vSupp, 0 );
+        Cnf_DataFree( pCnf );
+        if ( pSop == NULL || (p->nTimeout && (Abc_Clock() - p->clkStart)/CLOCKS_PER_SEC >= p->nTimeout) )
+        {
+            Vec_IntFree( vSupp );
+            ABC_FREE( pSop );
+            p->fStop = 1;
+            break;
+        }
+        p->pSops[iTar]  = pSop;
+        p->pSupps[iTar] = vSupp;
+        // update the miter of this cluster
+        Acb_EcoShareLock( p );
+        pOne = Abc_SopSynthesizeOne( pSop, 1 );
+        pWorker->pGiaM = Acb_UpdateMiter( pTemp = pWorker->pGiaM, pOne, iTar, p->nTargets, vSupp, 0 );
+        Acb_EcoShareUnlock( p );
+        Gia_ManStop( pTemp );
+        Gia_ManStop( pOne );
+    }
+    Vec_IntFree( vSuppOld );
+    s_vEcoLog = NULL;
+    return 1;
+}
+int Acb_NtkEcoPerformPar( Acb_Ntk_t * pNtkF, Gia_Man_t * pGiaF, Gia_Man_t * pGiaG, Gia_Man_t ** ppGiaM, Vec_Int_t * vRoots, Vec_Int_t * vDivs, 
+                          Vec_Ptr_t * vSops, Vec_Wec_t * vSupps, int nProcs, int nTimeout, int TimeOut, abctime clkStart, int fVerbose )
+{
+    extern Gia_Man_t * Abc_SopSynthesizeOne( char * pSop, int fClp );
+    int nTargets = Vec_IntSize(&pNtkF->vTargets);
+    Vec_Wec_t * vRootSets, * vClusters = Acb_NtkEcoClusters( pNtkF, vRoots, &vRootSets );
+    Acb_EcoShare_t Share, * p = &Share;
+    Acb_EcoWorker_t * pWorkers;
+    Vec_Ptr_t * vWorkers;
+    Vec_Bit_t * vMask;
+    Vec_Int_t * vLevel;
+    Gia_Man_t * pTemp, * pOne;
+    int i, k, iPos, RetValue = 1;
+    if ( Vec_WecSize(vClusters) == 1 )
+    {
+        Vec_WecFree( vClusters );
+        Vec_WecFree( vRootSets );
+        return -1;
+    }
+    printf( "Computing patches for %d independent clusters of targets using %d workers.\n", Vec_WecSize(vClusters), nProcs );
+    // prepare the shared state
+    memset( p, 0, sizeof(Acb_EcoShare_t) );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_init( &p->Mutex, NULL );
+#endif
+    p->clkStart = clkStart;
+    p->nTimeout = nTimeout;
+    p->TimeOut  = TimeOut;
+    p->nTargets = nTargets;
+    p->pNtkF    = pNtkF;
+    p->vDivs    = vDivs;
+    p->pSops    = ABC_CALLOC( char *, nTargets );
+    p->pSupps   = ABC_CALLOC( Vec_Int_t *, nTargets );
+    // prepare the workers
+    pWorkers = ABC_CALLOC( Acb_EcoWorker_t, Vec_WecSize(vClusters) );
+    vWorkers = Vec_PtrAlloc( Vec_WecSize(vClusters) );
+    vMask = Vec_BitStart( Vec_IntSize(vRoots) );
+    Vec_WecForEachLevel( vClusters, vLevel, i )
+    {
+        Vec_BitReset( vMask );
+        Vec_IntForEachEntry( Vec_WecEntry(vRootSets, i), iPos, k )
+            Vec_BitWriteEntry( vMask, iPos, 1 );
+        pWorkers[i].pShare = p;
+        pWorkers[i].pGiaM  = Acb_CreateMiterRoots( pGiaF, pGiaG, vMask );
+        pWorkers[i].vTars  = vLevel;
+        pWorkers[i].vLog   = Vec_StrAlloc( 1000 );
+        Vec_PtrPush( vWorkers, pWorkers + i );
+        if ( fVerbose )
+        {
+            printf( "Cluster %3d : Targets = %3d.  Roots = %4d.  ", i, Vec_IntSize(vLevel), Vec_IntSize(Vec_WecEntry(vRootSets, i)) );
+            Gia_ManPrintStats( pWorkers[i].pGiaM, NULL );
+        }
+    }
+    Vec_BitFree( vMask );
+    Util_ProcessThreads( Acb_NtkEcoWorkerThread, vWorkers, nProcs + 1, 0, 0 );
+    // print the output of the workers in the order of clusters
+    for ( i = 0; i < Vec_WecSize(vClusters); i++ )
+    {
+        if ( Vec_StrSize(pWorkers[i].vLog) == 0 )
+            continue;
+        Vec_StrPush( pWorkers[i].vLog, '\0' );
+        printf( "Cluster %3d :\n%s", i, Vec_StrArray(pWorkers[i].vLog) );
+    }
+    // insert the patches into the miter in the order of the sequential computation
+    for ( i = nTargets-1; i >= 0; i-- )
+    {
+        if ( p->fStop || p->pSops[i] == NULL )
+        {
+            RetValue = 0;
+            break;
+        }
+        pOne = Abc_SopSynthesizeOne( p->pSops[i], 1 );
+        printf( "Tar%02d: ", i );
+        Gia_ManPrintStats( pOne, NULL );
+        *ppGiaM = Acb_UpdateMiter( pTemp = *ppGiaM, pOne, i, nTargets, p->pSupps[i], 0 );
+        Gia_ManStop( pTemp );
+        Gia_ManStop( pOne );
+        Vec_PtrPush( vSops, p->pSops[i] );
+        Vec_IntAppend( Vec_WecPushLevel(vSupps), p->pSupps[i] );
+        p->pSops[i] = NULL;
+    }
+    // cleanup
+    for ( i = 0; i < nTargets; i++ )
+    {
+        ABC_FREE( p->pSops[i] );
+        Vec_IntFreeP( &p->pSupps[i] );
+    }
+    for ( i = 0; i < Vec_WecSize(vClusters); i++ )
+    {
+        Gia_ManStop( pWorkers[i].pGiaM );
+        Vec_StrFree( pWorkers[i].vLog );
+    }
+    ABC_FREE( pWorkers );
+    Vec_PtrFree( vWorkers );
+    ABC_FREE( p->pSops );
+    ABC_FREE( p->pSupps );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_destroy( &p->Mutex );
+#endif
+    Vec_WecFree( vClusters );
+    Vec_WecFree( vRootSets );
+    return RetValue;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Performs ECO for two networks.]
@@ -2871,7 +3238,7 @@ Vec_Ptr_t * Acb_TransformPatchFunctions( Vec_Ptr_t * vSops, Vec_Wec_t * vSupps,
   SeeAlso     []
 
 ***********************************************************************/
-int Acb_NtkEcoPerform( Acb_Ntk_t * pNtkF, Acb_Ntk_t * pNtkG, char * pFileName[4], int nTimeout, int fCisOnly, int fInputs, int fCheck, int fUnitW, int fVerbose, int fVeryVerbose )
+int Acb_NtkEcoPerform( Acb_Ntk_t * pNtkF, Acb_Ntk_t * pNtkG, char * pFileName[4], int nTimeout, int nProcs, int fCisOnly, int fInputs, int fCheck, int fUnitW, int fVerbose, int fVeryVerbose )
 {
     extern Gia_Man_t * Abc_SopSynthesizeOne( char * pSop, int fClp );
 
@@ -2908,7 +3275,7 @@ int Acb_NtkEcoPerform( Acb_Ntk_t * pNtkF, Acb_Ntk_t * pNtkG, char * pFileName[4]
     Vec_Str_t * vInst  = NULL, * vPatch = NULL;
 
     char * pSop = NULL;
-    int i;
+    int i, fDone = 0;
 
 //    int Value = Acb_NtkSaveNames( pNtkF, vSupp, vNodesF, vRoots, vDivs, &pNtkF->vTargets, pGiaF ); 
 //    Gia_AigerWrite( pGiaF, pFileBase, 0, 0, 0 );
@@ -2948,7 +3315,20 @@ int Acb_NtkEcoPerform( Acb_Ntk_t * pNtkF, Acb_Ntk_t * pNtkG, char * pFileName[4]
         }
     }
 
-    for ( i = nTargets-1; i >= 0; i-- )
+    // compute the patches of independent clusters of targets concurrently
+    if ( nProcs > 1 && !fCisOnly && nTargets > 1 )
+    {
+        fDone = Acb_NtkEcoPerformPar( pNtkF, pGiaF, pGiaG, &pGiaM, vRoots, vDivs, vSops, vSupps, nProcs, nTimeout, TimeOut, clkStart, fVerbose );
+        if ( fDone == 0 )
+        {
+            printf( "The concurrent computation of patches did not succeed.\n" );
+            RetValue = 0;
+            goto cleanup;
+        }
+        fDone = (fDone == 1);
+    }
+
+    for ( i = nTargets-1; i >= 0 && !fDone; i-- )
     {
         Vec_Int_t * vSupp = NULL;
         printf( "\nConsidering target %d (out of %d)...\n", i, nTargets );
@@ -3137,7 +3517,7 @@ void Acb_NtkTestRun2( char * pFileNames[3], int fVerbose )
   SeeAlso     []
 
 ***********************************************************************/
-void Acb_NtkRunEco( char * pFileNames[4], int nTimeout, int fCheck, int fRandom, int fInputs, int fUnitW, int fVerbose, int fVeryVerbose )
+void Acb_NtkRunEco( char * pFileNames[4], int nTimeout, int nProcs, int fCheck, int fRandom, int fInputs, int fUnitW, int fVerbose, int fVeryVerbose )
 {
     char Command[1000]; int Result = 1;
     Acb_Ntk_t * pNtkF = Acb_VerilogSimpleRead( pFileNames[0], pFileNames[2] );
@@ -3159,10 +3539,10 @@ void Acb_NtkRunEco( char * pFileNames[4], int nTimeout, int fCheck, int fRandom,
 
     Acb_IntallLibrary( Abc_FrameReadSignalNames() != NULL );
 
-    if ( !Acb_NtkEcoPerform( pNtkF, pNtkG, pFileNames, nTimeout, 0, fInputs, fCheck, fUnitW, fVerbose, fVeryVerbose ) )
+    if ( !Acb_NtkEcoPerform( pNtkF, pNtkG, pFileNames, nTimeout, nProcs, 0, fInputs, fCheck, fUnitW, fVerbose, fVeryVerbose ) )
     {
 //        printf( "General computation timed out. Trying inputs only.\n\n" );
-//        if ( !Acb_NtkEcoPerform( pNtkF, pNtkG, pFileNames, nTimeout, 1, fInputs, fCheck, fUnitW, fVerbose, fVeryVerbose ) )
+//        if ( !Acb_NtkEcoPerform( pNtkF, pNtkG, pFileNames, nTimeout, 0, 1, fInputs, fCheck, fUnitW, fVerbose, fVeryVerbose ) )
 //            printf( "Input-only computation also timed out.\n\n" );
         printf( "Computation did not succeed.\n" );
         Result = 0;
@@ -45,6 +45,7 @@ static int IoCommandReadBlif    ( Abc_Frame_t * pAbc, int argc, char **argv );
 static int IoCommandReadBlifMv  ( Abc_Frame_t * pAbc, int argc, char **argv );
 static int IoCommandReadBench   ( Abc_Frame_t * pAbc, int argc, char **argv );
 static int IoCommandReadCex     ( Abc_Frame_t * pAbc, int argc, char **argv );
+static int IoCommandReadCexes   ( Abc_Frame_t * pAbc, int argc, char **argv );
 static int IoCommandReadDsd     ( Abc_Frame_t * pAbc, int argc, char **argv );
 static int IoCommandReadEdif    ( Abc_Frame_t * pAbc, int argc, char **argv );
 static int IoCommandReadEqn     ( Abc_Frame_t * pAbc, int argc, char **argv );
@@ -80,6 +81,7 @@ static int IoCommandWriteCellNet( Abc_Frame_t * pAbc, int argc, char **argv );
 static int IoCommandWriteCnf    ( Abc_Frame_t * pAbc, int argc, char **argv );
 static int IoCommandWriteCnf2   ( Abc_Frame_t * pAbc, int argc, char **argv );
 static int IoCommandWriteCex    ( Abc_Frame_t * pAbc, int argc, char **argv );
+static int IoCommandWriteCexes  ( Abc_Frame_t * pAbc, int argc, char **argv );
 static int IoCommandWriteDot    ( Abc_Frame_t * pAbc, int argc, char **argv );
 static int IoCommandWriteEqn    ( Abc_Frame_t * pAbc, int argc, char **argv );
 static int IoCommandWriteGml    ( Abc_Frame_t * pAbc, int argc, char **argv );
@@ -127,6 +129,7 @@ void Io_Init( Abc_Frame_t * pAbc )
     Cmd_CommandAdd( pAbc, "I/O", "read_blif_mv",  IoCommandReadBlifMv,   1 );
     Cmd_CommandAdd( pAbc, "I/O", "read_bench",    IoCommandReadBench,    1 );
     Cmd_CommandAdd( pAbc, "I/O", "read_cex",      IoCommandReadCex,      1 );
+    Cmd_CommandAdd( pAbc, "I/O", "read_cexes",    IoCommandReadCexes,    0 );
     Cmd_CommandAdd( pAbc, "I/O", "read_formula",  IoCommandReadDsd,      1 );
 //    Cmd_CommandAdd( pAbc, "I/O", "read_edif",     IoCommandReadEdif,     1 );
     Cmd_CommandAdd( pAbc, "I/O", "read_eqn",      IoCommandReadEqn,      1 );
@@ -158,6 +161,7 @@ void Io_Init( Abc_Frame_t * pAbc )
     Cmd_CommandAdd( pAbc, "I/O", "write_book",    IoCommandWriteBook,    0 );
     Cmd_CommandAdd( pAbc, "I/O", "write_cellnet", IoCommandWriteCellNet, 0 );
     Cmd_CommandAdd( pAbc, "I/O", "write_cex",     IoCommandWriteCex,     0 );
+    Cmd_CommandAdd( pAbc, "I/O", "write_cexes",   IoCommandWriteCexes,   0 );
     Cmd_CommandAdd( pAbc, "I/O", "write_cnf",     IoCommandWriteCnf,     0 );
     Cmd_CommandAdd( pAbc, "I/O", "&write_cnf",    IoCommandWriteCnf2,    0 );
     Cmd_CommandAdd( pAbc, "I/O", "write_dot",     IoCommandWriteDot,     0 );
@@ -1031,6 +1035,105 @@ usage:
     fprintf( pAbc->Err, "\tfile   : the name of a file to read\n" );
     return 1;
 }
+
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int IoCommandReadCexes( Abc_Frame_t * pAbc, int argc, char ** argv )
+{
+    Abc_CexStore_t * pStore;
+    Abc_Cex_t * pCex;
+    Vec_Ptr_t * vCexes;
+    char * pFileName;
+    int iPo = -1;
+    int fVerbose = 0;
+    int c;
+
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "Ovh" ) ) != EOF )
+    {
+        switch ( c )
+        {
+            case 'O':
+                if ( globalUtilOptind >= argc )
+                {
+                    fprintf( pAbc->Err, "Command line switch \"-O\" should be followed by an integer.\n" );
+                    goto usage;
+                }
+                iPo = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if ( iPo < 0 )
+                    goto usage;
+                break;
+            case 'v':
+                fVerbose ^= 1;
+                break;
+            case 'h':
+                goto usage;
+            default:
+                goto usage;
+        }
+    }
+    if ( argc != globalUtilOptind + 1 )
+        goto usage;
+
+    // get the input file name
+    pFileName = argv[globalUtilOptind];
+    pStore = Abc_CexStoreOpen( pFileName );
+    if ( pStore == NULL )
+    {
+        fprintf( pAbc->Err, "Cannot read counter-examples from file \"%s\".\n", pFileName );
+        return 1;
+    }
+    if ( fVerbose )
+        Abc_CexStorePrintStats( pStore );
+    if ( iPo >= 0 )
+    {
+        // restore the counter-example of one output without decoding the others
+        if ( iPo >= Abc_CexStorePoNum(pStore) )
+        {
+            fprintf( pAbc->Err, "Output %d is out of range (the file has %d outputs).\n", iPo, Abc_CexStorePoNum(pStore) );
+            Abc_CexStoreFree( pStore );
+            return 1;
+        }
+        pCex = Abc_CexStoreGet( pStore, iPo );
+        Abc_CexStoreFree( pStore );
+        if ( pCex == NULL )
+        {
+            fprintf( pAbc->Out, "Output %d does not have a counter-example.\n", iPo );
+            return 0;
+        }
+        Abc_FrameClearVerifStatus( pAbc );
+        pAbc->Status  = 0;
+        pAbc->nFrames = pCex->iFrame;
+        Abc_FrameReplaceCex( pAbc, &pCex );
+        return 0;
+    }
+    vCexes = Abc_CexStoreToArray( pStore );
+    Abc_CexStoreFree( pStore );
+    Abc_FrameClearVerifStatus( pAbc );
+    pAbc->Status  = 0;
+    pAbc->nFrames = -1;
+    Abc_FrameReplaceCexVec( pAbc, &vCexes );
+    return 0;
+
+usage:
+    fprintf( pAbc->Err, "usage: read_cexes [-O num] [-vh] <file>\n" );
+    fprintf( pAbc->Err, "\t         reads counter-examples of several outputs written by \"write_cexes\"\n" );
+    fprintf( pAbc->Err, "\t-O num : read only the counter-example of this output [default = %s]\n", iPo >= 0 ? "given" : "all" );
+    fprintf( pAbc->Err, "\t-v     : toggle printing the statistics [default = %s]\n", fVerbose? "yes":"no" );
+    fprintf( pAbc->Err, "\t-h     : prints the command summary\n" );
+    fprintf( pAbc->Err, "\tfile   : the name of a file to read\n" );
+    return 1;
+}
 /**Function*************************************************************
 
   Synopsis    []
@@ -2824,19 +2927,32 @@ int IoCommandWriteCnf( Abc_Frame_t * pAbc, int argc, char **argv )
     int fFastAlgo;
     int fAllPrimes;
     int fChangePol;
+    int nProcs;
     int fVerbose;
-    extern Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo, int fChangePol, int fVerbose );
+    extern Abc_Ntk_t * Abc_NtkDarToCnf( Abc_Ntk_t * pNtk, char * pFileName, int fFastAlgo, int fChangePol, int nProcs, int fVerbose );
 
     fNewAlgo = 1;
     fFastAlgo = 0;
     fAllPrimes = 0;
     fChangePol = 1;
+    nProcs = 1;
     fVerbose = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "nfpcvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "Pnfpcvh" ) ) != EOF )
     {
         switch ( c )
         {
+            case 'P':
+                if ( globalUtilOptind >= argc )
+                {
+                    Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                    goto usage;
+                }
+                nProcs = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if ( nProcs < 1 || nProcs > 100 )
+                    goto usage;
+                break;
             case 'n':
                 fNewAlgo ^= 1;
                 break;
@@ -2875,9 +2991,9 @@ int IoCommandWriteCnf( Abc_Frame_t * pAbc, int argc, char **argv )
     }
     // call the corresponding file writer
     if ( fFastAlgo )
-        Abc_NtkDarToCnf( pAbc->pNtkCur, pFileName, 1, fChangePol, fVerbose );
+        Abc_NtkDarToCnf( pAbc->pNtkCur, pFileName, 1, fChangePol, 1, fVerbose );
     else if ( fNewAlgo )
-        Abc_NtkDarToCnf( pAbc->pNtkCur, pFileName, 0, fChangePol, fVerbose );
+        Abc_NtkDarToCnf( pAbc->pNtkCur, pFileName, 0, fChangePol, nProcs, fVerbose );
     else if ( fAllPrimes )
         Io_WriteCnf( pAbc->pNtkCur, pFileName, 1 );
     else
@@ -2885,8 +3001,9 @@ int IoCommandWriteCnf( Abc_Frame_t * pAbc, int argc, char **argv )
     return 0;
 
 usage:
-    fprintf( pAbc->Err, "usage: write_cnf [-nfpcvh] <file>\n" );
+    fprintf( pAbc->Err, "usage: write_cnf [-P num] [-nfpcvh] <file>\n" );
     fprintf( pAbc->Err, "\t         generates CNF for the miter (see also \"&write_cnf\")\n" );
+    fprintf( pAbc->Err, "\t-P num : the number of threads writing the clauses (1 <= num <= 100) [default = %d]\n", nProcs );
     fprintf( pAbc->Err, "\t-n     : toggle using new algorithm [default = %s]\n", fNewAlgo? "yes" : "no" );
     fprintf( pAbc->Err, "\t-f     : toggle using fast algorithm [default = %s]\n", fFastAlgo? "yes" : "no" );
     fprintf( pAbc->Err, "\t-p     : toggle using all primes to enhance implicativity [default = %s]\n", fAllPrimes? "yes" : "no" );
@@ -2911,16 +3028,17 @@ usage:
 int IoCommandWriteCnf2( Abc_Frame_t * pAbc, int argc, char **argv )
 {
     extern void Jf_ManDumpCnf( Gia_Man_t * p, char * pFileName, int fVerbose );
-    extern void Mf_ManDumpCnf( Gia_Man_t * p, char * pFileName, int nLutSize, int fCnfObjIds, int fAddOrCla, int fVerbose );
+    extern void Mf_ManDumpCnf( Gia_Man_t * p, char * pFileName, int nLutSize, int fCnfObjIds, int fAddOrCla, int nProcs, int fVerbose );
     FILE * pFile;
     char * pFileName;
     int nLutSize    = 8;
     int fNewAlgo    = 1;
     int fCnfObjIds  = 0;
     int fAddOrCla   = 1;
+    int nProcs      = 1;
     int c, fVerbose = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "Kaiovh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "KPaiovh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -2933,6 +3051,17 @@ int IoCommandWriteCnf2( Abc_Frame_t * pAbc, int argc, char **argv )
                 nLutSize = atoi(argv[globalUtilOptind]);
                 globalUtilOptind++;
                 break;
+            case 'P':
+                if ( globalUtilOptind >= argc )
+                {
+                    Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                    goto usage;
+                }
+                nProcs = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if ( nProcs < 1 || nProcs > 100 )
+                    goto usage;
+                break;
             case 'a':
                 fNewAlgo ^= 1;
                 break;
@@ -2983,15 +3112,16 @@ int IoCommandWriteCnf2( Abc_Frame_t * pAbc, int argc, char **argv )
     }
     fclose( pFile );
     if ( fNewAlgo )
-        Mf_ManDumpCnf( pAbc->pGia, pFileName, nLutSize, fCnfObjIds, fAddOrCla, fVerbose );
+        Mf_ManDumpCnf( pAbc->pGia, pFileName, nLutSize, fCnfObjIds, fAddOrCla, nProcs, fVerbose );
     else
         Jf_ManDumpCnf( pAbc->pGia, pFileName, fVerbose );
     return 0;
 
 usage:
-    fprintf( pAbc->Err, "usage: &write_cnf [-Kaiovh] <file>\n" );
+    fprintf( pAbc->Err, "usage: &write_cnf [-KP num] [-aiovh] <file>\n" );
     fprintf( pAbc->Err, "\t           writes CNF produced by a new generator\n" );
     fprintf( pAbc->Err, "\t-K <num> : the LUT size (3 <= num <= 8) [default = %d]\n", nLutSize );
+    fprintf( pAbc->Err, "\t-P <num> : the number of threads writing the clauses (1 <= num <= 100) [default = %d]\n", nProcs );
     fprintf( pAbc->Err, "\t-a       : toggle using new algorithm [default = %s]\n", fNewAlgo? "yes" : "no" );
     fprintf( pAbc->Err, "\t-i       : toggle using AIG object IDs as CNF variables [default = %s]\n", fCnfObjIds? "yes" : "no" );
     fprintf( pAbc->Err, "\t-o       : toggle adding OR clause for the outputs [default = %s]\n", fAddOrCla? "yes" : "no" );
@@ -3456,6 +3586,106 @@ usage:
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int IoCommandWriteCexes( Abc_Frame_t * pAbc, int argc, char **argv )
+{
+    Abc_CexStore_t * pStore;
+    Abc_Cex_t * pCex = NULL;
+    Vec_Ptr_t * vCexes, * vCares = NULL;
+    char * pFileName;
+    int i, c, nPos;
+    int fMinimize = 0;
+    int fVerbose = 0;
+
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "mvh" ) ) != EOF )
+    {
+        switch ( c )
+        {
+            case 'm':
+                fMinimize ^= 1;
+                break;
+            case 'v':
+                fVerbose ^= 1;
+                break;
+            case 'h':
+                goto usage;
+            default:
+                goto usage;
+        }
+    }
+    if ( argc != globalUtilOptind + 1 )
+        goto usage;
+    pFileName = argv[globalUtilOptind];
+
+    // collect the counter-examples indexed by the outputs
+    if ( pAbc->vCexVec )
+        vCexes = Vec_PtrDup( pAbc->vCexVec );
+    else if ( pAbc->pCex )
+    {
+        nPos = pAbc->pNtkCur ? Abc_NtkPoNum(pAbc->pNtkCur) : pAbc->pCex->iPo + 1;
+        vCexes = Vec_PtrStart( Abc_MaxInt(nPos, pAbc->pCex->iPo + 1) );
+        Vec_PtrWriteEntry( vCexes, pAbc->pCex->iPo, pAbc->pCex );
+    }
+    else
+    {
+        fprintf( pAbc->Out, "There is no counter-example to write.\n" );
+        return 0;
+    }
+    Vec_PtrForEachEntry( Abc_Cex_t *, vCexes, pCex, i )
+        if ( pCex && pCex != (Abc_Cex_t *)(ABC_PTRINT_T)1 )
+            break;
+    if ( i == Vec_PtrSize(vCexes) )
+    {
+        fprintf( pAbc->Out, "The counter-examples are not recorded.\n" );
+        Vec_PtrFree( vCexes );
+        return 0;
+    }
+    if ( fMinimize )
+    {
+        if ( pAbc->pGia == NULL )
+        {
+            fprintf( pAbc->Err, "Minimization requires the AIG in the &-space (run \"&get\").\n" );
+            Vec_PtrFree( vCexes );
+            return 1;
+        }
+        vCares = Bmc_CexCareMinimizeBatch( pAbc->pGia, vCexes, 1, 0, 0 );
+    }
+    pStore = Abc_CexStoreFromArray( vCexes, vCares, pCex->nRegs, pCex->nPis, pFileName );
+    if ( vCares )
+        Vec_PtrFreeFree( vCares );
+    Vec_PtrFree( vCexes );
+    if ( pStore == NULL )
+    {
+        fprintf( pAbc->Err, "Cannot open the output file \"%s\".\n", pFileName );
+        return 1;
+    }
+    if ( fVerbose )
+        Abc_CexStorePrintStats( pStore );
+    Abc_CexStoreFree( pStore );
+    return 0;
+
+usage:
+    fprintf( pAbc->Err, "usage: write_cexes [-mvh] <file>\n" );
+    fprintf( pAbc->Err, "\t         saves counter-examples of several outputs in a compact form\n" );
+    fprintf( pAbc->Err, "\t         the counter-examples with a common prefix are stored incrementally\n" );
+    fprintf( pAbc->Err, "\t-m     : minimize counter-examples by dropping don't-care values [default = %s]\n", fMinimize? "yes": "no" );
+    fprintf( pAbc->Err, "\t-v     : toggle printing the statistics [default = %s]\n", fVerbose? "yes": "no" );
+    fprintf( pAbc->Err, "\t-h     : print the help massage\n" );
+    fprintf( pAbc->Err, "\t<file> : the name of the file to write\n" );
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
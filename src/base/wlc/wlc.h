@@ -204,6 +204,8 @@ struct Wlc_Par_t_
     int                    (*pFuncStop)(int);  // callback to terminate
 };
 
+typedef struct Wlc_BstCache_t_ Wlc_BstCache_t;
+
 typedef struct Wlc_BstPar_t_ Wlc_BstPar_t;
 struct Wlc_BstPar_t_
 {
@@ -224,8 +226,10 @@ struct Wlc_BstPar_t_
     int                    fDecMuxes;
     int                    fSaveFfNames;
     int                    fBlastNew;
+    int                    nProcs;
     int                    fVerbose;
     Vec_Int_t *            vBoxIds;
+    Wlc_BstCache_t *       pCache;
 };
 
 static inline void Wlc_BstParDefault( Wlc_BstPar_t * pPar )
@@ -244,6 +248,7 @@ static inline void Wlc_BstParDefault( Wlc_BstPar_t * pPar )
     pPar->fCreateMiter =  0;
     pPar->fCreateWordMiter =  0;
     pPar->fDecMuxes    =  0;
+    pPar->nProcs       =  0;
     pPar->fVerbose     =  0;
 }
 
@@ -260,6 +265,7 @@ struct Wla_Man_t_
     Vec_Bit_t * vUnmark;
     void      * pPdrPars;
     void      * pThread;
+    Wlc_BstCache_t * pCache;
 
     int iCexFrame;
     int fNewAbs;
@@ -390,6 +396,8 @@ extern int            Wlc_NtkPdrAbs( Wlc_Ntk_t * p, Wlc_Par_t * pPars );
 /*=== wlcAbs2.c ========================================================*/
 extern int            Wlc_NtkAbsCore2( Wlc_Ntk_t * p, Wlc_Par_t * pPars );
 /*=== wlcBlast.c ========================================================*/
+extern Wlc_BstCache_t * Wlc_BstCacheStart();
+extern void           Wlc_BstCacheStop( Wlc_BstCache_t * p, int fVerbose );
 extern Gia_Man_t *    Wlc_NtkBitBlast( Wlc_Ntk_t * p, Wlc_BstPar_t * pPars );
 /*=== wlcCom.c ========================================================*/
 extern void           Wlc_SetNtk( Abc_Frame_t * pAbc, Wlc_Ntk_t * pNtk );
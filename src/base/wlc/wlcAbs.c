@@ -1400,8 +1400,12 @@ Aig_Man_t * Wla_ManBitBlast( Wla_Man_t * pWla, Wlc_Ntk_t * pAbs )
     int nDcFlops;
     Gia_Man_t * pTemp;
     Aig_Man_t * pAig;
+    Wlc_BstPar_t Par, * pPar = &Par;
 
-    pWla->pGia = Wlc_NtkBitBlast( pAbs, NULL );
+    // reuse the operators bit-blasted in the previous iterations
+    Wlc_BstParDefault( pPar );
+    pPar->pCache = pWla->pCache;
+    pWla->pGia = Wlc_NtkBitBlast( pAbs, pPar );
 
     // if the abstraction has flops with DC-init state,
     // new PIs were introduced by bit-blasting at the end of the PI list
@@ -1657,6 +1661,7 @@ Wla_Man_t * Wla_ManStart( Wlc_Ntk_t * pNtk, Wlc_Par_t * pPars )
     p->p = pNtk;
     p->pPars = pPars;
     p->vUnmark = Vec_BitStart( Wlc_NtkObjNumMax(pNtk) );
+    p->pCache = Wlc_BstCacheStart();
 
     pPdrPars = ABC_CALLOC( Pdr_Par_t, 1 );
     Pdr_ManSetDefaultParams( pPdrPars );
@@ -1691,6 +1696,7 @@ void Wla_ManStop( Wla_Man_t * p )
     if ( p->pGia )      Gia_ManStop( p->pGia );
     if ( p->pCex )      Abc_CexFree( p->pCex );
     Vec_BitFree( p->vUnmark );
+    Wlc_BstCacheStop( p->pCache, p->pPars->fVerbose );
     ABC_FREE( p->pPdrPars );
     ABC_FREE( p );
 }
@@ -1791,8 +1797,12 @@ int Wlc_NtkAbsCore( Wlc_Ntk_t * p, Wlc_Par_t * pPars )
     // start the bitmap to mark objects that cannot be abstracted because of refinement
     // currently, this bitmap is empty because abstraction begins without refinement
     Vec_Bit_t * vUnmark = Vec_BitStart( Wlc_NtkObjNumMax(p) );
+    // set up parameters to bit-blast, reusing the operators blasted in the previous iterations
+    Wlc_BstPar_t BstPars, * pBstPars = &BstPars;
     // set up parameters to run PDR
     Pdr_Par_t PdrPars, * pPdrPars = &PdrPars;
+    Wlc_BstParDefault( pBstPars );
+    pBstPars->pCache = Wlc_BstCacheStart();
     Pdr_ManSetDefaultParams( pPdrPars );
     //pPdrPars->fUseAbs    = 1;   // use 'pdr -t'  (on-the-fly abstraction)
     //pPdrPars->fCtgs      = 1;   // use 'pdr -nc' (improved generalization)
@@ -1829,7 +1839,7 @@ int Wlc_NtkAbsCore( Wlc_Ntk_t * p, Wlc_Par_t * pPars )
 
             pAbs = Wlc_NtkAbs( p, pPars, vUnmark, &vPisNew, NULL, pPars->fVerbose );
         }
-        pGia = Wlc_NtkBitBlast( pAbs, NULL );
+        pGia = Wlc_NtkBitBlast( pAbs, pBstPars );
 
         // if the abstraction has flops with DC-init state,
         // new PIs were introduced by bit-blasting at the end of the PI list
@@ -1888,6 +1898,7 @@ int Wlc_NtkAbsCore( Wlc_Ntk_t * p, Wlc_Par_t * pPars )
     }
     Vec_IntFreeP( &vBlacks );
     Vec_BitFreeP( &vUnmark );
+    Wlc_BstCacheStop( pBstPars->pCache, pPars->fVerbose );
     // report the result
     if ( pPars->fVerbose )
         printf( "\n" );
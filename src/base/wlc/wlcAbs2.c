@@ -306,8 +306,12 @@ int Wlc_NtkAbsCore2( Wlc_Ntk_t * p, Wlc_Par_t * pPars )
     // start the bitmap to mark objects that cannot be abstracted because of refinement
     // currently, this bitmap is empty because abstraction begins without refinement
     Vec_Bit_t * vUnmark = Vec_BitStart( Wlc_NtkObjNumMax(p) );
+    // set up parameters to bit-blast, reusing the operators blasted in the previous iterations
+    Wlc_BstPar_t BstPars, * pBstPars = &BstPars;
     // set up parameters to run PDR
     Pdr_Par_t PdrPars, * pPdrPars = &PdrPars;
+    Wlc_BstParDefault( pBstPars );
+    pBstPars->pCache = Wlc_BstCacheStart();
     Pdr_ManSetDefaultParams( pPdrPars );
     pPdrPars->fUseAbs    = 1;   // use 'pdr -t'  (on-the-fly abstraction)
     pPdrPars->fCtgs      = 1;   // use 'pdr -nc' (improved generalization)
@@ -328,7 +332,7 @@ int Wlc_NtkAbsCore2( Wlc_Ntk_t * p, Wlc_Par_t * pPars )
 
         // get abstracted GIA and the set of pseudo-PIs (vPisNew)
         pAbs = Wlc_NtkAbs( p, pPars, vUnmark, &vPisNew, pPars->fVerbose );
-        pGia = Wlc_NtkBitBlast( pAbs, NULL );
+        pGia = Wlc_NtkBitBlast( pAbs, pBstPars );
 
         // if the abstraction has flops with DC-init state,
         // new PIs were introduced by bit-blasting at the end of the PI list
@@ -386,6 +390,7 @@ int Wlc_NtkAbsCore2( Wlc_Ntk_t * p, Wlc_Par_t * pPars )
         Abc_CexFree( pCex );
     }
     Vec_BitFree( vUnmark );
+    Wlc_BstCacheStop( pBstPars->pCache, pPars->fVerbose );
     // report the result
     if ( pPars->fVerbose )
         printf( "\n" );
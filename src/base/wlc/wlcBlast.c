@@ -20,6 +20,7 @@
 
 #include "wlc.h"
 #include "misc/tim/tim.h"
+#include "misc/vec/vecHsh.h"
 #include "base/main/main.h"
 #include "base/main/mainInt.h"
 #include "base/cmd/cmd.h"
@@ -31,6 +32,33 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+// operator bit-blasted into a separate AIG
+typedef struct Wlc_BlastFrag_t_ Wlc_BlastFrag_t;
+struct Wlc_BlastFrag_t_
+{
+    Wlc_Ntk_t *      p;         // word-level network
+    Wlc_BstPar_t *   pPar;      // bit-blasting parameters
+    int              iObj;      // the operator
+    Vec_Int_t *      vVars;     // variables of the fanin bits (the CIs of the fragment)
+    Gia_Man_t *      pGia;      // the fragment (COs are the result bits)
+    int              fCopied;   // the fragment was copied into the AIG
+};
+
+// the number of integers in the signature of an operator
+#define WLC_BST_KEY_SIZE 8
+
+// fragments of operators reused across bit-blasting runs
+struct Wlc_BstCache_t_
+{
+    Vec_Int_t *      vKeys;     // signatures of the operators
+    Hsh_IntMan_t *   pHash;     // hash table of the signatures
+    Vec_Ptr_t *      vFrags;    // fragment for each signature
+    int              nHits;     // the number of operators copied from the cache
+    int              nMisses;   // the number of operators added to the cache
+};
+
+static int Wlc_BlastCacheCopy( Gia_Man_t * pNew, Wlc_Ntk_t * p, Wlc_Obj_t * pObj, int * pFans0, int * pFans1, Vec_Int_t * vRes, Wlc_BstPar_t * pPar );
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -1391,6 +1419,468 @@ void Wlc_NtkDumpMulties( Wlc_Ntk_t * p, Gia_Man_t * pNew )
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [Returns the index of the CI of the fragment for this literal.]
+
+  Description [The CIs of the fragment correspond to the sorted array of
+  the variables of the fanin bits.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Wlc_BlastFragmentLit( Vec_Int_t * vVars, int iLit )
+{
+    int iVar = Abc_Lit2Var(iLit), iBeg = 0, iEnd = Vec_IntSize(vVars) - 1;
+    if ( iLit < 2 )
+        return iLit;
+    while ( iBeg < iEnd )
+    {
+        int iMid = (iBeg + iEnd) / 2;
+        if ( Vec_IntEntry(vVars, iMid) < iVar )
+            iBeg = iMid + 1;
+        else
+            iEnd = iMid;
+    }
+    assert( Vec_IntEntry(vVars, iBeg) == iVar );
+    return Abc_Var2Lit( 1 + iBeg, Abc_LitIsCompl(iLit) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Copies the fragment into the AIG.]
+
+  Description [The nodes are added in the order of their creation in the
+  fragment. Since the CIs of the fragment have the same order, polarity,
+  and constant values as the fanin bits, the result is the same as the one
+  produced by bit-blasting the operator in place, unless structural hashing
+  finds some nodes of the fragment among the nodes already present in the
+  AIG. This is checked before copying, and if such nodes exist, the fragment
+  is not copied and the procedure returns 0.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Wlc_BlastFragmentCopy( Gia_Man_t * pNew, Wlc_BlastFrag_t * pFrag, Vec_Int_t * vRes )
+{
+    Gia_Obj_t * pObj; int i;
+    assert( Gia_ManCiNum(pFrag->pGia) == Vec_IntSize(pFrag->vVars) );
+    Gia_ManConst0(pFrag->pGia)->Value = 0;
+    Gia_ManForEachCi( pFrag->pGia, pObj, i )
+        pObj->Value = Abc_Var2Lit( Vec_IntEntry(pFrag->vVars, i), 0 );
+    // check that the nodes whose fanins are in the AIG are not there
+    if ( !pNew->fGiaSimple )
+    {
+        Gia_ManForEachAnd( pFrag->pGia, pObj, i )
+        {
+            if ( ~Gia_ObjFanin0(pObj)->Value && ~Gia_ObjFanin1(pObj)->Value && 
+                 Gia_ManHashLookupInt(pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj)) )
+                return 0;
+            pObj->Value = ~0;
+        }
+    }
+    Gia_ManForEachAnd( pFrag->pGia, pObj, i )
+        pObj->Value = Gia_ManHashAnd( pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+    Vec_IntClear( vRes );
+    Gia_ManForEachCo( pFrag->pGia, pObj, i )
+        Vec_IntPush( vRes, Gia_ObjFanin0Copy(pObj) );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Bit-blasts one arithmetic operator.]
+
+  Description [Handles the operators that can be bit-blasted into separate
+  fragments (see Wlc_BlastFragmentIsUsed). If the fragment is given, it is
+  copied when possible. Otherwise, if the cache is given, the fragment is
+  taken from the cache. The result is returned in vRes.]
+               
+  SideEffects [Frees the fragment.]
+
+  SeeAlso     []
+
+***********************************************************************/
+void Wlc_BlastOperator( Gia_Man_t * pNew, Wlc_Ntk_t * p, Wlc_Obj_t * pObj, Wlc_BlastFrag_t * pFrag, int * pFans0, int * pFans1, Vec_Int_t * vTemp0, Vec_Int_t * vTemp1, Vec_Int_t * vTemp2, Vec_Int_t * vRes, Wlc_BstPar_t * pPar )
+{
+    int nRange  = Wlc_ObjRange( pObj );
+    int nRange0 = Wlc_ObjFaninNum(pObj) > 0 ? Wlc_ObjRange( Wlc_ObjFanin0(p, pObj) ) : -1;
+    int nRange1 = Wlc_ObjFaninNum(pObj) > 1 ? Wlc_ObjRange( Wlc_ObjFanin1(p, pObj) ) : -1;
+    if ( pFrag )
+    {
+        pFrag->fCopied = Wlc_BlastFragmentCopy( pNew, pFrag, vRes );
+        Gia_ManStopP( &pFrag->pGia );
+        Vec_IntFreeP( &pFrag->vVars );
+        if ( pFrag->fCopied )
+            return;
+    }
+    else if ( pPar->pCache && Wlc_BlastCacheCopy(pNew, p, pObj, pFans0, pFans1, vRes, pPar) )
+        return;
+    if ( pObj->Type == WLC_OBJ_ARI_MULTI )
+    {
+        int fSigned = Wlc_ObjIsSignedFanin01(p, pObj);
+        int nRangeMax = Abc_MaxInt(nRange0, nRange1);
+        int * pArg0 = Wlc_VecLoadFanins( vTemp0, pFans0, nRange0, nRangeMax, fSigned );
+        int * pArg1 = Wlc_VecLoadFanins( vTemp1, pFans1, nRange1, nRangeMax, fSigned );
+        if ( Wlc_NtkCountConstBits(pArg0, nRangeMax) < Wlc_NtkCountConstBits(pArg1, nRangeMax) ) {
+            ABC_SWAP( int *, pArg0, pArg1 );
+            ABC_SWAP( int, nRange0, nRange1 );
+        }
+        if ( pPar->fBooth )
+            Wlc_BlastBooth( pNew, pArg0, pArg1, nRange0, nRange1, vRes, fSigned, pPar->fCla, NULL, pPar->fVerbose );
+        else if ( pPar->fCla )
+            Wlc_BlastMultiplier3( pNew, pArg0, pArg1, nRange0, nRange1, vRes, Wlc_ObjIsSignedFanin01(p, pObj), pPar->fCla, NULL, pPar->fVerbose );
+        else
+            Wlc_BlastMultiplier( pNew, pArg0, pArg1, nRangeMax, nRangeMax, vTemp2, vRes, fSigned );
+            //Wlc_BlastMultiplierC( pNew, pArg0, pArg1, nRangeMax, nRangeMax, vTemp2, vRes, fSigned );
+        if ( nRange > Vec_IntSize(vRes) )
+            Vec_IntFillExtra( vRes, nRange, fSigned ? Vec_IntEntryLast(vRes) : 0 );
+        else
+            Vec_IntShrink( vRes, nRange );
+        assert( Vec_IntSize(vRes) == nRange );
+    }
+    else if ( pObj->Type == WLC_OBJ_ARI_DIVIDE || pObj->Type == WLC_OBJ_ARI_REM || pObj->Type == WLC_OBJ_ARI_MODULUS )
+    {
+        int nRangeMax = Abc_MaxInt( nRange, Abc_MaxInt(nRange0, nRange1) );
+        int fSigned = Wlc_ObjIsSignedFanin01(p, pObj);
+        int * pArg0 = Wlc_VecLoadFanins( vTemp0, pFans0, nRange0, nRangeMax, fSigned );
+        int * pArg1 = Wlc_VecLoadFanins( vTemp1, pFans1, nRange1, nRangeMax, fSigned );
+        if ( fSigned )
+            Wlc_BlastDividerSigned( pNew, pArg0, nRangeMax, pArg1, nRangeMax, pObj->Type == WLC_OBJ_ARI_DIVIDE, vRes, pPar->fNonRest );
+        else
+            Wlc_BlastDividerTop( pNew, pArg0, nRangeMax, pArg1, nRangeMax, pObj->Type == WLC_OBJ_ARI_DIVIDE, vRes, pPar->fNonRest );
+        Vec_IntShrink( vRes, nRange );
+        if ( !pPar->fDivBy0 )
+            Wlc_BlastZeroCondition( pNew, pFans1, nRange1, vRes );
+    }
+    else if ( pObj->Type == WLC_OBJ_ARI_POWER )
+    {
+        int nRangeMax = Abc_MaxInt(nRange0, nRange);
+        int * pArg0 = Wlc_VecLoadFanins( vTemp0, pFans0, nRange0, nRangeMax, Wlc_ObjIsSignedFanin0(p, pObj) );
+        int * pArg1 = Wlc_VecLoadFanins( vTemp1, pFans1, nRange1, nRange1, Wlc_ObjIsSignedFanin1(p, pObj) );
+        Wlc_BlastPower( pNew, pArg0, nRangeMax, pArg1, nRange1, vTemp2, vRes );
+        Vec_IntShrink( vRes, nRange );
+    }
+    else if ( pObj->Type == WLC_OBJ_ARI_SQRT )
+    {
+        int * pArg0 = Wlc_VecLoadFanins( vTemp0, pFans0, nRange0, nRange0 + (nRange0 & 1), 0 );
+        nRange0 += (nRange0 & 1);
+        if ( pPar->fNonRest )
+            Wlc_BlastSqrtNR( pNew, pArg0, nRange0, vTemp2, vRes );
+        else
+            Wlc_BlastSqrt( pNew, pArg0, nRange0, vTemp2, vRes );
+        if ( nRange > Vec_IntSize(vRes) )
+            Vec_IntFillExtra( vRes, nRange, 0 );
+        else
+            Vec_IntShrink( vRes, nRange );
+    }
+    else if ( pObj->Type == WLC_OBJ_ARI_SQUARE )
+    {
+        int * pArg0 = Wlc_VecLoadFanins( vTemp0, pFans0, nRange0, nRange0, 0 );
+        Wlc_BlastSquare( pNew, pArg0, nRange0, vTemp2, vRes );
+        if ( nRange > Vec_IntSize(vRes) )
+            Vec_IntFillExtra( vRes, nRange, 0 );
+        else
+            Vec_IntShrink( vRes, nRange );
+    }
+    else assert( 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the operator is bit-blasted into a fragment.]
+
+  Description [These are the operators whose bit-blasting takes most of
+  the runtime and whose structure does not depend on the levels of the
+  fanin bits. Booth and carry-look-ahead multipliers are balanced using
+  the levels of the fanins, so they are always blasted in place.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Wlc_BlastFragmentIsUsed( Wlc_Ntk_t * p, Wlc_Obj_t * pObj, Wlc_BstPar_t * pPar )
+{
+    if ( pPar->vBoxIds && pObj->Mark )
+        return 0;
+    if ( pObj->Type == WLC_OBJ_ARI_MULTI )
+        return !pPar->fBooth && !pPar->fCla;
+    return pObj->Type == WLC_OBJ_ARI_DIVIDE || pObj->Type == WLC_OBJ_ARI_REM || pObj->Type == WLC_OBJ_ARI_MODULUS ||
+           pObj->Type == WLC_OBJ_ARI_POWER  || pObj->Type == WLC_OBJ_ARI_SQRT || pObj->Type == WLC_OBJ_ARI_SQUARE;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Bit-blasts the operator into a separate AIG.]
+
+  Description [The fragment has the given number of CIs. The literals of
+  the fanin bits, expressed using these CIs, are given in vFans. The COs of
+  the fragment are the bits of the result.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Wlc_BlastFragmentDerive( Wlc_Ntk_t * p, Wlc_Obj_t * pObj, int nCis, Vec_Int_t * vFans, Wlc_BstPar_t * pPar )
+{
+    int nRange0 = Wlc_ObjRange( Wlc_ObjFanin0(p, pObj) );
+    Vec_Int_t * vTemp0 = Vec_IntAlloc( 1000 );
+    Vec_Int_t * vTemp1 = Vec_IntAlloc( 1000 );
+    Vec_Int_t * vTemp2 = Vec_IntAlloc( 1000 );
+    Vec_Int_t * vRes   = Vec_IntAlloc( 1000 );
+    Gia_Man_t * pGia   = Gia_ManStart( 1000 );
+    int k, iLit;
+    pGia->fGiaSimple = pPar->fGiaSimple;
+    if ( !pGia->fGiaSimple )
+        Gia_ManHashAlloc( pGia );
+    for ( k = 0; k < nCis; k++ )
+        Gia_ManAppendCi( pGia );
+    Wlc_BlastOperator( pGia, p, pObj, NULL, Vec_IntArray(vFans), Vec_IntArray(vFans) + nRange0, vTemp0, vTemp1, vTemp2, vRes, pPar );
+    Vec_IntForEachEntry( vRes, iLit, k )
+        Gia_ManAppendCo( pGia, iLit );
+    if ( !pGia->fGiaSimple )
+        Gia_ManHashStop( pGia );
+    Vec_IntFree( vTemp0 );
+    Vec_IntFree( vTemp1 );
+    Vec_IntFree( vTemp2 );
+    Vec_IntFree( vRes );
+    return pGia;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Bit-blasts the operator into a fragment.]
+
+  Description [The CIs of the fragment are the distinct variables of the
+  fanin bits in the increasing order, and its COs are the bits of the result.
+  This procedure is called concurrently for different operators, so it only
+  reads the word-level network and the bits of the fanins.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Wlc_BlastFragmentThread( void * pArg )
+{
+    Wlc_BlastFrag_t * pFrag = (Wlc_BlastFrag_t *)pArg;
+    Wlc_Ntk_t * p = pFrag->p;
+    Wlc_Obj_t * pObj = Wlc_NtkObj( p, pFrag->iObj );
+    int nRange0 = Wlc_ObjRange( Wlc_ObjFanin0(p, pObj) );
+    int nRange1 = Wlc_ObjFaninNum(pObj) > 1 ? Wlc_ObjRange( Wlc_ObjFanin1(p, pObj) ) : 0;
+    int * pFans0 = Vec_IntEntryP( &p->vBits, Wlc_ObjCopy(p, Wlc_ObjFaninId0(pObj)) );
+    int * pFans1 = nRange1 ? Vec_IntEntryP( &p->vBits, Wlc_ObjCopy(p, Wlc_ObjFaninId1(pObj)) ) : NULL;
+    Vec_Int_t * vFans  = Vec_IntAlloc( nRange0 + nRange1 );
+    int k, iLit;
+    // collect the variables of the fanin bits
+    pFrag->vVars = Vec_IntAlloc( nRange0 + nRange1 );
+    for ( k = 0; k < nRange0 + nRange1; k++ )
+    {
+        iLit = k < nRange0 ? pFans0[k] : pFans1[k-nRange0];
+        if ( iLit >= 2 )
+            Vec_IntPush( pFrag->vVars, Abc_Lit2Var(iLit) );
+    }
+    Vec_IntUniqify( pFrag->vVars );
+    // create the fragment
+    for ( k = 0; k < nRange0 + nRange1; k++ )
+        Vec_IntPush( vFans, Wlc_BlastFragmentLit(pFrag->vVars, k < nRange0 ? pFans0[k] : pFans1[k-nRange0]) );
+    pFrag->pGia = Wlc_BlastFragmentDerive( p, pObj, Vec_IntSize(pFrag->vVars), vFans, pFrag->pPar );
+    Vec_IntFree( vFans );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts the fragments for the operators in the topological order.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Ptr_t * Wlc_BlastFragmentsStart( Wlc_Ntk_t * p, Wlc_BstPar_t * pPar )
+{
+    Vec_Ptr_t * vFrags = Vec_PtrAlloc( 100 );
+    Wlc_BlastFrag_t * pFrag;
+    Wlc_Obj_t * pObj; int i;
+    Wlc_NtkForEachObj( p, pObj, i )
+    {
+        if ( !Wlc_BlastFragmentIsUsed(p, pObj, pPar) )
+            continue;
+        pFrag = ABC_CALLOC( Wlc_BlastFrag_t, 1 );
+        pFrag->p    = p;
+        pFrag->pPar = pPar;
+        pFrag->iObj = i;
+        Vec_PtrPush( vFrags, pFrag );
+    }
+    return vFrags;
+}
+void Wlc_BlastFragmentsStop( Vec_Ptr_t * vFrags )
+{
+    Wlc_BlastFrag_t * pFrag; int i;
+    Vec_PtrForEachEntry( Wlc_BlastFrag_t *, vFrags, pFrag, i )
+    {
+        if ( pFrag->pGia )
+            Gia_ManStop( pFrag->pGia );
+        Vec_IntFreeP( &pFrag->vVars );
+        ABC_FREE( pFrag );
+    }
+    Vec_PtrFree( vFrags );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Bit-blasts a batch of operators into fragments.]
+
+  Description [The batch includes the given operator and the following
+  operators whose fanins precede it in the topological order, so that the
+  bits of their fanins are already known. The batch does not depend on the
+  number of threads, so the result is deterministic. Returns the number of
+  operators in the batch.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Wlc_BlastFragmentsCompute( Vec_Ptr_t * vFrags, int iStart, int nProcs )
+{
+    Wlc_BlastFrag_t * pFrag, * pFirst = (Wlc_BlastFrag_t *)Vec_PtrEntry( vFrags, iStart );
+    Vec_Ptr_t * vWork = Vec_PtrAlloc( 100 );
+    int i, k, iFanin, nWork;
+    Vec_PtrForEachEntryStart( Wlc_BlastFrag_t *, vFrags, pFrag, i, iStart )
+    {
+        if ( pFrag->pGia )
+            continue;
+        Wlc_ObjForEachFanin( Wlc_NtkObj(pFrag->p, pFrag->iObj), iFanin, k )
+            if ( iFanin >= pFirst->iObj )
+                break;
+        if ( k == Wlc_ObjFaninNum(Wlc_NtkObj(pFrag->p, pFrag->iObj)) )
+            Vec_PtrPush( vWork, pFrag );
+    }
+    assert( Vec_PtrEntry(vWork, 0) == pFirst );
+    Util_ProcessThreads( Wlc_BlastFragmentThread, vWork, nProcs + 1, 0, 0 );
+    nWork = Vec_PtrSize( vWork );
+    Vec_PtrFree( vWork );
+    return nWork;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the cache of bit-blasted operators.]
+
+  Description [The cache keeps the fragments of the arithmetic operators
+  across several calls to Wlc_NtkBitBlast(), for example, when bit-blasting
+  the abstractions derived in the refinement iterations. Since the
+  abstraction is a new network each time, the fragments are keyed by the
+  signatures of the operators rather than by their IDs.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Wlc_BstCache_t * Wlc_BstCacheStart()
+{
+    Wlc_BstCache_t * p = ABC_CALLOC( Wlc_BstCache_t, 1 );
+    p->vKeys  = Vec_IntAlloc( WLC_BST_KEY_SIZE * 100 );
+    p->pHash  = Hsh_IntManStart( p->vKeys, WLC_BST_KEY_SIZE, 100 );
+    p->vFrags = Vec_PtrAlloc( 100 );
+    return p;
+}
+void Wlc_BstCacheStop( Wlc_BstCache_t * p, int fVerbose )
+{
+    Gia_Man_t * pGia; int i, nAnds = 0;
+    Vec_PtrForEachEntry( Gia_Man_t *, p->vFrags, pGia, i )
+        nAnds += Gia_ManAndNum( pGia );
+    if ( fVerbose )
+        printf( "Bit-blasting cache: %d operators copied and %d operators bit-blasted into %d fragments with %d nodes.\n", 
+            p->nHits, p->nMisses, Vec_PtrSize(p->vFrags), nAnds );
+    Vec_PtrForEachEntry( Gia_Man_t *, p->vFrags, pGia, i )
+        Gia_ManStop( pGia );
+    Vec_PtrFree( p->vFrags );
+    Hsh_IntManStop( p->pHash );
+    Vec_IntFree( p->vKeys );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Copies the operator from the cache.]
+
+  Description [The fragment in the cache has one CI for each fanin bit.
+  It is derived when the operator with this signature is seen for the first
+  time. The fragment is copied into the AIG using structural hashing.
+  Operators with constant fanin bits are not cached because bit-blasting
+  them in place gives smaller AIGs. Returns 0 if the operator is not cached.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Wlc_BlastCacheCopy( Gia_Man_t * pNew, Wlc_Ntk_t * p, Wlc_Obj_t * pObj, int * pFans0, int * pFans1, Vec_Int_t * vRes, Wlc_BstPar_t * pPar )
+{
+    Wlc_BstCache_t * pCache = pPar->pCache;
+    int nRange0 = Wlc_ObjRange( Wlc_ObjFanin0(p, pObj) );
+    int nRange1 = Wlc_ObjFaninNum(pObj) > 1 ? Wlc_ObjRange( Wlc_ObjFanin1(p, pObj) ) : 0;
+    int k, iEntry, nEntries = Hsh_IntManEntryNum( pCache->pHash );
+    Gia_Man_t * pGia;
+    Gia_Obj_t * pGiaObj;
+    if ( !Wlc_BlastFragmentIsUsed(p, pObj, pPar) )
+        return 0;
+    for ( k = 0; k < nRange0 + nRange1; k++ )
+        if ( (k < nRange0 ? pFans0[k] : pFans1[k-nRange0]) < 2 )
+            return 0;
+    // find the fragment using the signature of the operator
+    Vec_IntPush( pCache->vKeys, pObj->Type );
+    Vec_IntPush( pCache->vKeys, Wlc_ObjRange(pObj) );
+    Vec_IntPush( pCache->vKeys, nRange0 );
+    Vec_IntPush( pCache->vKeys, nRange1 );
+    Vec_IntPush( pCache->vKeys, nRange1 ? Wlc_ObjIsSignedFanin01(p, pObj) : 0 );
+    Vec_IntPush( pCache->vKeys, Wlc_ObjIsSignedFanin0(p, pObj) );
+    Vec_IntPush( pCache->vKeys, nRange1 ? Wlc_ObjIsSignedFanin1(p, pObj) : 0 );
+    Vec_IntPush( pCache->vKeys, (pPar->fNonRest << 2) | (pPar->fDivBy0 << 1) | pPar->fGiaSimple );
+    assert( Vec_IntSize(pCache->vKeys) == WLC_BST_KEY_SIZE * (nEntries + 1) );
+    iEntry = Hsh_IntManAdd( pCache->pHash, nEntries );
+    if ( iEntry < nEntries )
+    {
+        Vec_IntShrink( pCache->vKeys, WLC_BST_KEY_SIZE * nEntries );
+        pGia = (Gia_Man_t *)Vec_PtrEntry( pCache->vFrags, iEntry );
+        pCache->nHits++;
+    }
+    else
+    {
+        Wlc_BstPar_t Par = *pPar;
+        Vec_Int_t * vFans = Vec_IntAlloc( nRange0 + nRange1 );
+        for ( k = 0; k < nRange0 + nRange1; k++ )
+            Vec_IntPush( vFans, Abc_Var2Lit(1 + k, 0) );
+        Par.pCache = NULL;
+        pGia = Wlc_BlastFragmentDerive( p, pObj, nRange0 + nRange1, vFans, &Par );
+        Vec_PtrPush( pCache->vFrags, pGia );
+        Vec_IntFree( vFans );
+        pCache->nMisses++;
+    }
+    // copy the fragment
+    Gia_ManConst0(pGia)->Value = 0;
+    Gia_ManForEachCi( pGia, pGiaObj, k )
+        pGiaObj->Value = k < nRange0 ? pFans0[k] : pFans1[k-nRange0];
+    Gia_ManForEachAnd( pGia, pGiaObj, k )
+        pGiaObj->Value = Gia_ManHashAnd( pNew, Gia_ObjFanin0Copy(pGiaObj), Gia_ObjFanin1Copy(pGiaObj) );
+    Vec_IntClear( vRes );
+    Gia_ManForEachCo( pGia, pGiaObj, k )
+        Vec_IntPush( vRes, Gia_ObjFanin0Copy(pGiaObj) );
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -1409,7 +1899,10 @@ Gia_Man_t * Wlc_NtkBitBlast( Wlc_Ntk_t * p, Wlc_BstPar_t * pParIn )
     int fSkipBitRange = 0;
     Tim_Man_t * pManTime = NULL;
     If_LibBox_t * pBoxLib = NULL;
-    Vec_Ptr_t * vTables = NULL;
+    Vec_Ptr_t * vTables = NULL, * vFrags = NULL;
+    Wlc_BlastFrag_t * pFrag = NULL;
+    int iFrag = 0, nFragOps = 0, nFragBatches = 0;
+    abctime clkFrag = 0;
     Vec_Int_t * vFf2Ci = Vec_IntAlloc( 100 );
     Vec_Int_t * vRegClasses = NULL;
     Gia_Man_t * pTemp, * pNew, * pExtra = NULL;
@@ -1535,6 +2028,9 @@ Gia_Man_t * Wlc_NtkBitBlast( Wlc_Ntk_t * p, Wlc_BstPar_t * pParIn )
     }
     //printf( "Init state: %s\n", p->pInits );
 
+    // prepare to blast arithmetic operators into fragments using several threads
+    if ( pPar->nProcs > 1 && pPar->pCache == NULL )
+        vFrags = Wlc_BlastFragmentsStart( p, pPar );
     // blast in the topological order
     Wlc_NtkForEachObj( p, pObj, i )
     {
@@ -1553,6 +2049,19 @@ Gia_Man_t * Wlc_NtkBitBlast( Wlc_Ntk_t * p, Wlc_BstPar_t * pParIn )
         pFans3  = pObj->Type != WLC_OBJ_FF && Wlc_ObjFaninNum(pObj) > 3 ? Vec_IntEntryP( vBits, Wlc_ObjCopy(p, Wlc_ObjFaninId(pObj,3)) ) : NULL;
         Vec_IntClear( vRes );
         assert( nRange > 0 );
+        pFrag = NULL;
+        if ( vFrags && Wlc_BlastFragmentIsUsed(p, pObj, pPar) )
+        {
+            pFrag = (Wlc_BlastFrag_t *)Vec_PtrEntry( vFrags, iFrag++ );
+            assert( pFrag->iObj == i );
+            if ( pFrag->pGia == NULL )
+            {
+                abctime clk = Abc_Clock();
+                nFragOps += Wlc_BlastFragmentsCompute( vFrags, iFrag-1, pPar->nProcs );
+                clkFrag += Abc_Clock() - clk;
+                nFragBatches++;
+            }
+        }
         if ( pPar->vBoxIds && pObj->Mark )
         {
             If_Box_t * pBox;
@@ -2045,43 +2554,10 @@ Gia_Man_t * Wlc_NtkBitBlast( Wlc_Ntk_t * p, Wlc_BstPar_t * pParIn )
                 Vec_IntShrink( vRes, nRange );
             }
             else
-            {
-                int fSigned = Wlc_ObjIsSignedFanin01(p, pObj);
-                int nRangeMax = Abc_MaxInt(nRange0, nRange1);
-                int * pArg0 = Wlc_VecLoadFanins( vTemp0, pFans0, nRange0, nRangeMax, fSigned );
-                int * pArg1 = Wlc_VecLoadFanins( vTemp1, pFans1, nRange1, nRangeMax, fSigned );
-                if ( Wlc_NtkCountConstBits(pArg0, nRangeMax) < Wlc_NtkCountConstBits(pArg1, nRangeMax) ) {
-                    ABC_SWAP( int *, pArg0, pArg1 );
-                    ABC_SWAP( int, nRange0, nRange1 );
-                }
-                if ( pPar->fBooth )
-                    Wlc_BlastBooth( pNew, pArg0, pArg1, nRange0, nRange1, vRes, fSigned, pPar->fCla, NULL, pParIn->fVerbose );
-                else if ( pPar->fCla )
-                    Wlc_BlastMultiplier3( pNew, pArg0, pArg1, nRange0, nRange1, vRes, Wlc_ObjIsSignedFanin01(p, pObj), pPar->fCla, NULL, pParIn->fVerbose );
-                else
-                    Wlc_BlastMultiplier( pNew, pArg0, pArg1, nRangeMax, nRangeMax, vTemp2, vRes, fSigned );
-                    //Wlc_BlastMultiplierC( pNew, pArg0, pArg1, nRangeMax, nRangeMax, vTemp2, vRes, fSigned );
-                if ( nRange > Vec_IntSize(vRes) )
-                    Vec_IntFillExtra( vRes, nRange, fSigned ? Vec_IntEntryLast(vRes) : 0 );
-                else
-                    Vec_IntShrink( vRes, nRange );
-                assert( Vec_IntSize(vRes) == nRange );
-            }
+                Wlc_BlastOperator( pNew, p, pObj, pFrag, pFans0, pFans1, vTemp0, vTemp1, vTemp2, vRes, pPar );
         }
         else if ( pObj->Type == WLC_OBJ_ARI_DIVIDE || pObj->Type == WLC_OBJ_ARI_REM || pObj->Type == WLC_OBJ_ARI_MODULUS )
-        {
-            int nRangeMax = Abc_MaxInt( nRange, Abc_MaxInt(nRange0, nRange1) );
-            int fSigned = Wlc_ObjIsSignedFanin01(p, pObj);
-            int * pArg0 = Wlc_VecLoadFanins( vTemp0, pFans0, nRange0, nRangeMax, fSigned );
-            int * pArg1 = Wlc_VecLoadFanins( vTemp1, pFans1, nRange1, nRangeMax, fSigned );
-            if ( fSigned )
-                Wlc_BlastDividerSigned( pNew, pArg0, nRangeMax, pArg1, nRangeMax, pObj->Type == WLC_OBJ_ARI_DIVIDE, vRes, pPar->fNonRest );
-            else
-                Wlc_BlastDividerTop( pNew, pArg0, nRangeMax, pArg1, nRangeMax, pObj->Type == WLC_OBJ_ARI_DIVIDE, vRes, pPar->fNonRest );
-            Vec_IntShrink( vRes, nRange );
-            if ( !pPar->fDivBy0 )
-                Wlc_BlastZeroCondition( pNew, pFans1, nRange1, vRes );
-        }
+            Wlc_BlastOperator( pNew, p, pObj, pFrag, pFans0, pFans1, vTemp0, vTemp1, vTemp2, vRes, pPar );
         else if ( pObj->Type == WLC_OBJ_ARI_MINUS )
         {
             int nRangeMax = Abc_MaxInt( nRange0, nRange );
@@ -2089,36 +2565,8 @@ Gia_Man_t * Wlc_NtkBitBlast( Wlc_Ntk_t * p, Wlc_BstPar_t * pParIn )
             Wlc_BlastMinus( pNew, pArg0, nRangeMax, vRes );
             Vec_IntShrink( vRes, nRange );
         }
-        else if ( pObj->Type == WLC_OBJ_ARI_POWER )
-        {
-            int nRangeMax = Abc_MaxInt(nRange0, nRange);
-            int * pArg0 = Wlc_VecLoadFanins( vTemp0, pFans0, nRange0, nRangeMax, Wlc_ObjIsSignedFanin0(p, pObj) );
-            int * pArg1 = Wlc_VecLoadFanins( vTemp1, pFans1, nRange1, nRange1, Wlc_ObjIsSignedFanin1(p, pObj) );
-            Wlc_BlastPower( pNew, pArg0, nRangeMax, pArg1, nRange1, vTemp2, vRes );
-            Vec_IntShrink( vRes, nRange );
-        }
-        else if ( pObj->Type == WLC_OBJ_ARI_SQRT )
-        {
-            int * pArg0 = Wlc_VecLoadFanins( vTemp0, pFans0, nRange0, nRange0 + (nRange0 & 1), 0 );
-            nRange0 += (nRange0 & 1);
-            if ( pPar->fNonRest )
-                Wlc_BlastSqrtNR( pNew, pArg0, nRange0, vTemp2, vRes );
-            else
-                Wlc_BlastSqrt( pNew, pArg0, nRange0, vTemp2, vRes );
-            if ( nRange > Vec_IntSize(vRes) )
-                Vec_IntFillExtra( vRes, nRange, 0 );
-            else
-                Vec_IntShrink( vRes, nRange );
-        }
-        else if ( pObj->Type == WLC_OBJ_ARI_SQUARE )
-        {
-            int * pArg0 = Wlc_VecLoadFanins( vTemp0, pFans0, nRange0, nRange0, 0 );
-            Wlc_BlastSquare( pNew, pArg0, nRange0, vTemp2, vRes );
-            if ( nRange > Vec_IntSize(vRes) )
-                Vec_IntFillExtra( vRes, nRange, 0 );
-            else
-                Vec_IntShrink( vRes, nRange );
-        }
+        else if ( pObj->Type == WLC_OBJ_ARI_POWER || pObj->Type == WLC_OBJ_ARI_SQRT || pObj->Type == WLC_OBJ_ARI_SQUARE )
+            Wlc_BlastOperator( pNew, p, pObj, pFrag, pFans0, pFans1, vTemp0, vTemp1, vTemp2, vRes, pPar );
         else if ( pObj->Type == WLC_OBJ_DEC )
         {
             int * pArg0 = Wlc_VecLoadFanins( vTemp0, pFans0, nRange0, nRange0, 0 );
@@ -2157,6 +2605,18 @@ Gia_Man_t * Wlc_NtkBitBlast( Wlc_Ntk_t * p, Wlc_BstPar_t * pParIn )
     Vec_IntFree( vTemp1 );
     Vec_IntFree( vTemp2 );
     Vec_IntFree( vRes );
+    if ( vFrags )
+    {
+        if ( pPar->fVerbose )
+        {
+            int nCopied = 0;
+            Vec_PtrForEachEntry( Wlc_BlastFrag_t *, vFrags, pFrag, k )
+                nCopied += pFrag->fCopied;
+            printf( "Bit-blasted %d arithmetic operators in %d batches using %d threads (%d copied).  ", nFragOps, nFragBatches, pPar->nProcs, nCopied );
+            Abc_PrintTime( 1, "Time", clkFrag );
+        }
+        Wlc_BlastFragmentsStop( vFrags );
+    }
     // create flop boxes
     Wlc_NtkForEachFf2( p, pObj, i )
     {
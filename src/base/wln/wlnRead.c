@@ -27,7 +27,7 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
-#define MAX_LINE 1000000
+#define RTL_BLOCK   (1 << 20)
 
 #define MAX_MAP       32
 #define CELL_NUM       8
@@ -52,6 +52,19 @@ struct Rtl_Lib_t_
     Vec_Int_t *           vInverses; // inverse equivalences
     Vec_Int_t             vAttrTemp; // temp
     Vec_Int_t             vTemp[TEMP_NUM];  // temp
+    Vec_Int_t             vHashes[3];// hash tables of constants, slices, and concatenations
+    int                   nHashes[3];// the number of entries in the hash tables
+};
+
+// reader of the input file in blocks
+typedef struct Rtl_Rdr_t_  Rtl_Rdr_t;
+struct Rtl_Rdr_t_ 
+{
+    FILE *                pFile;     // input file
+    char *                pBuffer;   // the current block
+    int                   nBuffer;   // the number of chars in the block
+    int                   iBuffer;   // the current position in the block
+    Vec_Str_t *           vLine;     // the line crossing the block boundary
 };
 
 typedef struct Rtl_Ntk_t_  Rtl_Ntk_t;
@@ -326,6 +339,8 @@ void Rtl_LibFree( Rtl_Lib_t * p )
     ABC_FREE( p->vAttrTemp.pArray );
     for ( i = 0; i < TEMP_NUM; i++ )
         ABC_FREE( p->vTemp[i].pArray );
+    for ( i = 0; i < 3; i++ )
+        ABC_FREE( p->vHashes[i].pArray );
     Vec_IntFreeP( &p->vMap );
     Vec_IntFreeP( &p->vDirects );
     Vec_IntFreeP( &p->vInverses );
@@ -993,44 +1008,85 @@ void Rtl_TokenRespace( char * p )
         if ( p[i] == '\"' )
             p[i] = ' ';
 }
-Vec_Int_t * Rtl_NtkReadFile( char * pFileName, Abc_Nam_t * p )
+Rtl_Rdr_t * Rtl_RdrStart( char * pFileName )
 {
-    Vec_Int_t * vTokens;
-    char * pTemp, * pBuffer; 
+    Rtl_Rdr_t * p;
     FILE * pFile = fopen( pFileName, "rb" );
     if ( pFile == NULL )
     {
         printf( "Cannot open file \"%s\" for reading.\n", pFileName );
         return NULL;
     }
-    pBuffer = ABC_ALLOC( char, MAX_LINE );
-    Abc_NamStrFindOrAdd( p, "module", NULL );
-    assert( Abc_NamObjNumMax(p) == 2 );
-    vTokens = Vec_IntAlloc( 1000 );
-    while ( fgets( pBuffer, MAX_LINE, pFile ) != NULL )
+    p = ABC_CALLOC( Rtl_Rdr_t, 1 );
+    p->pFile   = pFile;
+    p->pBuffer = ABC_ALLOC( char, RTL_BLOCK + 1 );
+    p->vLine   = Vec_StrAlloc( 1000 );
+    return p;
+}
+void Rtl_RdrStop( Rtl_Rdr_t * p )
+{
+    fclose( p->pFile );
+    Vec_StrFree( p->vLine );
+    ABC_FREE( p->pBuffer );
+    ABC_FREE( p );
+}
+// returns the next line without the end-of-line char or NULL at the end of file
+char * Rtl_RdrLine( Rtl_Rdr_t * p )
+{
+    Vec_StrClear( p->vLine );
+    while ( 1 )
+    {
+        char * pBeg = p->pBuffer + p->iBuffer;
+        char * pEnd = (char *)memchr( pBeg, '\n', p->nBuffer - p->iBuffer );
+        if ( pEnd )
+        {
+            *pEnd = 0;
+            p->iBuffer = pEnd - p->pBuffer + 1;
+            if ( Vec_StrSize(p->vLine) == 0 )
+                return pBeg;
+            Vec_StrPrintStr( p->vLine, pBeg );
+            Vec_StrPush( p->vLine, '\0' );
+            return Vec_StrArray( p->vLine );
+        }
+        // save the incomplete line and read the next block
+        Vec_StrPushBuffer( p->vLine, pBeg, p->nBuffer - p->iBuffer );
+        p->nBuffer = fread( p->pBuffer, 1, RTL_BLOCK, p->pFile );
+        p->iBuffer = 0;
+        p->pBuffer[p->nBuffer] = 0;
+        if ( p->nBuffer == 0 )
+        {
+            if ( Vec_StrSize(p->vLine) == 0 )
+                return NULL;
+            Vec_StrPush( p->vLine, '\0' );
+            return Vec_StrArray( p->vLine );
+        }
+    }
+}
+// appends the tokens of the next non-empty line and returns the first token or -1 at the end of file
+int Rtl_RdrTokens( Rtl_Rdr_t * p, Abc_Nam_t * pNames, Vec_Int_t * vTokens )
+{
+    char * pTemp, * pLine; 
+    int iFirst = Vec_IntSize(vTokens);
+    while ( (pLine = Rtl_RdrLine(p)) )
     {
-        if ( pBuffer[0] == '#' )
+        if ( pLine[0] == '#' )
             continue;
-        Rtl_TokenUnspace( pBuffer );
-        pTemp = strtok( pBuffer, " \t\r\n" );
+        Rtl_TokenUnspace( pLine );
+        pTemp = strtok( pLine, " \t\r" );
         if ( pTemp == NULL )
             continue;
         while ( pTemp )
         {
             if ( *pTemp == '\"' )  Rtl_TokenRespace( pTemp );
-            Vec_IntPush( vTokens, Abc_NamStrFindOrAdd(p, pTemp, NULL) );
-            pTemp = strtok( NULL, " \t\r\n" );
+            Vec_IntPush( vTokens, Abc_NamStrFindOrAdd(pNames, pTemp, NULL) );
+            pTemp = strtok( NULL, " \t\r" );
         }
         Vec_IntPush( vTokens, -1 );
+        return Vec_IntEntry( vTokens, iFirst );
     }
-    ABC_FREE( pBuffer );
-    fclose( pFile );
-    return vTokens;
+    return -1;
 }
 
-
-
-
 /**Function*************************************************************
 
   Synopsis    []
@@ -1164,6 +1220,67 @@ void Rtl_LibPrint( char * pFileName, Rtl_Lib_t * p )
 ***********************************************************************/
 extern int Rtl_NtkReadSig( Rtl_Ntk_t * p, int * pPos );
 
+static inline Vec_Int_t * Rtl_LibSigStore( Rtl_Lib_t * p, int Type )
+{
+    return Type == 1 ? &p->vConsts : Type == 2 ? &p->vSlices : &p->vConcats;
+}
+static inline int Rtl_LibSigSize( int Type, int * pSig )
+{
+    if ( Type == 1 )
+        return pSig[0] == -1 ? 2 : 1 + (pSig[0] + 31) / 32;
+    return Type == 2 ? 3 : 1 + pSig[0];
+}
+static inline int Rtl_LibSigHashKey( int * pSig, int nSize )
+{
+    unsigned Key = 0x811C9DC5; int i;
+    for ( i = 0; i < nSize; i++ )
+        Key = (Key ^ (unsigned)pSig[i]) * 0x01000193;
+    return (int)(Key & 0x7FFFFFFF);
+}
+void Rtl_LibHashResize( Rtl_Lib_t * p, int Type, int iFirst )
+{
+    Vec_Int_t * vStore = Rtl_LibSigStore( p, Type );
+    Vec_Int_t * vTable = &p->vHashes[Type-1];
+    int * pOld = Vec_IntArray( vTable ), nOld = Vec_IntSize( vTable );
+    int i, Key, Mask, * pSig, nLive = 0;
+    for ( i = 0; i < nOld; i++ )
+        nLive += pOld[i] >= iFirst;
+    vTable->nSize = vTable->nCap = Abc_MaxInt( 1 << 10, 1 << Abc_Base2Log(4 * nLive + 1) );
+    vTable->pArray = ABC_FALLOC( int, vTable->nSize );
+    Mask = vTable->nSize - 1;
+    for ( i = 0; i < nOld; i++ )
+    {
+        if ( pOld[i] < iFirst )
+            continue;
+        pSig = Vec_IntEntryP( vStore, pOld[i] );
+        for ( Key = Rtl_LibSigHashKey(pSig, Rtl_LibSigSize(Type, pSig)) & Mask; vTable->pArray[Key] >= 0; Key = (Key + 1) & Mask );
+        vTable->pArray[Key] = pOld[i];
+    }
+    p->nHashes[Type-1] = nLive;
+    ABC_FREE( pOld );
+}
+// returns the first copy of the entry starting at iSig; the entries before iFirst are ignored
+int Rtl_LibHashSig( Rtl_Lib_t * p, int Type, int iSig, int iFirst )
+{
+    Vec_Int_t * vStore = Rtl_LibSigStore( p, Type );
+    Vec_Int_t * vTable = &p->vHashes[Type-1];
+    int * pSig = Vec_IntEntryP( vStore, iSig ), nSize = Rtl_LibSigSize( Type, pSig );
+    int Key, Mask, Entry;
+    assert( iSig + nSize == Vec_IntSize(vStore) );
+    if ( 2 * (p->nHashes[Type-1] + 1) > Vec_IntSize(vTable) )
+        Rtl_LibHashResize( p, Type, iFirst );
+    Mask = Vec_IntSize(vTable) - 1;
+    for ( Key = Rtl_LibSigHashKey(pSig, nSize) & Mask; (Entry = Vec_IntEntry(vTable, Key)) >= 0; Key = (Key + 1) & Mask )
+        if ( Entry >= iFirst && !memcmp(Vec_IntEntryP(vStore, Entry), pSig, sizeof(int) * nSize) )
+        {
+            Vec_IntShrink( vStore, iSig );
+            return Entry;
+        }
+    Vec_IntWriteEntry( vTable, Key, iSig );
+    p->nHashes[Type-1]++;
+    return iSig;
+}
+
 int Rtl_NtkReadConst( Rtl_Ntk_t * p, char * pConst )
 {
     Vec_Int_t * vConst = &p->pLib->vConsts;
@@ -1187,6 +1304,7 @@ int Rtl_NtkReadConst( Rtl_Ntk_t * p, char * pConst )
         Vec_IntPush( vConst, -1 );
         Vec_IntPush( vConst, Width );
     }
+    RetVal = Rtl_LibHashSig( p->pLib, 1, RetVal, 0 );
     return (RetVal << 2) | 1;
 }
 int Rtl_NtkReadSlice( Rtl_Ntk_t * p, char * pSlice, int NameId )
@@ -1200,6 +1318,7 @@ int Rtl_NtkReadSlice( Rtl_Ntk_t * p, char * pSlice, int NameId )
     Vec_IntPush( vSlice, NameId );
     Vec_IntPush( vSlice, Left   );
     Vec_IntPush( vSlice, Right  );
+    RetVal = Rtl_LibHashSig( p->pLib, 2, RetVal, p->Slice0 );
     return (RetVal << 2) | 2;
 }
 int Rtl_NtkReadConcat( Rtl_Ntk_t * p, int * pPos )
@@ -1216,6 +1335,7 @@ int Rtl_NtkReadConcat( Rtl_Ntk_t * p, int * pPos )
     Vec_IntWriteEntry( vConcat, RetVal, Vec_IntSize(vConcat) - RetVal - 1 );
     assert( pTok[0] == '}' );
     (*pPos)++;
+    RetVal = Rtl_LibHashSig( p->pLib, 3, RetVal, 0 );
     return (RetVal << 2) | 3;
 }
 int Rtl_NtkReadSig( Rtl_Ntk_t * p, int * pPos )
@@ -1491,17 +1611,47 @@ void Rtl_LibReorderModules( Rtl_Lib_t * p )
 }
 Rtl_Lib_t * Rtl_LibReadFile( char * pFileName, char * pFileSpec )
 {
-    Rtl_Lib_t * p = Rtl_LibAlloc(); int i, Entry;
+    Rtl_Lib_t * p; Rtl_Rdr_t * pRdr; 
+    int i, Entry, nCells = -1;
+    pRdr = Rtl_RdrStart( pFileName );
+    if ( pRdr == NULL )
+        return NULL;
+    p = Rtl_LibAlloc();
     p->pSpec      = Abc_UtilStrsav( pFileSpec );
     p->pManName   = Abc_NamStart( 1000, 50 );
-    p->vTokens    = Rtl_NtkReadFile( pFileName, p->pManName );
+    p->vTokens    = Vec_IntAlloc( 1000 );
+    for ( i = 1; i < RTL_UNUSED; i++ )
+        Abc_NamStrFindOrAdd( p->pManName, Rtl_Num2Name(i), NULL );
+    assert( Abc_NamObjNumMax(p->pManName) == RTL_UNUSED );
     Rtl_LibDeriveMap( p );
     Vec_IntClear( &p->vAttrTemp );
-    Vec_IntForEachEntry( p->vTokens, Entry, i )
+    // the tokens of one module are collected and parsed before reading the next one
+    while ( (Entry = Rtl_RdrTokens(pRdr, p->pManName, p->vTokens)) != -1 )
+    {
+        if ( nCells >= 0 ) // inside a module
+        {
+            if ( Entry == p->pMap[RTL_CELL] )
+                nCells++;
+            else if ( Entry == p->pMap[RTL_END] && nCells-- == 0 )
+            {
+                Rtl_NtkReadNtk( p, 1 );
+                Vec_IntClear( p->vTokens );
+            }
+            continue;
+        }
         if ( Entry == p->pMap[RTL_MODULE] )
-            i = Rtl_NtkReadNtk( p, i+1 );
-        else if ( Entry == p->pMap[RTL_ATTRIBUTE] )
-            i = Rtl_NtkReadAttribute2( p, i+1 );
+        {
+            nCells = 0;
+            continue;
+        }
+        if ( Entry == p->pMap[RTL_ATTRIBUTE] )
+            Rtl_NtkReadAttribute2( p, 1 );
+        Vec_IntClear( p->vTokens );
+    }
+    Rtl_RdrStop( pRdr );
+    if ( nCells >= 0 )
+        printf( "The last module in file \"%s\" is not terminated.\n", pFileName );
+    Vec_IntFreeP( &p->vTokens );
     Rtl_LibSetParents( p );
     Rtl_LibReorderModules( p );
     Rtl_LibOrderWires( p );
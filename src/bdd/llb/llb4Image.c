@@ -59,6 +59,19 @@ struct Llb_Mgr_t_
     int *         pSupp;     // temporary support storage
 };
 
+// the largest number of groups processed concurrently
+#define LLB_PROC_MAX  64
+
+typedef struct Llb_Thr_t_ Llb_Thr_t;
+struct Llb_Thr_t_
+{
+    DdManager *   dd;        // BDD manager of this group
+    Vec_Ptr_t *   vParts;    // partitions of this group
+    Vec_Int_t *   vVars2Q;   // variables quantified locally
+    Vec_Int_t *   vSupp;     // support of the group
+    DdNode *      bProd;     // partial product
+};
+
 static inline Llb_Var_t * Llb_MgrVar( Llb_Mgr_t * p, int i )   { return p->pVars[i];  }
 static inline Llb_Prt_t * Llb_MgrPart( Llb_Mgr_t * p, int i )  { return p->pParts[i]; }
 
@@ -854,6 +867,240 @@ Vec_Ptr_t * Llb_Nonlin4Group( DdManager * dd, Vec_Ptr_t * vParts, Vec_Int_t * vV
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [Starts partitioned image computation on several threads.]
+
+  Description [Splits the partitions of the transition relation into
+  nProcs groups of consecutive partitions. Each group is transferred
+  into its own BDD manager, which uses the same variable order as the
+  main manager and has dynamic reordering disabled because the CUDD
+  reordering code is not reentrant.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+struct Llb_Pim_t_
+{
+    DdManager *   dd;        // main BDD manager
+    int           nGroups;   // the number of groups
+    Llb_Thr_t *   pThrs;     // thread data for each group
+    Vec_Int_t *   vVarGroup; // the only group of a var (-1 if none; -2 if many)
+    Vec_Int_t *   vMask;     // temporary var mask
+    int *         pSupp;     // temporary support storage
+};
+
+Llb_Pim_t * Llb_Nonlin4ImageParStart( DdManager * dd, Vec_Ptr_t * vParts, int nProcs )
+{
+    Llb_Pim_t * p;
+    Llb_Thr_t * pThr;
+    DdNode * bFunc, * bTemp;
+    int i, k, g, nVars = Cudd_ReadSize(dd);
+    int nGroupSize;
+    assert( nProcs > 1 );
+    p = ABC_CALLOC( Llb_Pim_t, 1 );
+    p->dd        = dd;
+    p->nGroups   = Abc_MinInt( Abc_MinInt(nProcs, LLB_PROC_MAX), Vec_PtrSize(vParts) );
+    p->pThrs     = ABC_CALLOC( Llb_Thr_t, Abc_MaxInt(p->nGroups, 1) );
+    p->vVarGroup = Vec_IntStartFull( nVars );
+    p->vMask     = Vec_IntStart( nVars );
+    p->pSupp     = ABC_ALLOC( int, nVars );
+    nGroupSize   = p->nGroups ? (Vec_PtrSize(vParts) + p->nGroups - 1) / p->nGroups : 0;
+    for ( g = 0; g < p->nGroups; g++ )
+    {
+        pThr = p->pThrs + g;
+        pThr->dd      = Cudd_Init( nVars, 0, CUDD_UNIQUE_SLOTS, CUDD_CACHE_SLOTS, 0 );
+        Cudd_ShuffleHeap( pThr->dd, dd->invperm );
+        pThr->dd->TimeStop = dd->TimeStop;
+        pThr->vParts  = Vec_PtrAlloc( nGroupSize );
+        pThr->vVars2Q = Vec_IntStart( nVars );
+        pThr->vSupp   = Vec_IntStart( nVars );
+    }
+    // distribute the partitions and record the groups of each variable
+    Vec_PtrForEachEntry( DdNode *, vParts, bFunc, i )
+    {
+        g = i / nGroupSize;
+        pThr = p->pThrs + g;
+        bTemp = Cudd_bddTransfer( dd, pThr->dd, bFunc );  Cudd_Ref( bTemp );
+        Vec_PtrPush( pThr->vParts, bTemp );
+        Extra_SupportArray( dd, bFunc, p->pSupp );
+        for ( k = 0; k < nVars; k++ )
+        {
+            if ( !p->pSupp[k] || Vec_IntEntry(pThr->vSupp, k) )
+                continue;
+            Vec_IntWriteEntry( pThr->vSupp, k, 1 );
+            if ( Vec_IntEntry(p->vVarGroup, k) == -1 )
+                Vec_IntWriteEntry( p->vVarGroup, k, g );
+            else
+                Vec_IntWriteEntry( p->vVarGroup, k, -2 );
+        }
+    }
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops partitioned image computation.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Llb_Nonlin4ImageParStop( Llb_Pim_t * p )
+{
+    Llb_Thr_t * pThr;
+    DdNode * bFunc;
+    int g, i;
+    for ( g = 0; g < p->nGroups; g++ )
+    {
+        pThr = p->pThrs + g;
+        if ( pThr->bProd )
+            Cudd_RecursiveDeref( pThr->dd, pThr->bProd );
+        Vec_PtrForEachEntry( DdNode *, pThr->vParts, bFunc, i )
+            Cudd_RecursiveDeref( pThr->dd, bFunc );
+        Vec_PtrFree( pThr->vParts );
+        Vec_IntFree( pThr->vVars2Q );
+        Vec_IntFree( pThr->vSupp );
+        Extra_StopManager( pThr->dd );
+    }
+    Vec_IntFree( p->vVarGroup );
+    Vec_IntFree( p->vMask );
+    ABC_FREE( p->pThrs );
+    ABC_FREE( p->pSupp );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the number of threads used for image computation.]
+
+  Description [The number of threads is limited by LLB_PROC_MAX and by
+  the number of partitions.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Llb_Nonlin4ImageParThreadNum( Llb_Pim_t * p )
+{
+    return p->nGroups;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the partial product of one group.]
+
+  Description [Runs on a worker thread and only touches the BDD manager
+  of its group.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Llb_Nonlin4ImageParWork( void * pArg )
+{
+    Llb_Thr_t * pThr = (Llb_Thr_t *)pArg;
+    assert( pThr->bProd == NULL );
+    pThr->bProd = Llb_Nonlin4Image( pThr->dd, pThr->vParts, NULL, pThr->vVars2Q );
+    if ( pThr->bProd )
+        Cudd_Ref( pThr->bProd );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes image using partitions distributed over threads.]
+
+  Description [Variables that are quantifiable and belong to the support
+  of exactly one group (and not to the support of the current states)
+  are quantified by the worker of this group in its own manager. The
+  partial products are transferred into the main manager, where they
+  are conjoined with the current states and the remaining variables are
+  quantified. The partial product of a group is reused as long as its
+  set of local variables does not change. Returns the unreferenced image
+  or NULL if the timeout was reached.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+DdNode * Llb_Nonlin4ImagePar( Llb_Pim_t * p, DdNode * bCurrent, Vec_Int_t * vVars2Q )
+{
+    Vec_Ptr_t * vWork, * vProds;
+    Llb_Thr_t * pThr;
+    DdNode * bFunc, * bRes;
+    int g, i, k, fChanged, fEmpty = 0, nVars = Cudd_ReadSize(p->dd);
+    // find the groups whose local variables have changed
+    vWork = Vec_PtrAlloc( p->nGroups );
+    Extra_SupportArray( p->dd, bCurrent, p->pSupp );
+    for ( g = 0; g < p->nGroups; g++ )
+    {
+        pThr = p->pThrs + g;
+        fChanged = 0;
+        for ( k = 0; k < nVars; k++ )
+        {
+            int fLocal = Vec_IntEntry(vVars2Q, k) && !p->pSupp[k] && Vec_IntEntry(p->vVarGroup, k) == g;
+            if ( Vec_IntEntry(pThr->vVars2Q, k) == fLocal )
+                continue;
+            Vec_IntWriteEntry( pThr->vVars2Q, k, fLocal );
+            fChanged = 1;
+        }
+        if ( !fChanged && pThr->bProd )
+            continue;
+        if ( pThr->bProd )
+            Cudd_RecursiveDeref( pThr->dd, pThr->bProd );
+        pThr->bProd = NULL;
+        pThr->dd->TimeStop = p->dd->TimeStop;
+        Vec_PtrPush( vWork, pThr );
+    }
+    // compute partial products concurrently
+    Util_ProcessThreads( Llb_Nonlin4ImageParWork, vWork, Vec_PtrSize(vWork) + 1, 0, 0 );
+    Vec_PtrFree( vWork );
+    // transfer partial products into the main manager
+    vProds = Vec_PtrAlloc( p->nGroups );
+    for ( g = 0; g < p->nGroups; g++ )
+    {
+        pThr = p->pThrs + g;
+        if ( pThr->bProd == NULL )
+            break;
+        if ( pThr->bProd == Cudd_ReadOne(pThr->dd) )
+            continue;
+        if ( pThr->bProd == Cudd_ReadLogicZero(pThr->dd) )
+        {
+            fEmpty = 1;
+            break;
+        }
+        bFunc = Cudd_bddTransfer( pThr->dd, p->dd, pThr->bProd );
+        if ( bFunc == NULL )
+            break;
+        Cudd_Ref( bFunc );
+        Vec_PtrPush( vProds, bFunc );
+    }
+    if ( fEmpty )
+        bRes = Cudd_ReadLogicZero( p->dd );
+    else if ( g < p->nGroups )
+        bRes = NULL;
+    else
+        bRes = Llb_Nonlin4Image( p->dd, vProds, bCurrent, vVars2Q );
+    if ( bRes )
+        Cudd_Ref( bRes );
+    Vec_PtrForEachEntry( DdNode *, vProds, bFunc, i )
+        Cudd_RecursiveDeref( p->dd, bFunc );
+    Vec_PtrFree( vProds );
+    if ( bRes )
+        Cudd_Deref( bRes );
+    return bRes;
+}
+
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
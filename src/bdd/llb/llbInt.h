@@ -47,6 +47,7 @@ ABC_NAMESPACE_HEADER_START
 typedef struct Llb_Man_t_ Llb_Man_t;
 typedef struct Llb_Mtr_t_ Llb_Mtr_t;
 typedef struct Llb_Grp_t_ Llb_Grp_t;
+typedef struct Llb_Pim_t_ Llb_Pim_t;
 
 struct Llb_Man_t_
 {
@@ -192,6 +193,10 @@ extern Abc_Cex_t *     Llb4_Nonlin4TransformCex( Aig_Man_t * pAig, Vec_Ptr_t * v
 /*=== llb4Image.c =======================================================*/
 extern DdNode *        Llb_Nonlin4Image( DdManager * dd, Vec_Ptr_t * vParts, DdNode * bCurrent, Vec_Int_t * vVars2Q );
 extern Vec_Ptr_t *     Llb_Nonlin4Group( DdManager * dd, Vec_Ptr_t * vParts, Vec_Int_t * vVars2Q, int nSizeMax );
+extern Llb_Pim_t *     Llb_Nonlin4ImageParStart( DdManager * dd, Vec_Ptr_t * vParts, int nProcs );
+extern void            Llb_Nonlin4ImageParStop( Llb_Pim_t * p );
+extern int             Llb_Nonlin4ImageParThreadNum( Llb_Pim_t * p );
+extern DdNode *        Llb_Nonlin4ImagePar( Llb_Pim_t * p, DdNode * bCurrent, Vec_Int_t * vVars2Q );
 /*=== llb4Map.c =========================================================*/
 //extern Vec_Int_t *     Llb_AigMap( Aig_Man_t * pAig, int nLutSize, int nLutMin );
 /*=== llb4Nonlin.c ======================================================*/
@@ -50,8 +50,8 @@ Dec_Man_t * Dec_ManStart()
     p->pMvcMem = Mvc_ManagerStart();
     p->vCubes = Vec_IntAlloc( 8 );
     p->vLits = Vec_IntAlloc( 8 );
-    // canonical forms, phases, perms
-    Extra_Truth4VarNPN( &p->puCanons, &p->pPhases, &p->pPerms, &p->pMap );
+    // canonical forms, phases, perms (shared with other managers)
+    Extra_Truth4VarNPNShared( &p->puCanons, &p->pPhases, &p->pPerms, &p->pMap );
 //ABC_PRT( "NPN classes precomputation time", Abc_Clock() - clk ); 
     return p;
 }
@@ -72,10 +72,7 @@ void Dec_ManStop( Dec_Man_t * p )
     Mvc_ManagerFree( (Mvc_Manager_t *)p->pMvcMem );
     Vec_IntFree( p->vCubes );
     Vec_IntFree( p->vLits );
-    ABC_FREE( p->puCanons );
-    ABC_FREE( p->pPhases );
-    ABC_FREE( p->pPerms );
-    ABC_FREE( p->pMap );
+    Extra_Truth4VarNPNRelease();
     ABC_FREE( p );
 }
 
@@ -199,6 +199,11 @@ extern unsigned    Extra_TruthCanonNPN( unsigned uTruth, int nVars );
 /* canonical forms of 4-variable functions */
 extern void        Extra_Truth4VarNPN( unsigned short ** puCanons, char ** puPhases, char ** puPerms, unsigned char ** puMap );
 extern void        Extra_Truth4VarN( unsigned short ** puCanons, char *** puPhases, char ** ppCounters, int nPhasesMax );
+
+/*=== extraUtilNpn4.c ========================================================*/
+
+extern void        Extra_Truth4VarNPNShared( unsigned short ** puCanons, char ** puPhases, char ** puPerms, unsigned char ** puMap );
+extern void        Extra_Truth4VarNPNRelease();
 /* permutation mapping */
 extern unsigned short Extra_TruthPerm4One( unsigned uTruth, int Phase );
 extern unsigned    Extra_TruthPerm5One( unsigned uTruth, int Phase );
@@ -0,0 +1,351 @@
+/**CFile****************************************************************
+
+  FileName    [extraUtilNpn4.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [extra]
+
+  Synopsis    [Shared read-only image of 4-variable NPN class tables.]
+
+  Author      []
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 19, 2026.]
+
+  Revision    [$Id: extraUtilNpn4.c,v 1.00 2026/10/19 00:00:00 Exp $]
+
+***********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "extra.h"
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#ifdef ABC_USE_PTHREADS
+#if defined(_WIN32) && !defined(__MINGW32__)
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the image contains the header followed by the tables for 2^16 functions:
+// canonical forms (16-bit), phases (8-bit), permutations (8-bit), classes (8-bit)
+
+#define EXTRA_NPN4_MAGIC    "ABCNPN4"
+#define EXTRA_NPN4_VERSION  2
+#define EXTRA_NPN4_FUNCS    (1 << 16)
+#define EXTRA_NPN4_SIZE     (sizeof(Extra_Npn4Head_t) + 5 * EXTRA_NPN4_FUNCS)
+
+typedef struct Extra_Npn4Head_t_ Extra_Npn4Head_t;
+struct Extra_Npn4Head_t_
+{
+    char           Magic[8];        // file signature
+    int            Version;         // format version
+    int            nFuncs;          // the number of functions
+    unsigned       Checksum;        // checksum of the tables
+    int            Reserved;        // for alignment
+};
+
+typedef struct Extra_Npn4Img_t_ Extra_Npn4Img_t;
+struct Extra_Npn4Img_t_
+{
+    char *         pImage;          // the image (header and tables)
+    int            fMapped;         // the image is a read-only file mapping
+    int            nRefs;           // the number of managers using the image
+};
+
+static Extra_Npn4Img_t s_Npn4Img = { NULL, 0, 0 };
+
+#ifdef ABC_USE_PTHREADS
+static pthread_mutex_t s_Npn4Mutex = PTHREAD_MUTEX_INITIALIZER; // protects s_Npn4Img
+#endif
+
+static inline void Extra_Npn4Lock()
+{
+#ifdef ABC_USE_PTHREADS
+    int status = pthread_mutex_lock( &s_Npn4Mutex );  assert( status == 0 );
+#endif
+}
+static inline void Extra_Npn4Unlock()
+{
+#ifdef ABC_USE_PTHREADS
+    int status = pthread_mutex_unlock( &s_Npn4Mutex );  assert( status == 0 );
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the checksum of the tables in the image.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static unsigned Extra_Npn4Checksum( char * pImage )
+{
+    unsigned * pData = (unsigned *)(pImage + sizeof(Extra_Npn4Head_t));
+    unsigned Sum = 0x811C9DC5;
+    int i, nWords = 5 * EXTRA_NPN4_FUNCS / 4;
+    for ( i = 0; i < nWords; i++ )
+        Sum = (Sum ^ pData[i]) * 0x01000193;
+    return Sum;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the image is complete and consistent.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Extra_Npn4ImageCheck( char * pImage, long nSize )
+{
+    Extra_Npn4Head_t * pHead = (Extra_Npn4Head_t *)pImage;
+    if ( nSize != (long)EXTRA_NPN4_SIZE )
+        return 0;
+    if ( strncmp( pHead->Magic, EXTRA_NPN4_MAGIC, 8 ) )
+        return 0;
+    if ( pHead->Version != EXTRA_NPN4_VERSION || pHead->nFuncs != EXTRA_NPN4_FUNCS )
+        return 0;
+    return pHead->Checksum == Extra_Npn4Checksum( pImage );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the image in memory.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static char * Extra_Npn4ImageCompute()
+{
+    Extra_Npn4Head_t * pHead;
+    unsigned short * puCanons;
+    unsigned char * puMap;
+    char * pImage, * puPhases, * puPerms;
+    pImage = ABC_CALLOC( char, EXTRA_NPN4_SIZE );
+    Extra_Truth4VarNPN( &puCanons, &puPhases, &puPerms, &puMap );
+    pHead = (Extra_Npn4Head_t *)pImage;
+    memcpy( pHead->Magic, EXTRA_NPN4_MAGIC, 8 );
+    pHead->Version = EXTRA_NPN4_VERSION;
+    pHead->nFuncs  = EXTRA_NPN4_FUNCS;
+    pImage += sizeof(Extra_Npn4Head_t);
+    memcpy( pImage,                        puCanons, sizeof(unsigned short) * EXTRA_NPN4_FUNCS );
+    memcpy( pImage + 2 * EXTRA_NPN4_FUNCS, puPhases, EXTRA_NPN4_FUNCS );
+    memcpy( pImage + 3 * EXTRA_NPN4_FUNCS, puPerms,  EXTRA_NPN4_FUNCS );
+    memcpy( pImage + 4 * EXTRA_NPN4_FUNCS, puMap,    EXTRA_NPN4_FUNCS );
+    pImage -= sizeof(Extra_Npn4Head_t);
+    pHead->Checksum = Extra_Npn4Checksum( pImage );
+    ABC_FREE( puCanons );
+    ABC_FREE( puPhases );
+    ABC_FREE( puPerms );
+    ABC_FREE( puMap );
+    return pImage;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Maps the image from file.]
+
+  Description [Returns NULL if the file does not exist or is not a valid
+  image. The mapping is read-only and its pages are shared by all
+  processes mapping the same file.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static char * Extra_Npn4ImageMap( char * pFileName, int * pfMapped )
+{
+    char * pImage = NULL;
+    long nSize;
+    FILE * pFile;
+#if !defined(_WIN32)
+    struct stat Stat;
+    int fd = open( pFileName, O_RDONLY );
+    if ( fd == -1 )
+        return NULL;
+    if ( fstat( fd, &Stat ) == 0 && (long)Stat.st_size == (long)EXTRA_NPN4_SIZE )
+    {
+        void * pMap = mmap( NULL, EXTRA_NPN4_SIZE, PROT_READ, MAP_SHARED, fd, 0 );
+        if ( pMap != MAP_FAILED )
+            pImage = (char *)pMap;
+    }
+    close( fd );
+    if ( pImage )
+    {
+        if ( Extra_Npn4ImageCheck( pImage, (long)EXTRA_NPN4_SIZE ) )
+        {
+            *pfMapped = 1;
+            return pImage;
+        }
+        munmap( pImage, EXTRA_NPN4_SIZE );
+        return NULL;
+    }
+#endif
+    // read the file if it cannot be mapped
+    pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return NULL;
+    nSize = Extra_FileSize( pFileName );
+    if ( nSize == (long)EXTRA_NPN4_SIZE )
+    {
+        pImage = ABC_ALLOC( char, EXTRA_NPN4_SIZE );
+        if ( fread( pImage, 1, EXTRA_NPN4_SIZE, pFile ) != EXTRA_NPN4_SIZE || !Extra_Npn4ImageCheck( pImage, nSize ) )
+            ABC_FREE( pImage );
+    }
+    fclose( pFile );
+    *pfMapped = 0;
+    return pImage;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Saves the image into a file.]
+
+  Description [The image is written into a temporary file, which is then
+  renamed, so that concurrent processes never map an incomplete image.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Extra_Npn4ImageWrite( char * pFileName, char * pImage )
+{
+    char * pTempName = ABC_ALLOC( char, strlen(pFileName) + 100 );
+    FILE * pFile;
+    int RetValue;
+#if !defined(_WIN32)
+    sprintf( pTempName, "%s.%d.tmp", pFileName, (int)getpid() );
+#else
+    sprintf( pTempName, "%s.tmp", pFileName );
+#endif
+    pFile = fopen( pTempName, "wb" );
+    if ( pFile == NULL )
+    {
+        ABC_FREE( pTempName );
+        return;
+    }
+    RetValue = fwrite( pImage, 1, EXTRA_NPN4_SIZE, pFile ) == EXTRA_NPN4_SIZE;
+    RetValue = (fclose( pFile ) == 0) && RetValue;
+    if ( !RetValue || rename( pTempName, pFileName ) != 0 )
+        remove( pTempName );
+    ABC_FREE( pTempName );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the shared NPN class tables of 4-variable functions.]
+
+  Description [The tables are the same as those computed by Extra_Truth4VarNPN().
+  In particular, the complements of the class representatives are left in
+  class 0 by the class map; the callers, which need the complete map, should
+  complete a copy of it. The tables are computed once per process and shared
+  by all callers, which should not modify them and should release them using
+  Extra_Truth4VarNPNRelease(). If the environment variable ABC_NPN4_IMAGE
+  gives a file name, the tables are mapped read-only from this file; if the
+  file is missing or invalid, it is created after computing the tables, so
+  that the following processes can map it. The calls are thread-safe.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Extra_Truth4VarNPNShared( unsigned short ** puCanons, char ** puPhases, char ** puPerms, unsigned char ** puMap )
+{
+    char * pImage;
+    Extra_Npn4Lock();
+    if ( s_Npn4Img.pImage == NULL )
+    {
+        char * pFileName = getenv( "ABC_NPN4_IMAGE" );
+        assert( s_Npn4Img.nRefs == 0 );
+        s_Npn4Img.fMapped = 0;
+        if ( pFileName && *pFileName )
+            s_Npn4Img.pImage = Extra_Npn4ImageMap( pFileName, &s_Npn4Img.fMapped );
+        if ( s_Npn4Img.pImage == NULL )
+        {
+            s_Npn4Img.pImage = Extra_Npn4ImageCompute();
+            if ( pFileName && *pFileName )
+                Extra_Npn4ImageWrite( pFileName, s_Npn4Img.pImage );
+        }
+    }
+    s_Npn4Img.nRefs++;
+    pImage = s_Npn4Img.pImage + sizeof(Extra_Npn4Head_t);
+    Extra_Npn4Unlock();
+    if ( puCanons ) *puCanons = (unsigned short *)pImage;
+    if ( puPhases ) *puPhases = pImage + 2 * EXTRA_NPN4_FUNCS;
+    if ( puPerms )  *puPerms  = pImage + 3 * EXTRA_NPN4_FUNCS;
+    if ( puMap )    *puMap    = (unsigned char *)pImage + 4 * EXTRA_NPN4_FUNCS;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Releases the shared NPN class tables.]
+
+  Description [The image is unmapped or freed when the last user releases it.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Extra_Truth4VarNPNRelease()
+{
+    Extra_Npn4Lock();
+    assert( s_Npn4Img.nRefs > 0 );
+    if ( --s_Npn4Img.nRefs > 0 )
+    {
+        Extra_Npn4Unlock();
+        return;
+    }
+#if !defined(_WIN32)
+    if ( s_Npn4Img.fMapped )
+        munmap( s_Npn4Img.pImage, EXTRA_NPN4_SIZE );
+    else
+#endif
+        ABC_FREE( s_Npn4Img.pImage );
+    s_Npn4Img.pImage  = NULL;
+    s_Npn4Img.fMapped = 0;
+    Extra_Npn4Unlock();
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+ABC_NAMESPACE_IMPL_END
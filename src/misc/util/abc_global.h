@@ -569,8 +569,15 @@ extern unsigned Abc_Random( int fReset );
 extern word     Abc_RandomW( int fReset );
 
 // pthreads
+#define UTIL_THREADS_MAX 100  // the largest number of workers run by Util_ProcessThreads()
 extern void Util_ProcessThreads( int (*pUserFunc)(void *), void * vData, int nProcs, int TimeOut, int fVerbose );
 
+// large arrays
+extern void * Util_HugeAlloc( size_t nBytes );
+extern void * Util_HugeRealloc( void * pMem, size_t nBytesOld, size_t nBytesNew );
+extern void   Util_HugeFree( void * pMem, size_t nBytes );
+extern void   Util_HugeAdvise( void * pMem, size_t nBytes );
+
 ABC_NAMESPACE_HEADER_END
 
 #endif
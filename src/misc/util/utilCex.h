@@ -47,6 +47,9 @@ struct Abc_Cex_t_
     unsigned         pData[0];  // the cex bit data (the number of bits: nRegs + (iFrame+1) * nPis)
 };
 
+// compressed storage of counter-examples
+typedef struct Abc_CexStore_t_ Abc_CexStore_t;
+
 ////////////////////////////////////////////////////////////////////////
 ///                      MACRO DEFINITIONS                           ///
 ////////////////////////////////////////////////////////////////////////
@@ -74,6 +77,17 @@ extern Abc_Cex_t *   Abc_CexTransformUndc( Abc_Cex_t * p, char * pInit );
 extern Abc_Cex_t *   Abc_CexPermute( Abc_Cex_t * p, Vec_Int_t * vMapOld2New );
 extern Abc_Cex_t *   Abc_CexPermuteTwo( Abc_Cex_t * p, Vec_Int_t * vPermOld, Vec_Int_t * vPermNew );
 extern int           Abc_CexCountOnes( Abc_Cex_t * p );
+/*=== utilCexStore.c ===========================================================*/
+extern Abc_CexStore_t * Abc_CexStoreStart( int nRegs, int nPis, int nPos, char * pFileName );
+extern Abc_CexStore_t * Abc_CexStoreOpen( char * pFileName );
+extern void          Abc_CexStoreFree( Abc_CexStore_t * p );
+extern int           Abc_CexStoreCexNum( Abc_CexStore_t * p );
+extern int           Abc_CexStorePoNum( Abc_CexStore_t * p );
+extern int           Abc_CexStoreAdd( Abc_CexStore_t * p, Abc_Cex_t * pCex, Abc_Cex_t * pCare );
+extern Abc_Cex_t *   Abc_CexStoreGet( Abc_CexStore_t * p, int iPo );
+extern Abc_CexStore_t * Abc_CexStoreFromArray( Vec_Ptr_t * vCexes, Vec_Ptr_t * vCares, int nRegs, int nPis, char * pFileName );
+extern Vec_Ptr_t *   Abc_CexStoreToArray( Abc_CexStore_t * p );
+extern void          Abc_CexStorePrintStats( Abc_CexStore_t * p );
 
 ABC_NAMESPACE_HEADER_END
 
@@ -0,0 +1,667 @@
+/**CFile****************************************************************
+
+  FileName    [utilCexStore.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Handling counter-examples.]
+
+  Synopsis    [Compressed storage of many counter-examples.]
+
+  Author      []
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 19, 2026.]
+
+  Revision    [$Id: utilCexStore.c,v 1.00 2026/10/19 00:00:00 Exp $]
+
+***********************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#include "misc/vec/vec.h"
+#include "utilCex.h"
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the largest number of records, which can be used to restore one record
+#define ABC_CEX_STORE_DEPTH  16
+
+// Each counter-example is stored as one record, which starts with its size
+// in bytes followed by unsigned integers in the variable-length encoding:
+// the output, the last frame, the record sharing the prefix (plus 1, or 0
+// if none), the number of shared frames and the flag showing that the
+// remaining bits are written as they are. Otherwise, if there is no shared
+// prefix, the flops set to one follow. After that, each frame lists the
+// primary inputs, which changed their value compared to the previous frame.
+// The lists start with the number of entries, followed by the distances
+// between the entries. If this is longer than the bit-mask of the entries,
+// the bit-mask is written after the number of entries equal to the size
+// of the list plus one. The file starts with the text line giving the
+// numbers of flops, primary inputs and primary outputs.
+//
+// The engines "bmc3 -a" and "pdr -a" add counter-examples to the storage
+// as soon as they are found (Saig_ParBmc_t::pCexStore, Pdr_Par_t::pCexStore)
+// and keep only a marker for the solved output, so the counter-examples
+// are never expanded in memory together. The statistics compare the size
+// of the records with the memory taken by the same counter-examples kept
+// as Abc_Cex_t, which the storage replaces.
+
+struct Abc_CexStore_t_
+{
+    int           nRegs;       // the number of flops
+    int           nPis;        // the number of primary inputs
+    int           nPos;        // the number of primary outputs
+    Vec_Str_t *   vData;       // the records (if they are kept in memory)
+    FILE *        pFile;       // the file with the records (if they are kept on disk)
+    int           fReadOnly;   // the file was opened for reading
+    Vec_Wrd_t *   vOffsets;    // the offset of each record
+    Vec_Int_t *   vDepths;     // the number of records needed to restore each record
+    Vec_Int_t *   vOut2Rec;    // the last record of each output (or -1 if none)
+    Abc_Cex_t *   pLast;       // the last added counter-example
+    Vec_Str_t *   vRec;        // the current record
+    Vec_Int_t *   vTemp;       // the positions of bits in one frame
+    word          nBytesCex;   // the memory taken by the added counter-examples as Abc_Cex_t
+    word          nBytes;      // the number of bytes in the records
+};
+
+// the offsets are 64-bit, so that the files larger than 2 GB can be used
+static inline int Abc_CexStoreSeek( FILE * pFile, word Offset )
+{
+#if defined(_WIN32)
+    return _fseeki64( pFile, (__int64)Offset, SEEK_SET );
+#else
+    return fseeko( pFile, (off_t)Offset, SEEK_SET );
+#endif
+}
+static inline word Abc_CexStoreTell( FILE * pFile )
+{
+#if defined(_WIN32)
+    return (word)_ftelli64( pFile );
+#else
+    return (word)ftello( pFile );
+#endif
+}
+
+static inline void Abc_CexStorePutNum( Vec_Str_t * vRec, unsigned x )
+{
+    for ( ; x >= 0x80; x >>= 7 )
+        Vec_StrPush( vRec, (char)(x | 0x80) );
+    Vec_StrPush( vRec, (char)x );
+}
+// returns -1 if the number does not end before pEnd or does not fit into int
+static inline int Abc_CexStoreGetNum( unsigned char ** ppPos, unsigned char * pEnd )
+{
+    word x = 0; unsigned ch; int i = 0;
+    do {
+        if ( *ppPos >= pEnd || i == 5 )
+            return -1;
+        ch = *(*ppPos)++;
+        x |= (word)(ch & 0x7f) << (7 * i++);
+    } while ( ch & 0x80 );
+    return x > 0x7FFFFFFF ? -1 : (int)x;
+}
+// the list of positions among nSize is replaced by the bit-mask if it is shorter
+static inline void Abc_CexStorePutList( Vec_Str_t * vRec, Vec_Int_t * vList, int nSize )
+{
+    int i, Entry, Prev = -1, iStart = Vec_StrSize(vRec), nBytes = (nSize + 7) / 8;
+    Abc_CexStorePutNum( vRec, Vec_IntSize(vList) );
+    Vec_IntForEachEntry( vList, Entry, i )
+        Abc_CexStorePutNum( vRec, Entry - Prev - 1 ), Prev = Entry;
+    if ( Vec_StrSize(vRec) - iStart <= nBytes + 1 )
+        return;
+    Vec_StrShrink( vRec, iStart );
+    Abc_CexStorePutNum( vRec, nSize + 1 );
+    for ( i = 0; i < nBytes; i++ )
+        Vec_StrPush( vRec, 0 );
+    Vec_IntForEachEntry( vList, Entry, i )
+        Vec_StrArray(vRec)[Vec_StrSize(vRec) - nBytes + Entry / 8] |= (char)(1 << (Entry % 8));
+}
+// returns 0 if the list is corrupted
+static inline int Abc_CexStoreGetList( unsigned char ** ppPos, unsigned char * pEnd, Vec_Int_t * vList, int nSize )
+{
+    int i, Num, Pos = -1, nNums = Abc_CexStoreGetNum( ppPos, pEnd );
+    Vec_IntClear( vList );
+    if ( nNums < 0 || nNums > nSize + 1 )
+        return 0;
+    if ( nNums == nSize + 1 )
+    {
+        if ( pEnd - *ppPos < (nSize + 7) / 8 )
+            return 0;
+        for ( i = 0; i < nSize; i++ )
+            if ( ((*ppPos)[i / 8] >> (i % 8)) & 1 )
+                Vec_IntPush( vList, i );
+        *ppPos += (nSize + 7) / 8;
+        return 1;
+    }
+    for ( i = 0; i < nNums; i++ )
+    {
+        if ( (Num = Abc_CexStoreGetNum( ppPos, pEnd )) < 0 || Num >= nSize - Pos - 1 )
+            return 0;
+        Vec_IntPush( vList, Pos += Num + 1 );
+    }
+    return 1;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Allocates the storage.]
+
+  Description [If the file name is given, the records are written into
+  the file as soon as they are added, rather than kept in memory.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Abc_CexStore_t * Abc_CexStoreAlloc( int nRegs, int nPis, int nPos )
+{
+    Abc_CexStore_t * p = ABC_CALLOC( Abc_CexStore_t, 1 );
+    p->nRegs    = nRegs;
+    p->nPis     = nPis;
+    p->nPos     = nPos;
+    p->vOffsets = Vec_WrdAlloc( 100 );
+    p->vDepths  = Vec_IntAlloc( 100 );
+    p->vOut2Rec = Vec_IntStartFull( nPos );
+    p->vRec     = Vec_StrAlloc( 1000 );
+    p->vTemp    = Vec_IntAlloc( 100 );
+    return p;
+}
+Abc_CexStore_t * Abc_CexStoreStart( int nRegs, int nPis, int nPos, char * pFileName )
+{
+    Abc_CexStore_t * p;
+    FILE * pFile = NULL;
+    if ( pFileName && (pFile = fopen( pFileName, "w+b" )) == NULL )
+    {
+        printf( "Cannot open file \"%s\" for writing.\n", pFileName );
+        return NULL;
+    }
+    p = Abc_CexStoreAlloc( nRegs, nPis, nPos );
+    if ( pFile )
+    {
+        p->pFile = pFile;
+        fprintf( pFile, "cexstore %d %d %d\n", nRegs, nPis, nPos );
+    }
+    else
+        p->vData = Vec_StrAlloc( 1 << 16 );
+    return p;
+}
+void Abc_CexStoreFree( Abc_CexStore_t * p )
+{
+    if ( p->pFile )
+        fclose( p->pFile );
+    if ( p->vData )
+        Vec_StrFree( p->vData );
+    Vec_WrdFree( p->vOffsets );
+    Vec_IntFree( p->vDepths );
+    Vec_IntFree( p->vOut2Rec );
+    Vec_StrFree( p->vRec );
+    Vec_IntFree( p->vTemp );
+    Abc_CexFreeP( &p->pLast );
+    ABC_FREE( p );
+}
+int Abc_CexStoreCexNum( Abc_CexStore_t * p )
+{
+    return Vec_WrdSize( p->vOffsets );
+}
+int Abc_CexStorePoNum( Abc_CexStore_t * p )
+{
+    return p->nPos;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the size of the record from the file.]
+
+  Description [Returns -1 at the end of the file.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_CexStoreReadSize( FILE * pFile )
+{
+    word x = 0; int ch, i = 0;
+    do {
+        if ( (ch = fgetc( pFile )) == EOF || i == 5 )
+            return -1;
+        x |= (word)(ch & 0x7f) << (7 * i++);
+    } while ( ch & 0x80 );
+    return x > 0x7FFFFFFF ? -1 : (int)x;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the beginning of the record.]
+
+  Description [The record kept on disk is read into the buffer. The end
+  of the record is returned in ppEnd.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static unsigned char * Abc_CexStoreRecord( Abc_CexStore_t * p, int iRec, Vec_Str_t * vBuf, unsigned char ** ppEnd )
+{
+    word Offset = Vec_WrdEntry( p->vOffsets, iRec );
+    unsigned char * pPos;
+    int nSize;
+    if ( p->pFile == NULL )
+    {
+        pPos = (unsigned char *)Vec_StrArray(p->vData) + Offset;
+        nSize = Abc_CexStoreGetNum( &pPos, (unsigned char *)Vec_StrLimit(p->vData) );
+        *ppEnd = pPos + nSize;
+        return pPos;
+    }
+    if ( Abc_CexStoreSeek( p->pFile, Offset ) )
+        return NULL;
+    nSize = Abc_CexStoreReadSize( p->pFile );
+    if ( nSize <= 0 )
+        return NULL;
+    Vec_StrFill( vBuf, nSize, 0 );
+    if ( (int)fread( Vec_StrArray(vBuf), 1, nSize, p->pFile ) != nSize )
+        return NULL;
+    *ppEnd = (unsigned char *)Vec_StrLimit(vBuf);
+    return (unsigned char *)Vec_StrArray(vBuf);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Appends the current record.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_CexStoreAppend( Abc_CexStore_t * p )
+{
+    unsigned char Buffer[8];
+    unsigned x = (unsigned)Vec_StrSize(p->vRec);
+    int nLen = 0;
+    for ( ; x >= 0x80; x >>= 7 )
+        Buffer[nLen++] = (unsigned char)(x | 0x80);
+    Buffer[nLen++] = (unsigned char)x;
+    if ( p->pFile )
+    {
+        fseek( p->pFile, 0, SEEK_END );
+        Vec_WrdPush( p->vOffsets, Abc_CexStoreTell(p->pFile) );
+        fwrite( Buffer, 1, nLen, p->pFile );
+        fwrite( Vec_StrArray(p->vRec), 1, Vec_StrSize(p->vRec), p->pFile );
+    }
+    else
+    {
+        Vec_WrdPush( p->vOffsets, (word)Vec_StrSize(p->vData) );
+        Vec_StrPushBuffer( p->vData, (char *)Buffer, nLen );
+        Vec_StrPushBuffer( p->vData, Vec_StrArray(p->vRec), Vec_StrSize(p->vRec) );
+    }
+    p->nBytes += nLen + Vec_StrSize(p->vRec);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds one counter-example.]
+
+  Description [If the care-set is given, the primary inputs, which are
+  not in the care-set, take the values they had in the previous frame.
+  The counter-example remains valid while taking less space. If the
+  counter-example shares the flops and the first frames with the previous
+  one, only the remaining frames are stored. If an output has several
+  counter-examples, the last one is returned for this output. Returns
+  the number of the record.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_CexStoreAdd( Abc_CexStore_t * p, Abc_Cex_t * pCex, Abc_Cex_t * pCare )
+{
+    Abc_Cex_t * pNew, * pLast = p->pLast;
+    int f, i, k, nShared = 0, iBase = -1, iRec = Vec_WrdSize(p->vOffsets);
+    int iStart, iFirst, Byte;
+    assert( !p->fReadOnly );
+    assert( pCex->nRegs == p->nRegs && pCex->nPis == p->nPis );
+    assert( pCex->iPo >= 0 && pCex->iPo < p->nPos );
+    pNew = Abc_CexAlloc( pCex->nRegs, pCex->nPis, pCex->iFrame + 1 );
+    pNew->iPo    = pCex->iPo;
+    pNew->iFrame = pCex->iFrame;
+    memcpy( pNew->pData, pCex->pData, sizeof(unsigned) * Abc_BitWordNum(pCex->nBits) );
+    // replace the don't-care values by the values in the previous frame
+    if ( pCare )
+    {
+        assert( pCare->nBits == pCex->nBits );
+        for ( k = pNew->nRegs; k < pNew->nBits; k++ )
+            if ( !Abc_InfoHasBit(pCare->pData, k) && Abc_InfoHasBit(pNew->pData, k) != (k >= pNew->nRegs + pNew->nPis && Abc_InfoHasBit(pNew->pData, k - pNew->nPis)) )
+                Abc_InfoXorBit( pNew->pData, k );
+    }
+    // count the frames shared with the previous counter-example
+    if ( pLast && Vec_IntEntryLast(p->vDepths) < ABC_CEX_STORE_DEPTH )
+    {
+        for ( k = 0; k < p->nRegs; k++ )
+            if ( Abc_InfoHasBit(pNew->pData, k) != Abc_InfoHasBit(pLast->pData, k) )
+                break;
+        for ( f = 0; k == p->nRegs && f <= Abc_MinInt(pNew->iFrame, pLast->iFrame); f++, nShared++ )
+        {
+            for ( i = 0, k = p->nRegs + p->nPis * f; i < p->nPis; i++, k++ )
+                if ( Abc_InfoHasBit(pNew->pData, k) != Abc_InfoHasBit(pLast->pData, k) )
+                    break;
+            if ( i < p->nPis )
+                break;
+        }
+        if ( nShared > 0 )
+            iBase = iRec - 1;
+    }
+    // create the record
+    Vec_StrClear( p->vRec );
+    Abc_CexStorePutNum( p->vRec, pNew->iPo );
+    Abc_CexStorePutNum( p->vRec, pNew->iFrame );
+    Abc_CexStorePutNum( p->vRec, iBase + 1 );
+    Abc_CexStorePutNum( p->vRec, nShared );
+    iStart = Vec_StrSize( p->vRec );
+    Abc_CexStorePutNum( p->vRec, 0 );
+    if ( iBase == -1 )
+    {
+        Vec_IntClear( p->vTemp );
+        for ( k = 0; k < p->nRegs; k++ )
+            if ( Abc_InfoHasBit(pNew->pData, k) )
+                Vec_IntPush( p->vTemp, k );
+        Abc_CexStorePutList( p->vRec, p->vTemp, p->nRegs );
+    }
+    for ( f = nShared; f <= pNew->iFrame; f++ )
+    {
+        Vec_IntClear( p->vTemp );
+        for ( i = 0, k = p->nRegs + p->nPis * f; i < p->nPis; i++, k++ )
+            if ( Abc_InfoHasBit(pNew->pData, k) != (f > 0 && Abc_InfoHasBit(pNew->pData, k - p->nPis)) )
+                Vec_IntPush( p->vTemp, i );
+        Abc_CexStorePutList( p->vRec, p->vTemp, p->nPis );
+    }
+    // if the changes take more space than the bits, the bits are written
+    iFirst = iBase == -1 ? 0 : p->nRegs + p->nPis * nShared;
+    if ( Vec_StrSize(p->vRec) - iStart > 1 + (pNew->nBits - iFirst + 7) / 8 )
+    {
+        Vec_StrShrink( p->vRec, iStart );
+        Abc_CexStorePutNum( p->vRec, 1 );
+        for ( k = iFirst; k < pNew->nBits; k += 8 )
+        {
+            for ( i = 0, Byte = 0; i < 8 && k + i < pNew->nBits; i++ )
+                if ( Abc_InfoHasBit(pNew->pData, k + i) )
+                    Byte |= 1 << i;
+            Vec_StrPush( p->vRec, (char)Byte );
+        }
+    }
+    Abc_CexStoreAppend( p );
+    Vec_IntPush( p->vDepths, iBase >= 0 ? Vec_IntEntry(p->vDepths, iBase) + 1 : 0 );
+    Vec_IntWriteEntry( p->vOut2Rec, pNew->iPo, iRec );
+    p->nBytesCex += sizeof(Abc_Cex_t) + sizeof(unsigned) * Abc_BitWordNum(pCex->nBits);
+    Abc_CexFreeP( &p->pLast );
+    p->pLast = pNew;
+    return iRec;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Restores the counter-example from its record.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Abc_Cex_t * Abc_CexStoreDecode( Abc_CexStore_t * p, int iRec )
+{
+    Vec_Str_t * vBuf = p->pFile ? Vec_StrAlloc( 1000 ) : NULL;
+    unsigned char * pEnd = NULL, * pPos = Abc_CexStoreRecord( p, iRec, vBuf, &pEnd );
+    Abc_Cex_t * pCex = NULL, * pBase = NULL;
+    int iPo, iFrame, iBase, nShared, fBits, Pos, f, i, k, fOkay = 0;
+    if ( pPos == NULL )
+    {
+        printf( "Abc_CexStoreDecode(): Cannot read record %d.\n", iRec );
+        goto finish;
+    }
+    iPo     = Abc_CexStoreGetNum( &pPos, pEnd );
+    iFrame  = Abc_CexStoreGetNum( &pPos, pEnd );
+    iBase   = Abc_CexStoreGetNum( &pPos, pEnd ) - 1;
+    nShared = Abc_CexStoreGetNum( &pPos, pEnd );
+    fBits   = Abc_CexStoreGetNum( &pPos, pEnd );
+    if ( iPo < 0 || iPo >= p->nPos || iFrame < 0 || iFrame >= (0x7FFFFFFF - p->nRegs) / Abc_MaxInt(1, p->nPis) ||
+         iBase < -1 || iBase >= iRec || nShared < 0 || nShared > iFrame + 1 || (iBase == -1 && nShared > 0) || fBits < 0 || fBits > 1 )
+        goto corrupted;
+    pCex = Abc_CexAlloc( p->nRegs, p->nPis, iFrame + 1 );
+    pCex->iPo    = iPo;
+    pCex->iFrame = iFrame;
+    if ( iBase >= 0 )
+    {
+        // copy the flops and the shared frames
+        if ( (pBase = Abc_CexStoreDecode( p, iBase )) == NULL )
+            goto finish;
+        if ( nShared > pBase->iFrame + 1 )
+            goto corrupted;
+        for ( k = 0; k < p->nRegs + p->nPis * nShared; k++ )
+            if ( Abc_InfoHasBit(pBase->pData, k) )
+                Abc_InfoSetBit( pCex->pData, k );
+    }
+    if ( fBits )
+    {
+        // the remaining bits are written as they are
+        k = iBase >= 0 ? p->nRegs + p->nPis * nShared : 0;
+        if ( pEnd - pPos < (pCex->nBits - k + 7) / 8 )
+            goto corrupted;
+        for ( i = 0; k < pCex->nBits; i++, k++ )
+            if ( (pPos[i / 8] >> (i % 8)) & 1 )
+                Abc_InfoSetBit( pCex->pData, k );
+        fOkay = 1;
+        goto finish;
+    }
+    if ( iBase == -1 )
+    {
+        if ( !Abc_CexStoreGetList( &pPos, pEnd, p->vTemp, p->nRegs ) )
+            goto corrupted;
+        Vec_IntForEachEntry( p->vTemp, Pos, i )
+            Abc_InfoSetBit( pCex->pData, Pos );
+    }
+    for ( f = nShared; f <= iFrame; f++ )
+    {
+        if ( f > 0 )
+            for ( i = 0, k = p->nRegs + p->nPis * f; i < p->nPis; i++, k++ )
+                if ( Abc_InfoHasBit(pCex->pData, k - p->nPis) )
+                    Abc_InfoSetBit( pCex->pData, k );
+        if ( !Abc_CexStoreGetList( &pPos, pEnd, p->vTemp, p->nPis ) )
+            goto corrupted;
+        Vec_IntForEachEntry( p->vTemp, Pos, i )
+            Abc_InfoXorBit( pCex->pData, p->nRegs + p->nPis * f + Pos );
+    }
+    fOkay = 1;
+    goto finish;
+corrupted:
+    printf( "Abc_CexStoreDecode(): Record %d is corrupted.\n", iRec );
+finish:
+    if ( pBase )
+        Abc_CexFree( pBase );
+    if ( !fOkay )
+        Abc_CexFreeP( &pCex );
+    if ( vBuf )
+        Vec_StrFree( vBuf );
+    return pCex;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the counter-example of the output.]
+
+  Description [Returns NULL if the output has no counter-example.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Cex_t * Abc_CexStoreGet( Abc_CexStore_t * p, int iPo )
+{
+    int iRec;
+    assert( iPo >= 0 && iPo < p->nPos );
+    iRec = Vec_IntEntry( p->vOut2Rec, iPo );
+    return iRec >= 0 ? Abc_CexStoreDecode( p, iRec ) : NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Opens the file written by the storage.]
+
+  Description [Only the offsets of the records are kept in memory. The
+  counter-examples are read from the file when they are requested.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_CexStore_t * Abc_CexStoreOpen( char * pFileName )
+{
+    Abc_CexStore_t * p;
+    unsigned char * pPos;
+    FILE * pFile = fopen( pFileName, "rb" );
+    int nRegs, nPis, nPos, nSize, iPo, iFrame, iBase;
+    word Offset;
+    if ( pFile == NULL )
+    {
+        printf( "Cannot open file \"%s\" for reading.\n", pFileName );
+        return NULL;
+    }
+    if ( fscanf( pFile, "cexstore %d %d %d", &nRegs, &nPis, &nPos ) != 3 || fgetc(pFile) != '\n' || nRegs < 0 || nPis < 0 || nPos < 0 )
+    {
+        printf( "File \"%s\" does not contain counter-examples.\n", pFileName );
+        fclose( pFile );
+        return NULL;
+    }
+    p = Abc_CexStoreAlloc( nRegs, nPis, nPos );
+    p->pFile     = pFile;
+    p->fReadOnly = 1;
+    // index the records
+    while ( 1 )
+    {
+        Offset = Abc_CexStoreTell( pFile );
+        if ( (nSize = Abc_CexStoreReadSize( pFile )) == -1 )
+            break;
+        if ( nSize == 0 )
+        {
+            printf( "File \"%s\" is truncated after %d counter-examples.\n", pFileName, Vec_WrdSize(p->vOffsets) );
+            break;
+        }
+        Vec_StrFill( p->vRec, nSize, 0 );
+        if ( (int)fread( Vec_StrArray(p->vRec), 1, nSize, pFile ) != nSize )
+        {
+            printf( "File \"%s\" is truncated after %d counter-examples.\n", pFileName, Vec_WrdSize(p->vOffsets) );
+            break;
+        }
+        pPos   = (unsigned char *)Vec_StrArray(p->vRec);
+        iPo    = Abc_CexStoreGetNum( &pPos, (unsigned char *)Vec_StrLimit(p->vRec) );
+        iFrame = Abc_CexStoreGetNum( &pPos, (unsigned char *)Vec_StrLimit(p->vRec) );
+        iBase  = Abc_CexStoreGetNum( &pPos, (unsigned char *)Vec_StrLimit(p->vRec) ) - 1;
+        if ( iPo < 0 || iPo >= nPos || iFrame < 0 || iBase < -1 || iBase >= Vec_WrdSize(p->vOffsets) ||
+            (iBase >= 0 && Vec_IntEntry(p->vDepths, iBase) >= ABC_CEX_STORE_DEPTH) )
+        {
+            printf( "File \"%s\" has a corrupted record %d.\n", pFileName, Vec_WrdSize(p->vOffsets) );
+            break;
+        }
+        Vec_IntWriteEntry( p->vOut2Rec, iPo, Vec_WrdSize(p->vOffsets) );
+        Vec_IntPush( p->vDepths, iBase >= 0 ? Vec_IntEntry(p->vDepths, iBase) + 1 : 0 );
+        Vec_WrdPush( p->vOffsets, Offset );
+        p->nBytesCex += sizeof(Abc_Cex_t) + sizeof(unsigned) * Abc_BitWordNum(nRegs + nPis * (iFrame + 1));
+        p->nBytes   += Abc_CexStoreTell( pFile ) - Offset;
+    }
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Converts the array of counter-examples.]
+
+  Description [The array has one entry for each output. The entries,
+  which are NULL or the markers of the unrecorded counter-examples, are
+  skipped. The optional array of care-sets has the same size.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_CexStore_t * Abc_CexStoreFromArray( Vec_Ptr_t * vCexes, Vec_Ptr_t * vCares, int nRegs, int nPis, char * pFileName )
+{
+    Abc_CexStore_t * p;
+    Abc_Cex_t * pCex;
+    int i;
+    assert( vCares == NULL || Vec_PtrSize(vCares) == Vec_PtrSize(vCexes) );
+    p = Abc_CexStoreStart( nRegs, nPis, Vec_PtrSize(vCexes), pFileName );
+    if ( p == NULL )
+        return NULL;
+    Vec_PtrForEachEntry( Abc_Cex_t *, vCexes, pCex, i )
+        if ( pCex && pCex != (Abc_Cex_t *)(ABC_PTRINT_T)1 )
+            Abc_CexStoreAdd( p, pCex, vCares ? (Abc_Cex_t *)Vec_PtrEntry(vCares, i) : NULL );
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Restores the array of counter-examples.]
+
+  Description [The array has one entry for each output, which is NULL
+  if the output does not have a counter-example.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Ptr_t * Abc_CexStoreToArray( Abc_CexStore_t * p )
+{
+    Vec_Ptr_t * vCexes = Vec_PtrStart( p->nPos );
+    int i;
+    for ( i = 0; i < p->nPos; i++ )
+        Vec_PtrWriteEntry( vCexes, i, Abc_CexStoreGet(p, i) );
+    return vCexes;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints the statistics of the storage.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_CexStorePrintStats( Abc_CexStore_t * p )
+{
+    printf( "CEX store:  PI = %d.  FF = %d.  PO = %d.  CEX = %d.  ", p->nPis, p->nRegs, p->nPos, Vec_WrdSize(p->vOffsets) );
+    printf( "Abc_Cex_t = %.2f MB.  Stored = %.2f MB.  Ratio = %.2f.\n",
+        1.0 * p->nBytesCex / (1 << 20), 1.0 * p->nBytes / (1 << 20), 1.0 * p->nBytesCex / Abc_MaxInt(1, p->nBytes) );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
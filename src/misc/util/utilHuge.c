@@ -0,0 +1,197 @@
+/**CFile****************************************************************
+
+  FileName    [utilHuge.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Allocation of large arrays.]
+
+  Synopsis    [Allocation of large arrays using huge pages.]
+
+  Author      []
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 19, 2026.]
+
+  Revision    [$Id: utilHuge.c,v 1.00 2026/10/19 00:00:00 Exp $]
+
+***********************************************************************/
+
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <assert.h>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#define UTIL_USE_HUGE
+#endif
+
+#include "misc/util/abc_global.h"
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// arrays of this size and larger are mapped directly
+#define UTIL_HUGE_LIMIT  ((size_t)1 << 22)
+
+static inline int Util_HugeIsMapped( size_t nBytes ) { return nBytes >= UTIL_HUGE_LIMIT; }
+
+#ifdef UTIL_USE_HUGE
+// rounds the size up to the whole number of pages
+static inline size_t Util_HugePages( size_t nBytes ) { size_t nPage = (size_t)sysconf( _SC_PAGESIZE ); return (nBytes + nPage - 1) & ~(nPage - 1); }
+// advises the whole mapping, so that it is not split and can be remapped later
+static inline void Util_HugeAdviseMapped( void * pMem, size_t nBytes )
+{
+#ifdef MADV_HUGEPAGE
+    madvise( pMem, Util_HugePages(nBytes), MADV_HUGEPAGE );
+#endif
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Asks the OS to back the array by transparent huge pages.]
+
+  Description [This is a hint, which is ignored for small arrays and
+  on the systems without transparent huge pages. The array does not
+  have to be allocated by Util_HugeAlloc().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Util_HugeAdvise( void * pMem, size_t nBytes )
+{
+#if defined(UTIL_USE_HUGE) && defined(MADV_HUGEPAGE)
+    size_t nPage = (size_t)sysconf( _SC_PAGESIZE );
+    size_t Beg   = ((size_t)pMem + nPage - 1) & ~(nPage - 1);
+    size_t End   = ((size_t)pMem + nBytes) & ~(nPage - 1);
+    if ( pMem == NULL || !Util_HugeIsMapped(nBytes) || Beg >= End )
+        return;
+    madvise( (void *)Beg, End - Beg, MADV_HUGEPAGE );
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Allocates a zeroed array.]
+
+  Description [Large arrays are mapped directly from the OS and backed
+  by huge pages. Such arrays can grow without copying, which avoids
+  the peak memory of the old and the new copies. The size of the array
+  should be given when it is reallocated or freed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Util_HugeAlloc( size_t nBytes )
+{
+#ifdef UTIL_USE_HUGE
+    if ( Util_HugeIsMapped(nBytes) )
+    {
+        void * pMem = mmap( NULL, nBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+        if ( pMem == MAP_FAILED )
+            return NULL;
+        Util_HugeAdviseMapped( pMem, nBytes );
+        return pMem;
+    }
+#endif
+    return calloc( nBytes ? nBytes : 1, 1 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Resizes the array while zeroing the new entries.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Util_HugeRealloc( void * pMem, size_t nBytesOld, size_t nBytesNew )
+{
+    void * pNew;
+    if ( pMem == NULL )
+        return Util_HugeAlloc( nBytesNew );
+#ifdef UTIL_USE_HUGE
+    if ( Util_HugeIsMapped(nBytesOld) && Util_HugeIsMapped(nBytesNew) )
+    {
+        // the page that was partially used may contain old data beyond the old size
+        size_t nTail = Util_HugePages(nBytesOld) - nBytesOld;
+        if ( nBytesNew > nBytesOld && nTail )
+            memset( (char *)pMem + nBytesOld, 0, nTail < nBytesNew - nBytesOld ? nTail : nBytesNew - nBytesOld );
+        // the pages are moved by remapping them; the new pages are zero
+        pNew = mremap( pMem, Util_HugePages(nBytesOld), Util_HugePages(nBytesNew), MREMAP_MAYMOVE );
+        if ( pNew != MAP_FAILED )
+        {
+            Util_HugeAdviseMapped( pNew, nBytesNew );
+            return pNew;
+        }
+        // if remapping is not possible, the array is copied below
+    }
+    if ( Util_HugeIsMapped(nBytesOld) || Util_HugeIsMapped(nBytesNew) )
+    {
+        pNew = Util_HugeAlloc( nBytesNew );
+        if ( pNew == NULL )
+            return NULL;
+        memcpy( pNew, pMem, nBytesOld < nBytesNew ? nBytesOld : nBytesNew );
+        Util_HugeFree( pMem, nBytesOld );
+        return pNew;
+    }
+#endif
+    pNew = realloc( pMem, nBytesNew ? nBytesNew : 1 );
+    if ( pNew != NULL && nBytesNew > nBytesOld )
+        memset( (char *)pNew + nBytesOld, 0, nBytesNew - nBytesOld );
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Frees the array.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Util_HugeFree( void * pMem, size_t nBytes )
+{
+    if ( pMem == NULL )
+        return;
+#ifdef UTIL_USE_HUGE
+    if ( Util_HugeIsMapped(nBytes) )
+    {
+        munmap( pMem, Util_HugePages(nBytes) );
+        return;
+    }
+#endif
+    free( pMem );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
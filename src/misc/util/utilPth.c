@@ -108,7 +108,7 @@ void Util_ProcessThreads( int (*pUserFunc)(void *), void * vData, int nProcs, in
 
 #else // pthreads are used
 
-#define PAR_THR_MAX 100
+#define PAR_THR_MAX UTIL_THREADS_MAX
 typedef struct Util_ThData_t_
 {
     void *       pUserData;
@@ -159,10 +159,23 @@ static inline int Abc_TtBitCount16( int i ) { return __builtin_popcount( i & 0xf
 ///                      MACRO DEFINITIONS                           ///
 ////////////////////////////////////////////////////////////////////////
 
+// the smallest truth table (in words) handled by the SIMD kernels;
+// for smaller tables, the call overhead outweighs the gain
+#define ABC_TT_SIMD_WORDS  8
+
 ////////////////////////////////////////////////////////////////////////
 ///                    FUNCTION DECLARATIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
+/*=== utilTruthSimd.c ==========================================================*/
+extern int     Abc_TtSimdLevel();
+extern int     Abc_TtSimdSetLevel( int Level );
+extern int     Abc_TtSimdFlip( word * pTruth, int nWords, int iVar );
+extern int     Abc_TtSimdSwapAdjacent( word * pTruth, int nWords, int iVar );
+extern int     Abc_TtSimdSwapVars( word * pTruth, int nWords, int iVar, int jVar );
+extern int     Abc_TtSimdCofactor0( word * pTruth, int nWords, int iVar );
+extern int     Abc_TtSimdCofactor1( word * pTruth, int nWords, int iVar );
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -1091,6 +1104,8 @@ static inline void Abc_TtCofactor1p( word * pOut, word * pIn, int nWords, int iV
 }
 static inline void Abc_TtCofactor0( word * pTruth, int nWords, int iVar )
 {
+    if ( nWords >= ABC_TT_SIMD_WORDS && Abc_TtSimdCofactor0( pTruth, nWords, iVar ) )
+        return;
     if ( nWords == 1 )
         pTruth[0] = ((pTruth[0] & s_Truths6Neg[iVar]) << (1 << iVar)) | (pTruth[0] & s_Truths6Neg[iVar]);
     else if ( iVar <= 5 )
@@ -1110,6 +1125,8 @@ static inline void Abc_TtCofactor0( word * pTruth, int nWords, int iVar )
 }
 static inline void Abc_TtCofactor1( word * pTruth, int nWords, int iVar )
 {
+    if ( nWords >= ABC_TT_SIMD_WORDS && Abc_TtSimdCofactor1( pTruth, nWords, iVar ) )
+        return;
     if ( nWords == 1 )
         pTruth[0] = (pTruth[0] & s_Truths6[iVar]) | ((pTruth[0] & s_Truths6[iVar]) >> (1 << iVar));
     else if ( iVar <= 5 )
@@ -1916,6 +1933,8 @@ static inline word Abc_Tt6Flip( word Truth, int iVar )
 }
 static inline void Abc_TtFlip( word * pTruth, int nWords, int iVar )
 {
+    if ( nWords >= ABC_TT_SIMD_WORDS && Abc_TtSimdFlip( pTruth, nWords, iVar ) )
+        return;
     if ( nWords == 1 )
         pTruth[0] = ((pTruth[0] << (1 << iVar)) & s_Truths6[iVar]) | ((pTruth[0] & s_Truths6[iVar]) >> (1 << iVar));
     else if ( iVar <= 5 )
@@ -1951,6 +1970,8 @@ static inline word Abc_Tt6SwapAdjacent( word Truth, int iVar )
 }
 static inline void Abc_TtSwapAdjacent( word * pTruth, int nWords, int iVar )
 {
+    if ( nWords >= ABC_TT_SIMD_WORDS && Abc_TtSimdSwapAdjacent( pTruth, nWords, iVar ) )
+        return;
     if ( iVar < 5 )
     {
         int i, Shift = (1 << iVar);
@@ -1992,6 +2013,8 @@ static inline void Abc_TtSwapVars( word * pTruth, int nVars, int iVar, int jVar
         pTruth[0] = Abc_Tt6SwapVars( pTruth[0], iVar, jVar );
         return;
     }
+    if ( Abc_TtWordNum(nVars) >= ABC_TT_SIMD_WORDS && Abc_TtSimdSwapVars( pTruth, Abc_TtWordNum(nVars), iVar, jVar ) )
+        return;
     if ( jVar <= 5 )
     {
         word * s_PMasks = s_PPMasks[iVar][jVar];
@@ -0,0 +1,321 @@
+/**CFile****************************************************************
+
+  FileName    [utilTruthSimd.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Truth table manipulation.]
+
+  Synopsis    [Truth table manipulation using SIMD instructions.]
+
+  Author      []
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 19, 2026.]
+
+  Revision    [$Id: utilTruthSimd.c,v 1.00 2026/10/19 00:00:00 Exp $]
+
+***********************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#include "misc/util/abc_global.h"
+#include "misc/util/utilTruth.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#if defined(_WIN32) && !defined(__MINGW32__)
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
+// the kernels are compiled for AVX2 and AVX-512 using the target attribute,
+// so that the rest of the code does not need these instruction sets
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && !defined(ABC_NO_SIMD)
+#define ABC_TT_USE_SIMD
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// SIMD levels
+#define ABC_TT_SIMD_NONE    0   // scalar code
+#define ABC_TT_SIMD_AVX2    1   // 256-bit vectors
+#define ABC_TT_SIMD_AVX512  2   // 512-bit vectors
+
+static int s_TtSimdLevel  = ABC_TT_SIMD_NONE; // the level used by the kernels
+static int s_TtSimdDetect = ABC_TT_SIMD_NONE; // the level supported by the CPU
+
+// the levels are detected once, before they are read by any thread
+static void Abc_TtSimdStartOnce();
+#ifdef ABC_USE_PTHREADS
+static pthread_once_t s_TtSimdOnce = PTHREAD_ONCE_INIT;
+static inline void Abc_TtSimdStart()  { pthread_once( &s_TtSimdOnce, Abc_TtSimdStartOnce );                  }
+#else
+static int s_TtSimdStarted = 0;
+static inline void Abc_TtSimdStart()  { if ( !s_TtSimdStarted ) { s_TtSimdStarted = 1; Abc_TtSimdStartOnce(); } }
+#endif
+
+#ifdef ABC_TT_USE_SIMD
+
+#define ABC_TT_VEC_WORDS   4
+#define ABC_TT_VEC_TARGET  "avx2"
+#define ABC_TT_VEC_NAME(x) x##Avx2
+#include "utilTruthSimdKernels.h"
+#undef ABC_TT_VEC_WORDS
+#undef ABC_TT_VEC_TARGET
+#undef ABC_TT_VEC_NAME
+
+#define ABC_TT_VEC_WORDS   8
+#define ABC_TT_VEC_TARGET  "avx512f"
+#define ABC_TT_VEC_NAME(x) x##Avx512
+#include "utilTruthSimdKernels.h"
+#undef ABC_TT_VEC_WORDS
+#undef ABC_TT_VEC_TARGET
+#undef ABC_TT_VEC_NAME
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the SIMD level used for truth tables.]
+
+  Description [The level is determined by the CPU when the function is
+  called for the first time.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_TtSimdStartOnce()
+{
+    s_TtSimdDetect = ABC_TT_SIMD_NONE;
+#ifdef ABC_TT_USE_SIMD
+    __builtin_cpu_init();
+    if ( __builtin_cpu_supports("avx512f") )
+        s_TtSimdDetect = ABC_TT_SIMD_AVX512;
+    else if ( __builtin_cpu_supports("avx2") )
+        s_TtSimdDetect = ABC_TT_SIMD_AVX2;
+#endif
+    s_TtSimdLevel = s_TtSimdDetect;
+}
+static int Abc_TtSimdDetect()
+{
+    Abc_TtSimdStart();
+    return s_TtSimdDetect;
+}
+int Abc_TtSimdLevel()
+{
+    Abc_TtSimdStart();
+    return s_TtSimdLevel;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Restricts the SIMD level used for truth tables.]
+
+  Description [The level cannot exceed the one supported by the CPU.
+  Returns the previous level.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_TtSimdSetLevel( int Level )
+{
+    int LevelOld = Abc_TtSimdLevel();
+    s_TtSimdLevel = Abc_MaxInt( ABC_TT_SIMD_NONE, Abc_MinInt(Level, Abc_TtSimdDetect()) );
+    return LevelOld;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Kernels selected at runtime.]
+
+  Description [Return 1 if the operation was performed, or 0 if the caller
+  should use the scalar code.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_TtSimdFlip( word * pTruth, int nWords, int iVar )
+{
+#ifdef ABC_TT_USE_SIMD
+    int Level = Abc_TtSimdLevel();
+    if ( Level >= ABC_TT_SIMD_AVX512 && Abc_TtFlipAvx512( pTruth, nWords, iVar ) )
+        return 1;
+    if ( Level >= ABC_TT_SIMD_AVX2 && Abc_TtFlipAvx2( pTruth, nWords, iVar ) )
+        return 1;
+#endif
+    return 0;
+}
+int Abc_TtSimdSwapAdjacent( word * pTruth, int nWords, int iVar )
+{
+#ifdef ABC_TT_USE_SIMD
+    int Level = Abc_TtSimdLevel();
+    if ( Level >= ABC_TT_SIMD_AVX512 && Abc_TtSwapAdjacentAvx512( pTruth, nWords, iVar ) )
+        return 1;
+    if ( Level >= ABC_TT_SIMD_AVX2 && Abc_TtSwapAdjacentAvx2( pTruth, nWords, iVar ) )
+        return 1;
+#endif
+    return 0;
+}
+int Abc_TtSimdSwapVars( word * pTruth, int nWords, int iVar, int jVar )
+{
+#ifdef ABC_TT_USE_SIMD
+    int Level = Abc_TtSimdLevel();
+    if ( Level >= ABC_TT_SIMD_AVX512 && Abc_TtSwapVarsAvx512( pTruth, nWords, iVar, jVar ) )
+        return 1;
+    if ( Level >= ABC_TT_SIMD_AVX2 && Abc_TtSwapVarsAvx2( pTruth, nWords, iVar, jVar ) )
+        return 1;
+#endif
+    return 0;
+}
+int Abc_TtSimdCofactor0( word * pTruth, int nWords, int iVar )
+{
+#ifdef ABC_TT_USE_SIMD
+    int Level = Abc_TtSimdLevel();
+    if ( Level >= ABC_TT_SIMD_AVX512 && Abc_TtCofactorAvx512( pTruth, nWords, iVar, 0 ) )
+        return 1;
+    if ( Level >= ABC_TT_SIMD_AVX2 && Abc_TtCofactorAvx2( pTruth, nWords, iVar, 0 ) )
+        return 1;
+#endif
+    return 0;
+}
+int Abc_TtSimdCofactor1( word * pTruth, int nWords, int iVar )
+{
+#ifdef ABC_TT_USE_SIMD
+    int Level = Abc_TtSimdLevel();
+    if ( Level >= ABC_TT_SIMD_AVX512 && Abc_TtCofactorAvx512( pTruth, nWords, iVar, 1 ) )
+        return 1;
+    if ( Level >= ABC_TT_SIMD_AVX2 && Abc_TtCofactorAvx2( pTruth, nWords, iVar, 1 ) )
+        return 1;
+#endif
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Applies one operation to all truth tables and all variables.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_TtSimdApply( int Oper, word * pTruths, int nTruths, int nVars )
+{
+    int nWords = Abc_TtWordNum( nVars );
+    int t, i, j;
+    for ( t = 0; t < nTruths; t++ )
+    {
+        word * pTruth = pTruths + t * nWords;
+        for ( i = 0; i < nVars; i++ )
+            if ( Oper == 0 )
+                Abc_TtFlip( pTruth, nWords, i );
+            else if ( Oper == 1 && i < nVars - 1 )
+                Abc_TtSwapAdjacent( pTruth, nWords, i );
+            else if ( Oper == 2 )
+            {
+                for ( j = i + 1; j < nVars; j++ )
+                    Abc_TtSwapVars( pTruth, nVars, i, j );
+            }
+            else if ( Oper == 3 )
+                Abc_TtCofactor0( pTruth, nWords, i );
+            else if ( Oper == 4 )
+                Abc_TtCofactor1( pTruth, nWords, i );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Compares the SIMD kernels with the scalar code.]
+
+  Description [For each number of variables and each operation, applies
+  the operation to random truth tables at each supported SIMD level, checks
+  that the results are the same, and prints the runtime. The number of
+  rounds is scaled to keep the amount of work independent of the number
+  of variables.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_TtSimdTest( int nVarsMin, int nVarsMax, int nRounds, int fVerbose )
+{
+    char * pOpers[5]  = { "flip", "swapadj", "swapvars", "cof0", "cof1" };
+    char * pLevels[3] = { "scalar", "AVX2", "AVX-512" };
+    int nTruths = 16, LevelOld = Abc_TtSimdLevel(), LevelMax = Abc_TtSimdDetect();
+    int nVars, Oper, Level, r, i, fFailed = 0;
+    assert( nVarsMin >= 7 && nVarsMax <= 16 && nVarsMin <= nVarsMax );
+    printf( "Comparing SIMD kernels with the scalar code. The CPU supports %s.\n", pLevels[LevelMax] );
+    printf( "Vars  Operation " );
+    for ( Level = 0; Level <= LevelMax; Level++ )
+        printf( "%11s", pLevels[Level] );
+    printf( "    Speedup\n" );
+    for ( nVars = nVarsMin; nVars <= nVarsMax; nVars++ )
+    {
+        int nWords = Abc_TtWordNum( nVars );
+        word * pInit = ABC_ALLOC( word, nTruths * nWords );
+        word * pGold = ABC_ALLOC( word, nTruths * nWords );
+        word * pTemp = ABC_ALLOC( word, nTruths * nWords );
+        for ( i = 0; i < nTruths * nWords; i++ )
+            pInit[i] = Abc_RandomW( i == 0 && nVars == nVarsMin );
+        for ( Oper = 0; Oper < 5; Oper++ )
+        {
+            abctime clkScalar = 0, clkLast = 0;
+            printf( "%4d  %-9s ", nVars, pOpers[Oper] );
+            for ( Level = 0; Level <= LevelMax; Level++ )
+            {
+                abctime clk = Abc_Clock();
+                Abc_TtSimdSetLevel( Level );
+                memcpy( pTemp, pInit, sizeof(word) * nTruths * nWords );
+                for ( r = 0; r < nRounds * (1 << (16 - nVars)); r++ )
+                    Abc_TtSimdApply( Oper, pTemp, nTruths, nVars );
+                clkLast = Abc_Clock() - clk;
+                if ( Level == 0 )
+                    clkScalar = clkLast, memcpy( pGold, pTemp, sizeof(word) * nTruths * nWords );
+                else if ( memcmp( pGold, pTemp, sizeof(word) * nTruths * nWords ) )
+                    printf( "Mismatch at %s. ", pLevels[Level] ), fFailed = 1;
+                printf( "%9.3f s", 1.0*clkLast/CLOCKS_PER_SEC );
+            }
+            printf( "%10.2f\n", clkLast ? 1.0*clkScalar/clkLast : 0.0 );
+        }
+        ABC_FREE( pInit );
+        ABC_FREE( pGold );
+        ABC_FREE( pTemp );
+    }
+    Abc_TtSimdSetLevel( LevelOld );
+    if ( fFailed )
+        printf( "Verification FAILED.\n" );
+    else if ( fVerbose )
+        printf( "Verification succeeded.\n" );
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
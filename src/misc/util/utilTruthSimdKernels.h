@@ -0,0 +1,168 @@
+/**CFile****************************************************************
+
+  FileName    [utilTruthSimdKernels.h]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Truth table manipulation.]
+
+  Synopsis    [SIMD kernels for multi-word truth tables.]
+
+  Author      []
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 19, 2026.]
+
+  Revision    [$Id: utilTruthSimdKernels.h,v 1.00 2026/10/19 00:00:00 Exp $]
+
+***********************************************************************/
+
+// This file is included by utilTruthSimd.c once for each instruction set.
+// Before including it, the following should be defined:
+//   ABC_TT_VEC_WORDS   - the number of words in the vector
+//   ABC_TT_VEC_TARGET  - the target attribute of the instruction set
+//   ABC_TT_VEC_NAME(x) - the name of the kernel for this instruction set
+// Each kernel returns 0 if the truth table cannot be handled with vectors
+// of this size (including the case when the number of words is not
+// a multiple of the vector size), in which case the caller falls back
+// to a smaller vector.
+
+typedef word ABC_TT_VEC_NAME(Abc_TtVec) __attribute__((vector_size(8 * ABC_TT_VEC_WORDS), aligned(8), may_alias));
+
+static __attribute__((target(ABC_TT_VEC_TARGET))) int ABC_TT_VEC_NAME(Abc_TtFlip)( word * pTruth, int nWords, int iVar )
+{
+    ABC_TT_VEC_NAME(Abc_TtVec) * p = (ABC_TT_VEC_NAME(Abc_TtVec) *)pTruth, Temp;
+    int w, i, nVecs = nWords / ABC_TT_VEC_WORDS;
+    if ( nVecs == 0 || nWords % ABC_TT_VEC_WORDS )
+        return 0;
+    if ( iVar <= 5 )
+    {
+        int Shift = 1 << iVar;
+        word Mask = s_Truths6[iVar];
+        for ( w = 0; w < nVecs; w++ )
+            p[w] = ((p[w] << Shift) & Mask) | ((p[w] & Mask) >> Shift);
+    }
+    else
+    {
+        int iStep = Abc_TtWordNum(iVar) / ABC_TT_VEC_WORDS;
+        if ( iStep == 0 )
+            return 0;
+        for ( w = 0; w < nVecs; w += 2*iStep )
+            for ( i = 0; i < iStep; i++ )
+                Temp = p[w + i], p[w + i] = p[w + i + iStep], p[w + i + iStep] = Temp;
+    }
+    return 1;
+}
+
+static __attribute__((target(ABC_TT_VEC_TARGET))) int ABC_TT_VEC_NAME(Abc_TtSwapAdjacent)( word * pTruth, int nWords, int iVar )
+{
+    ABC_TT_VEC_NAME(Abc_TtVec) * p = (ABC_TT_VEC_NAME(Abc_TtVec) *)pTruth, Temp;
+    int w, i, nVecs = nWords / ABC_TT_VEC_WORDS;
+    if ( nVecs == 0 || nWords % ABC_TT_VEC_WORDS || iVar == 5 )
+        return 0;
+    if ( iVar < 5 )
+    {
+        int Shift = 1 << iVar;
+        word Mask0 = s_PMasks[iVar][0], Mask1 = s_PMasks[iVar][1], Mask2 = s_PMasks[iVar][2];
+        for ( w = 0; w < nVecs; w++ )
+            p[w] = (p[w] & Mask0) | ((p[w] & Mask1) << Shift) | ((p[w] & Mask2) >> Shift);
+    }
+    else
+    {
+        int iStep = Abc_TtWordNum(iVar) / ABC_TT_VEC_WORDS;
+        if ( iStep == 0 )
+            return 0;
+        for ( w = 0; w < nVecs; w += 4*iStep )
+            for ( i = 0; i < iStep; i++ )
+                Temp = p[w + i + iStep], p[w + i + iStep] = p[w + i + 2*iStep], p[w + i + 2*iStep] = Temp;
+    }
+    return 1;
+}
+
+static __attribute__((target(ABC_TT_VEC_TARGET))) int ABC_TT_VEC_NAME(Abc_TtSwapVars)( word * pTruth, int nWords, int iVar, int jVar )
+{
+    ABC_TT_VEC_NAME(Abc_TtVec) * p = (ABC_TT_VEC_NAME(Abc_TtVec) *)pTruth, Temp;
+    int w, i, j, nVecs = nWords / ABC_TT_VEC_WORDS;
+    assert( iVar < jVar );
+    if ( nVecs == 0 || nWords % ABC_TT_VEC_WORDS )
+        return 0;
+    if ( jVar <= 5 )
+    {
+        word * pMasks = s_PPMasks[iVar][jVar];
+        word Mask0 = pMasks[0], Mask1 = pMasks[1], Mask2 = pMasks[2];
+        int Shift = (1 << jVar) - (1 << iVar);
+        for ( w = 0; w < nVecs; w++ )
+            p[w] = (p[w] & Mask0) | ((p[w] & Mask1) << Shift) | ((p[w] & Mask2) >> Shift);
+    }
+    else if ( iVar <= 5 )
+    {
+        ABC_TT_VEC_NAME(Abc_TtVec) Low2High, High2Low;
+        int jStep = Abc_TtWordNum(jVar) / ABC_TT_VEC_WORDS;
+        int Shift = 1 << iVar;
+        word Mask = s_Truths6[iVar];
+        if ( jStep == 0 )
+            return 0;
+        for ( w = 0; w < nVecs; w += 2*jStep )
+            for ( j = 0; j < jStep; j++ )
+            {
+                Low2High = (p[w + j] & Mask) >> Shift;
+                High2Low = (p[w + j + jStep] << Shift) & Mask;
+                p[w + j] = (p[w + j] & ~Mask) | High2Low;
+                p[w + j + jStep] = (p[w + j + jStep] & Mask) | Low2High;
+            }
+    }
+    else
+    {
+        int iStep = Abc_TtWordNum(iVar) / ABC_TT_VEC_WORDS;
+        int jStep = Abc_TtWordNum(jVar) / ABC_TT_VEC_WORDS;
+        if ( iStep == 0 )
+            return 0;
+        for ( w = 0; w < nVecs; w += 2*jStep )
+            for ( i = 0; i < jStep; i += 2*iStep )
+                for ( j = 0; j < iStep; j++ )
+                    Temp = p[w + iStep + i + j], p[w + iStep + i + j] = p[w + jStep + i + j], p[w + jStep + i + j] = Temp;
+    }
+    return 1;
+}
+
+static __attribute__((target(ABC_TT_VEC_TARGET))) int ABC_TT_VEC_NAME(Abc_TtCofactor)( word * pTruth, int nWords, int iVar, int fCof1 )
+{
+    ABC_TT_VEC_NAME(Abc_TtVec) * p = (ABC_TT_VEC_NAME(Abc_TtVec) *)pTruth;
+    int w, i, nVecs = nWords / ABC_TT_VEC_WORDS;
+    if ( nVecs == 0 || nWords % ABC_TT_VEC_WORDS )
+        return 0;
+    if ( iVar <= 5 )
+    {
+        int Shift = 1 << iVar;
+        if ( fCof1 )
+        {
+            word Mask = s_Truths6[iVar];
+            for ( w = 0; w < nVecs; w++ )
+                p[w] = (p[w] & Mask) | ((p[w] & Mask) >> Shift);
+        }
+        else
+        {
+            word Mask = s_Truths6Neg[iVar];
+            for ( w = 0; w < nVecs; w++ )
+                p[w] = ((p[w] & Mask) << Shift) | (p[w] & Mask);
+        }
+    }
+    else
+    {
+        int iStep = Abc_TtWordNum(iVar) / ABC_TT_VEC_WORDS;
+        if ( iStep == 0 )
+            return 0;
+        for ( w = 0; w < nVecs; w += 2*iStep )
+            for ( i = 0; i < iStep; i++ )
+                if ( fCof1 )
+                    p[w + i] = p[w + i + iStep];
+                else
+                    p[w + i + iStep] = p[w + i];
+    }
+    return 1;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
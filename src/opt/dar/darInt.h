@@ -50,6 +50,7 @@ ABC_NAMESPACE_HEADER_START
 
 typedef struct Dar_Man_t_            Dar_Man_t;
 typedef struct Dar_Cut_t_            Dar_Cut_t;
+typedef struct Dar_LibDat_t_         Dar_LibDat_t;
 
 // the AIG 4-cut
 struct Dar_Cut_t_  // 6 words
@@ -80,6 +81,9 @@ struct Dar_Man_t_
     int              GainBest;       // the best gain
     int              LevelBest;      // the level of node with the best gain
     int              ClassBest;      // the equivalence class of the best replacement
+    // library data used by this manager
+    Dar_LibDat_t *   pLibDatas;      // the data of library objects
+    int *            pLibNums;       // the numbers of library objects
     // function statistics
     int              nTotalSubgs;    // the total number of subgraphs tried
     int              ClassTimes[222];// the runtimes for each class
@@ -145,6 +149,7 @@ extern Vec_Int_t *     Dar_LibReadPrios();
 extern void            Dar_LibStart();
 extern void            Dar_LibStop();
 extern void            Dar_LibReturnCanonicals( unsigned * pCanons );
+extern void            Dar_LibManStart( Dar_Man_t * p );
 extern void            Dar_LibEval( Dar_Man_t * p, Aig_Obj_t * pRoot, Dar_Cut_t * pCut, int Required, int * pnMffcSize );
 extern Aig_Obj_t *     Dar_LibBuildBest( Dar_Man_t * p );
 /*=== darMan.c ============================================================*/
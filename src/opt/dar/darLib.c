@@ -20,6 +20,7 @@
 
 #include "darInt.h"
 #include "aig/gia/gia.h"
+#include "misc/extra/extra.h"
 #include "dar.h"
 
 ABC_NAMESPACE_IMPL_START
@@ -31,7 +32,6 @@ ABC_NAMESPACE_IMPL_START
 
 typedef struct Dar_Lib_t_            Dar_Lib_t;
 typedef struct Dar_LibObj_t_         Dar_LibObj_t;
-typedef struct Dar_LibDat_t_         Dar_LibDat_t;
 
 struct Dar_LibObj_t_ // library object (2 words)
 {
@@ -110,6 +110,11 @@ static Dar_Lib_t * s_DarLib = NULL;
 static inline Dar_LibObj_t * Dar_LibObj( Dar_Lib_t * p, int Id )    { return p->pObjs + Id; }
 static inline int            Dar_LibObjTruth( Dar_LibObj_t * pObj ) { return pObj->Num < (0xFFFF & ~pObj->Num) ? pObj->Num : (0xFFFF & ~pObj->Num); }
 
+// the numbers of library objects and their data used by one rewriting manager
+static inline int            Dar_LibObjNum( Dar_Man_t * p, Dar_LibObj_t * pObj )          { return p->pLibNums[pObj - s_DarLib->pObjs];        }
+static inline void           Dar_LibObjSetNum( Dar_Man_t * p, Dar_LibObj_t * pObj, int n ) { p->pLibNums[pObj - s_DarLib->pObjs] = n;           }
+static inline Dar_LibDat_t * Dar_LibObjDat( Dar_Man_t * p, Dar_LibObj_t * pObj )          { return p->pLibDatas + Dar_LibObjNum(p, pObj);      }
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -128,6 +133,7 @@ static inline int            Dar_LibObjTruth( Dar_LibObj_t * pObj ) { return pOb
 Dar_Lib_t * Dar_LibAlloc( int nObjs )
 {
     unsigned uTruths[4] = { 0xAAAA, 0xCCCC, 0xF0F0, 0xFF00 };
+    unsigned char * pMap;
     Dar_Lib_t * p;
     int i;//, clk = Abc_Clock();
     p = ABC_ALLOC( Dar_Lib_t, 1 );
@@ -136,9 +142,14 @@ Dar_Lib_t * Dar_LibAlloc( int nObjs )
     p->nObjs = nObjs;
     p->pObjs = ABC_ALLOC( Dar_LibObj_t, nObjs );
     memset( p->pObjs, 0, sizeof(Dar_LibObj_t) * nObjs );
-    // allocate canonical data
+    // allocate canonical data (shared with other managers)
     p->pPerms4 = Dar_Permutations( 4 );
-    Dar_Truth4VarNPN( &p->puCanons, &p->pPhases, &p->pPerms, &p->pMap );
+    Extra_Truth4VarNPNShared( &p->puCanons, &p->pPhases, &p->pPerms, &pMap );
+    // the shared class map leaves the complements of class representatives
+    // in class 0, while the library needs the class of every function
+    p->pMap = ABC_ALLOC( unsigned char, (1 << 16) );
+    for ( i = 0; i < (1 << 16); i++ )
+        p->pMap[i] = pMap[p->puCanons[i]];
     // start the elementary objects
     p->iObj = 4;
     for ( i = 0; i < 4; i++ )
@@ -173,10 +184,8 @@ void Dar_LibFree( Dar_Lib_t * p )
     ABC_FREE( p->pPlaceMem );
     ABC_FREE( p->pScoreMem );
     ABC_FREE( p->pPerms4 );
-    ABC_FREE( p->puCanons );
-    ABC_FREE( p->pPhases );
-    ABC_FREE( p->pPerms );
     ABC_FREE( p->pMap );
+    Extra_Truth4VarNPNRelease();
     ABC_FREE( p );
 }
 
@@ -543,6 +552,8 @@ void Dar_LibPrepare( int nSubgraphs )
     // realloc the datas
     Dar_LibCreateData( p, p->nNodes0Max + 32 ); 
     // allocated more because Dar_LibBuildBest() sometimes requires more entries
+    // remember the number of subgraphs to skip the preparation next time
+    p->nSubgraphs = nSubgraphs;
 }
 
 /**Function*************************************************************
@@ -601,6 +612,30 @@ void Dar_LibStart()
 //    ABC_PRT( "Time", Abc_Clock() - clk );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Allocates the library data used by one rewriting manager.]
+
+  Description [Evaluation of the library subgraphs for a cut assigns numbers
+  to the library objects and fills in their data. Keeping these in the
+  rewriting manager leaves the library itself unchanged after it is
+  prepared, so that several managers can use it on different threads.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Dar_LibManStart( Dar_Man_t * p )
+{
+    int i;
+    assert( p->pLibDatas == NULL && p->pLibNums == NULL );
+    p->pLibDatas = ABC_CALLOC( Dar_LibDat_t, s_DarLib->nDatas );
+    p->pLibNums  = ABC_ALLOC( int, s_DarLib->iObj );
+    for ( i = 0; i < s_DarLib->iObj; i++ )
+        p->pLibNums[i] = Dar_LibObj(s_DarLib, i)->Num;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Stops the library.]
@@ -723,13 +758,13 @@ int Dar_LibCutMatch( Dar_Man_t * p, Dar_Cut_t * pCut )
             return 0;
         }
         pFanin = Aig_NotCond(pFanin, ((uPhase >> i) & 1) );
-        s_DarLib->pDatas[i].pFunc = pFanin;
-        s_DarLib->pDatas[i].Level = Aig_Regular(pFanin)->Level;
+        p->pLibDatas[i].pFunc = pFanin;
+        p->pLibDatas[i].Level = Aig_Regular(pFanin)->Level;
         // copy the propability of node being one
         if ( p->pPars->fPower )
         {
             float Prob = Abc_Int2Float( Vec_IntEntry( p->pAig->vProbs, Aig_ObjId(Aig_Regular(pFanin)) ) );
-            s_DarLib->pDatas[i].dProb = Aig_IsComplement(pFanin)? 1.0-Prob : Prob;
+            p->pLibDatas[i].dProb = Aig_IsComplement(pFanin)? 1.0-Prob : Prob;
         }
     }
     p->nCutsGood++;
@@ -749,17 +784,17 @@ int Dar_LibCutMatch( Dar_Man_t * p, Dar_Cut_t * pCut )
   SeeAlso     []
 
 ***********************************************************************/
-int Dar_LibCutMarkMffc( Aig_Man_t * p, Aig_Obj_t * pRoot, int nLeaves, float * pPower )
+int Dar_LibCutMarkMffc( Dar_Man_t * p, Aig_Obj_t * pRoot, int nLeaves, float * pPower )
 {
     int i, nNodes;
     // mark the cut leaves
     for ( i = 0; i < nLeaves; i++ )
-        Aig_Regular(s_DarLib->pDatas[i].pFunc)->nRefs++;
+        Aig_Regular(p->pLibDatas[i].pFunc)->nRefs++;
     // label MFFC with current ID
-    nNodes = Aig_NodeMffcLabel( p, pRoot, pPower );
+    nNodes = Aig_NodeMffcLabel( p->pAig, pRoot, pPower );
     // unmark the cut leaves
     for ( i = 0; i < nLeaves; i++ )
-        Aig_Regular(s_DarLib->pDatas[i].pFunc)->nRefs--;
+        Aig_Regular(p->pLibDatas[i].pFunc)->nRefs--;
     return nNodes;
 }
 
@@ -813,18 +848,18 @@ void Dar_LibEvalAssignNums( Dar_Man_t * p, int Class, Aig_Obj_t * pRoot )
     {
         // get one class node, assign its temporary number and set its data
         pObj = Dar_LibObj(s_DarLib, s_DarLib->pNodes0[Class][i]);
-        pObj->Num = 4 + i;
-        assert( (int)pObj->Num < s_DarLib->nNodes0Max + 4 );
-        pData = s_DarLib->pDatas + pObj->Num;
+        Dar_LibObjSetNum( p, pObj, 4 + i );
+        assert( Dar_LibObjNum(p, pObj) < s_DarLib->nNodes0Max + 4 );
+        pData = Dar_LibObjDat( p, pObj );
         pData->fMffc = 0;
         pData->pFunc = NULL;
         pData->TravId = 0xFFFF;
 
         // explore the fanins
-        assert( (int)Dar_LibObj(s_DarLib, pObj->Fan0)->Num < s_DarLib->nNodes0Max + 4 );
-        assert( (int)Dar_LibObj(s_DarLib, pObj->Fan1)->Num < s_DarLib->nNodes0Max + 4 );
-        pData0 = s_DarLib->pDatas + Dar_LibObj(s_DarLib, pObj->Fan0)->Num;
-        pData1 = s_DarLib->pDatas + Dar_LibObj(s_DarLib, pObj->Fan1)->Num;
+        assert( Dar_LibObjNum(p, Dar_LibObj(s_DarLib, pObj->Fan0)) < s_DarLib->nNodes0Max + 4 );
+        assert( Dar_LibObjNum(p, Dar_LibObj(s_DarLib, pObj->Fan1)) < s_DarLib->nNodes0Max + 4 );
+        pData0 = Dar_LibObjDat( p, Dar_LibObj(s_DarLib, pObj->Fan0) );
+        pData1 = Dar_LibObjDat( p, Dar_LibObj(s_DarLib, pObj->Fan1) );
         pData->Level = 1 + Abc_MaxInt(pData0->Level, pData1->Level);
         if ( pData0->pFunc == NULL || pData1->pFunc == NULL )
             continue;
@@ -860,14 +895,14 @@ void Dar_LibEvalAssignNums( Dar_Man_t * p, int Class, Aig_Obj_t * pRoot )
   SeeAlso     []
 
 ***********************************************************************/
-int Dar_LibEval_rec( Dar_LibObj_t * pObj, int Out, int nNodesSaved, int Required, float * pPower )
+int Dar_LibEval_rec( Dar_Man_t * p, Dar_LibObj_t * pObj, int Out, int nNodesSaved, int Required, float * pPower )
 {
     Dar_LibDat_t * pData;
     float Power0, Power1;
     int Area;
     if ( pPower )
         *pPower = (float)0.0;
-    pData = s_DarLib->pDatas + pObj->Num;
+    pData = Dar_LibObjDat( p, pObj );
     if ( pData->TravId == Out )
         return 0;
     pData->TravId = Out;
@@ -877,7 +912,7 @@ int Dar_LibEval_rec( Dar_LibObj_t * pObj, int Out, int nNodesSaved, int Required
             *pPower = pData->dProb;
         return 0;
     }
-    assert( pObj->Num > 3 );
+    assert( Dar_LibObjNum(p, pObj) > 3 );
     if ( pData->Level > Required )
         return 0xff;
     if ( pData->pFunc && !pData->fMffc )
@@ -888,16 +923,16 @@ int Dar_LibEval_rec( Dar_LibObj_t * pObj, int Out, int nNodesSaved, int Required
     }
     // this is a new node - get a bound on the area of its branches
     nNodesSaved--;
-    Area = Dar_LibEval_rec( Dar_LibObj(s_DarLib, pObj->Fan0), Out, nNodesSaved, Required+1, pPower? &Power0 : NULL );
+    Area = Dar_LibEval_rec( p, Dar_LibObj(s_DarLib, pObj->Fan0), Out, nNodesSaved, Required+1, pPower? &Power0 : NULL );
     if ( Area > nNodesSaved )
         return 0xff;
-    Area += Dar_LibEval_rec( Dar_LibObj(s_DarLib, pObj->Fan1), Out, nNodesSaved, Required+1, pPower? &Power1 : NULL );
+    Area += Dar_LibEval_rec( p, Dar_LibObj(s_DarLib, pObj->Fan1), Out, nNodesSaved, Required+1, pPower? &Power1 : NULL );
     if ( Area > nNodesSaved )
         return 0xff;
     if ( pPower )
     {
-        Dar_LibDat_t * pData0 = s_DarLib->pDatas + Dar_LibObj(s_DarLib, pObj->Fan0)->Num;
-        Dar_LibDat_t * pData1 = s_DarLib->pDatas + Dar_LibObj(s_DarLib, pObj->Fan1)->Num;
+        Dar_LibDat_t * pData0 = Dar_LibObjDat( p, Dar_LibObj(s_DarLib, pObj->Fan0) );
+        Dar_LibDat_t * pData1 = Dar_LibObjDat( p, Dar_LibObj(s_DarLib, pObj->Fan1) );
         pData->dProb = (pObj->fCompl0? 1.0 - pData0->dProb : pData0->dProb)*
                        (pObj->fCompl1? 1.0 - pData1->dProb : pData1->dProb);
         *pPower = Power0 + 2.0 * pData0->dProb * (1.0 - pData0->dProb) +
@@ -926,11 +961,13 @@ void Dar_LibEval( Dar_Man_t * p, Aig_Obj_t * pRoot, Dar_Cut_t * pCut, int Requir
     abctime clk = Abc_Clock();
     if ( pCut->nLeaves != 4 )
         return;
+    if ( p->pLibDatas == NULL )
+        Dar_LibManStart( p );
     // check if the cut exits and assigns leaves and their levels
     if ( !Dar_LibCutMatch(p, pCut) )
         return;
     // mark MFFC of the node
-    nNodesSaved = Dar_LibCutMarkMffc( p->pAig, pRoot, pCut->nLeaves, p->pPars->fPower? &PowerSaved : NULL );
+    nNodesSaved = Dar_LibCutMarkMffc( p, pRoot, pCut->nLeaves, p->pPars->fPower? &PowerSaved : NULL );
     // evaluate the cut
     Class = s_DarLib->pMap[pCut->uTruth];
     Dar_LibEvalAssignNums( p, Class, pRoot );
@@ -940,9 +977,9 @@ void Dar_LibEval( Dar_Man_t * p, Aig_Obj_t * pRoot, Dar_Cut_t * pCut, int Requir
     for ( Out = 0; Out < s_DarLib->nSubgr0[Class]; Out++ )
     {
         pObj = Dar_LibObj(s_DarLib, s_DarLib->pSubgr0[Class][Out]);
-        if ( Aig_Regular(s_DarLib->pDatas[pObj->Num].pFunc) == pRoot )
+        if ( Aig_Regular(Dar_LibObjDat(p, pObj)->pFunc) == pRoot )
             continue;
-        nNodesAdded = Dar_LibEval_rec( pObj, Out, nNodesSaved - !p->pPars->fUseZeros, Required, p->pPars->fPower? &PowerAdded : NULL );
+        nNodesAdded = Dar_LibEval_rec( p, pObj, Out, nNodesSaved - !p->pPars->fUseZeros, Required, p->pPars->fPower? &PowerAdded : NULL );
         nNodesGained = nNodesSaved - nNodesAdded;
         if ( p->pPars->fPower && PowerSaved < PowerAdded )
             continue;
@@ -951,15 +988,15 @@ void Dar_LibEval( Dar_Man_t * p, Aig_Obj_t * pRoot, Dar_Cut_t * pCut, int Requir
         if ( nNodesGained < 0 || (nNodesGained == 0 && !p->pPars->fUseZeros) )
             continue;
         if ( nNodesGained <  p->GainBest || 
-            (nNodesGained == p->GainBest && s_DarLib->pDatas[pObj->Num].Level >= p->LevelBest) )
+            (nNodesGained == p->GainBest && Dar_LibObjDat(p, pObj)->Level >= p->LevelBest) )
             continue;
         // remember this possibility
         Vec_PtrClear( p->vLeavesBest );
         for ( k = 0; k < (int)pCut->nLeaves; k++ )
-            Vec_PtrPush( p->vLeavesBest, s_DarLib->pDatas[k].pFunc );
+            Vec_PtrPush( p->vLeavesBest, p->pLibDatas[k].pFunc );
         p->OutBest    = s_DarLib->pSubgr0[Class][Out];
         p->OutNumBest = Out;
-        p->LevelBest  = s_DarLib->pDatas[pObj->Num].Level;
+        p->LevelBest  = Dar_LibObjDat(p, pObj)->Level;
         p->GainBest   = nNodesGained;
         p->ClassBest  = Class;
         assert( p->LevelBest <= Required );
@@ -981,14 +1018,14 @@ p->timeEval += clk;
   SeeAlso     []
 
 ***********************************************************************/
-void Dar_LibBuildClear_rec( Dar_LibObj_t * pObj, int * pCounter )
+void Dar_LibBuildClear_rec( Dar_Man_t * p, Dar_LibObj_t * pObj, int * pCounter )
 {
     if ( pObj->fTerm )
         return;
-    pObj->Num = (*pCounter)++;
-    s_DarLib->pDatas[ pObj->Num ].pFunc = NULL;
-    Dar_LibBuildClear_rec( Dar_LibObj(s_DarLib, pObj->Fan0), pCounter );
-    Dar_LibBuildClear_rec( Dar_LibObj(s_DarLib, pObj->Fan1), pCounter );
+    Dar_LibObjSetNum( p, pObj, (*pCounter)++ );
+    Dar_LibObjDat( p, pObj )->pFunc = NULL;
+    Dar_LibBuildClear_rec( p, Dar_LibObj(s_DarLib, pObj->Fan0), pCounter );
+    Dar_LibBuildClear_rec( p, Dar_LibObj(s_DarLib, pObj->Fan1), pCounter );
 }
 
 /**Function*************************************************************
@@ -1005,7 +1042,7 @@ void Dar_LibBuildClear_rec( Dar_LibObj_t * pObj, int * pCounter )
 Aig_Obj_t * Dar_LibBuildBest_rec( Dar_Man_t * p, Dar_LibObj_t * pObj )
 {
     Aig_Obj_t * pFanin0, * pFanin1;
-    Dar_LibDat_t * pData = s_DarLib->pDatas + pObj->Num;
+    Dar_LibDat_t * pData = Dar_LibObjDat( p, pObj );
     if ( pData->pFunc )
         return pData->pFunc;
     pFanin0 = Dar_LibBuildBest_rec( p, Dar_LibObj(s_DarLib, pObj->Fan0) );
@@ -1032,8 +1069,8 @@ Aig_Obj_t * Dar_LibBuildBest( Dar_Man_t * p )
 {
     int i, Counter = 4;
     for ( i = 0; i < Vec_PtrSize(p->vLeavesBest); i++ )
-        s_DarLib->pDatas[i].pFunc = (Aig_Obj_t *)Vec_PtrEntry( p->vLeavesBest, i );
-    Dar_LibBuildClear_rec( Dar_LibObj(s_DarLib, p->OutBest), &Counter );
+        p->pLibDatas[i].pFunc = (Aig_Obj_t *)Vec_PtrEntry( p->vLeavesBest, i );
+    Dar_LibBuildClear_rec( p, Dar_LibObj(s_DarLib, p->OutBest), &Counter );
     return Dar_LibBuildBest_rec( p, Dar_LibObj(s_DarLib, p->OutBest) );
 }
 
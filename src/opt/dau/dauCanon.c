@@ -801,7 +801,7 @@ int Abc_TtCofactorPermNaive( word * pTruth, int i, int nWords, int fSwapOnly )
 {
     if ( fSwapOnly )
     {
-        static word pCopy[1024];
+        word pCopy[1024];
         Abc_TtCopy( pCopy, pTruth, nWords, 0 );
         Abc_TtSwapAdjacent( pCopy, nWords, i );
         if ( Abc_TtCompareRev(pTruth, pCopy, nWords) == 1 )
@@ -812,8 +812,8 @@ int Abc_TtCofactorPermNaive( word * pTruth, int i, int nWords, int fSwapOnly )
         return 0;
     }
     {
-        static word pCopy[1024];
-        static word pBest[1024];
+        word pCopy[1024];
+        word pBest[1024];
         int Config = 0;
         // save two copies
         Abc_TtCopy( pCopy, pTruth, nWords, 0 );
@@ -992,7 +992,7 @@ int Abc_TtCofactorPerm( word * pTruth, int i, int nWords, int fSwapOnly, char *
         return Config;
     }
     {
-        static word pCopy1[1024];
+        word pCopy1[1024];
         int Config;
         Abc_TtCopy( pCopy1, pTruth, nWords, 0 );
         Config = Abc_TtCofactorPermConfig( pTruth, i, nWords, 0, fNaive );
@@ -1532,7 +1532,7 @@ unsigned Abc_TtCanonicizeWrap(TtCanonicizeFunc func, Abc_TtHieMan_t * p, word *
     int nWords = Abc_TtWordNum(nVars);
     unsigned uCanonPhase1, uCanonPhase2;
     char pCanonPerm2[16];
-    static word pTruth2[1024];
+    word pTruth2[1024];
 
     Abc_TtNormalizeSmallTruth(pTruth, nVars);
     if (Abc_TtCountOnesInTruth(pTruth, nVars) != nWords * 32)
@@ -1547,13 +1547,18 @@ unsigned Abc_TtCanonicizeWrap(TtCanonicizeFunc func, Abc_TtHieMan_t * p, word *
     return uCanonPhase2;
 }
 
-word gpVerCopy[1024];
+// the original function is saved by each thread for verification
+#ifdef _MSC_VER
+static word gpVerCopy[1024];
+#else
+static __thread word gpVerCopy[1024];
+#endif
 static int Abc_TtCannonVerify(word* pTruth, int nVars, char * pCanonPerm, unsigned uCanonPhase)
 {
 #ifdef CANON_VERIFY
     int nWords = Abc_TtWordNum(nVars);
     char pCanonPermCopy[16];
-    static word pCopy2[1024];
+    word pCopy2[1024];
     Abc_TtVerifySmallTruth(pTruth, nVars);
     Abc_TtCopy(pCopy2, pTruth, nWords, 0);
     memcpy(pCanonPermCopy, pCanonPerm, sizeof(char) * nVars);
@@ -1767,10 +1772,9 @@ SeeAlso     []
 
 ***********************************************************************/
 
-static word pSymCopy[1024];
-
 static int Abc_TtIsSymmetric(word * pTruth, int nVars, int iVar, int jVar, int fPhase)
 {
+    word pSymCopy[1024];
     int rv;
     int nWords = Abc_TtWordNum(nVars);
     Abc_TtCopy(pSymCopy, pTruth, nWords, 0);
@@ -1784,6 +1788,7 @@ static int Abc_TtIsSymmetric(word * pTruth, int nVars, int iVar, int jVar, int f
 
 static int Abc_TtIsSymmetricHigh(Abc_TgMan_t * pMan, int iVar, int jVar, int fPhase)
 {
+    word pSymCopy[1024];
     int rv, iv, jv, n;
     int nWords = Abc_TtWordNum(pMan->nVars);
     Abc_TtCopy(pSymCopy, pMan->pTruth, nWords, 0);
@@ -2051,8 +2056,8 @@ SeeAlso     []
 static int Abc_TgSymGroupPerm(Abc_TgMan_t* pMan, int idx, int fSwapOnly)
 {
     word* pTruth = pMan->pTruth;
-    static word pCopy[1024];
-    static word pBest[1024];
+    word pCopy[1024];
+    word pBest[1024];
     int Config = 0;
     int nWords = Abc_TtWordNum(pMan->nVars);
     Abc_TgMan_t tgManCopy, tgManBest;
@@ -2130,7 +2135,7 @@ static int Abc_TgSymGroupPerm(Abc_TgMan_t* pMan, int idx, int fSwapOnly)
 
 static int Abc_TgPermPhase(Abc_TgMan_t* pMan, int iVar)
 {
-    static word pCopy[1024];
+    word pCopy[1024];
     int nWords = Abc_TtWordNum(pMan->nVars);
     int ivp = pMan->pPermTRev[iVar];
     Abc_TtCopy(pCopy, pMan->pTruth, nWords, 0);
@@ -2367,7 +2372,7 @@ static int Abc_TgPermCostScc(Abc_TgMan_t * pMan, int *pScc)
 
 static void Abc_TgPermEnumerationScc(Abc_TgMan_t * pMan, Abc_TgMan_t * pBest)
 {
-    static word pCopy[1024];
+    word pCopy[1024];
     Abc_TgMan_t tgManCopy;
     Abc_TgManCopy(&tgManCopy, pCopy, pMan);
     if (pMan->nAlgorithm > 1)
@@ -2487,7 +2492,7 @@ static void Abc_TgPhaseEnumerationScc(Abc_TgMan_t * pMan, Abc_TgMan_t * pBest)
     Vec_Int_t * vPhase = pMan->vPhase;
     int i, j, n = pMan->pGroup->nGVars;
     int ph0 = 0, ph, flp;
-    static word pCopy[1024];
+    word pCopy[1024];
     Abc_TgMan_t tgManCopy;
 
     if (pMan->fPhased)
@@ -2574,7 +2579,7 @@ unsigned Abc_TtCanonicizeAda(Abc_TtHieMan_t * p, word * pTruth, int nVars, char
 {
     int nWords = Abc_TtWordNum(nVars);
     unsigned fExac = 0, fHash = 1 << 29;
-    static word pCopy[1024];
+    word pCopy[1024];
     Abc_TgMan_t tgMan, tgManCopy;
     int iCost;
     const int MaxCost = 84;  // maximun posible cost for function with 16 inputs
@@ -2638,7 +2643,7 @@ unsigned Abc_TtCanonicizeCA(Abc_TtHieMan_t * p, word * pTruth, int nVars, char *
 {
     int nWords = Abc_TtWordNum(nVars);
     unsigned fHard = 0, fHash = 1 << 29;
-    static word pCopy[1024];
+    word pCopy[1024];
     Abc_TgMan_t tgMan, tgManCopy;
     Abc_SccCost_t sc;
 
@@ -80,6 +80,10 @@ struct Abs_Par_t_
     int            iFrameProved;       // the number of frames proved
     int            nFramesNoChange;    // the number of last frames without changes
     int            nFramesNoChangeLim; // the number of last frames without changes to dump abstraction
+    int            nProcs;             // the number of concurrent workers (0 = unused)
+    int            nSeed;              // the random seed of the SAT solver (0 = default)
+    int            fSilent;            // suppresses all output
+    void *         pShare;             // the state shared by concurrent workers
 };
 
 // old abstraction parameters
@@ -116,7 +120,16 @@ static inline int         Ga2_ObjLeaveNum( Gia_Man_t * p, Gia_Obj_t * pObj )
 static inline int *       Ga2_ObjLeavePtr( Gia_Man_t * p, Gia_Obj_t * pObj )        { return Vec_IntEntryP(p->vMapping, Ga2_ObjOffset(p, pObj) + 1);                                                }
 static inline unsigned    Ga2_ObjTruth( Gia_Man_t * p, Gia_Obj_t * pObj )           { return (unsigned)Vec_IntEntry(p->vMapping, Ga2_ObjOffset(p, pObj) + Ga2_ObjLeaveNum(p, pObj) + 1);            }
 static inline int         Ga2_ObjRefNum( Gia_Man_t * p, Gia_Obj_t * pObj )          { return (unsigned)Vec_IntEntry(p->vMapping, Ga2_ObjOffset(p, pObj) + Ga2_ObjLeaveNum(p, pObj) + 2);            }
-static inline Vec_Int_t * Ga2_ObjLeaves( Gia_Man_t * p, Gia_Obj_t * pObj )          { static Vec_Int_t v; v.nSize = Ga2_ObjLeaveNum(p, pObj), v.pArray = Ga2_ObjLeavePtr(p, pObj); return &v;       }
+static inline Vec_Int_t * Ga2_ObjLeaves( Gia_Man_t * p, Gia_Obj_t * pObj )
+{
+#ifdef _MSC_VER
+    static Vec_Int_t v;
+#else
+    static __thread Vec_Int_t v; // concurrent GLA workers use their own copy
+#endif
+    v.nSize = Ga2_ObjLeaveNum(p, pObj), v.pArray = Ga2_ObjLeavePtr(p, pObj);
+    return &v;
+}
 
 ////////////////////////////////////////////////////////////////////////
 ///                    FUNCTION DECLARATIONS                         ///
@@ -140,6 +153,9 @@ extern Gia_Man_t *       Gia_ManShrinkGla( Gia_Man_t * p, int nFrameMax, int nTi
 extern void              Gia_GlaProveAbsracted( Gia_Man_t * p, int fSimpProver, int fVerbose );
 extern void              Gia_GlaProveCancel( int fVerbose );
 extern int               Gia_GlaProveCheck( int fVerbose );
+extern Vec_Int_t *       Gia_GlaShareExchange( void * pShare, int iFrame, Vec_Int_t * vGateClasses, int * piVersion );
+extern int               Gia_GlaShareStop( void * pShare );
+extern int               Gia_ManPerformGlaPar( Gia_Man_t * p, Abs_Par_t * pPars );
 /*=== absVta.c =========================================================*/
 extern int               Gia_VtaPerform( Gia_Man_t * pAig, Abs_Par_t * pPars );
 /*=== absUtil.c =========================================================*/
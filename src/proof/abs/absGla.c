@@ -62,6 +62,8 @@ struct Ga2_Man_t_
     int            nCexes;       // the number of counter-examples
     int            nObjAdded;    // objs added during refinement
     int            nPdrCalls;    // count the number of concurrent calls
+    int            iShareVersion; // the last abstraction received from other workers
+    int            nObjAdopted;  // objs added from the abstractions of other workers
     // hash table
     int *          pTable;
     int            nTable;
@@ -92,6 +94,8 @@ static inline int         Ga2_ObjIsLeaf0( Ga2_Man_t * p, Gia_Obj_t * pObj )
 static inline int         Ga2_ObjIsAbs( Ga2_Man_t * p, Gia_Obj_t * pObj )        { return Ga2_ObjId(p,pObj) >= 0 &&  Ga2_ObjCnf0(p,pObj);                                                   }
 static inline int         Ga2_ObjIsLeaf( Ga2_Man_t * p, Gia_Obj_t * pObj )       { return Ga2_ObjId(p,pObj) >= 0 && !Ga2_ObjCnf0(p,pObj);                                                   }
 
+static inline int         Ga2_ManCheckStop( Abs_Par_t * pPars )                   { return (pPars->pFuncStop && pPars->pFuncStop(pPars->RunId)) || (pPars->pShare && Gia_GlaShareStop(pPars->pShare)); }
+
 static inline Vec_Int_t * Ga2_MapFrameMap( Ga2_Man_t * p, int f )                { return (Vec_Int_t *)Vec_PtrEntry( p->vId2Lit, f );                                                       }
 
 // returns literal of this object, or -1 if SAT variable of the object is not assigned
@@ -1122,6 +1126,8 @@ void Ga2_ManRestart( Ga2_Man_t * p )
     p->pSat->nLearntDelta = p->pPars->nLearnedDelta;
     p->pSat->nLearntRatio = p->pPars->nLearnedPerce;
     p->pSat->nLearntMax   = p->pSat->nLearntStart;
+    if ( p->pPars->nSeed )
+        p->pSat->random_seed += p->pPars->nSeed;
     // add clause x0 = 0  (lit0 = 1; lit1 = 0)
     sat_solver2_addclause( p->pSat, &Lit, &Lit + 1, -1 );
     // remove previous abstraction
@@ -1486,6 +1492,46 @@ void Gia_Ga2SendCancel( Ga2_Man_t * p, int fVerbose )
     Gia_ManToBridgeBadAbs( stdout );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Exchanges abstractions with other workers.]
+
+  Description [Publishes the current abstraction if it covers more frames
+  than the abstractions of other workers. Otherwise, adds to the current
+  abstraction the objects of the best abstraction published by another
+  worker. Returns the number of objects added.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Ga2_ManAbsExchange( Ga2_Man_t * p )
+{
+    Vec_Int_t * vGates, * vToAdd;
+    Gia_Obj_t * pObj;
+    int i, nAdded;
+    vGates = Gia_GlaShareExchange( p->pPars->pShare, p->pPars->iFrameProved, p->pGia->vGateClasses, &p->iShareVersion );
+    if ( vGates == NULL )
+        return 0;
+    // collect the marked objects that are not in the abstraction yet
+    vToAdd = Vec_IntAlloc( 1000 );
+    Gia_ManForEachRo( p->pGia, pObj, i )
+        if ( pObj->fPhase && Vec_IntEntry(vGates, Gia_ObjId(p->pGia, pObj)) && !Ga2_ObjIsAbs(p, pObj) )
+            Vec_IntPush( vToAdd, Gia_ObjId(p->pGia, pObj) );
+    Gia_ManForEachAnd( p->pGia, pObj, i )
+        if ( pObj->fPhase && Vec_IntEntry(vGates, i) && !Ga2_ObjIsAbs(p, pObj) )
+            Vec_IntPush( vToAdd, i );
+    Vec_IntFree( vGates );
+    // add them to the abstraction in all timeframes
+    assert( p->pSat->pPrf2 == NULL );
+    Ga2_ManAddToAbs( p, vToAdd );
+    nAdded = Vec_IntSize( vToAdd );
+    p->nObjAdopted += nAdded;
+    Vec_IntFree( vToAdd );
+    return nAdded;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Performs gate-level abstraction.]
@@ -1527,6 +1573,9 @@ int Gia_ManPerformGla( Gia_Man_t * pAig, Abs_Par_t * pPars )
         Vec_IntWriteEntry( pAig->vGateClasses, 0, 1 );
         Vec_IntWriteEntry( pAig->vGateClasses, Gia_ObjFaninId0p(pAig, Gia_ManPo(pAig, 0)), 1 );
     }
+    // run concurrent workers
+    if ( pPars->nProcs > 1 && pPars->pShare == NULL && !Abc_FrameIsBridgeMode() )
+        return Gia_ManPerformGlaPar( pAig, pPars );
     // start the manager
     p = Ga2_ManStart( pAig, pPars );
     p->timeInit = Abc_Clock() - clk;
@@ -1576,7 +1625,7 @@ int Gia_ManPerformGla( Gia_Man_t * pAig, Abs_Par_t * pPars )
     for ( i = f = 0; !pPars->nFramesMax || f < pPars->nFramesMax; i++ )
     {
         int nAbsOld;
-        if ( pPars->pFuncStop && pPars->pFuncStop(pPars->RunId) )
+        if ( Ga2_ManCheckStop(pPars) )
             goto finish;
         // remember the timeframe
         p->pPars->iFrame = -1;
@@ -1587,7 +1636,7 @@ int Gia_ManPerformGla( Gia_Man_t * pAig, Abs_Par_t * pPars )
         // unroll the circuit
         for ( f = 0; !pPars->nFramesMax || f < pPars->nFramesMax; f++ )
         {
-            if ( pPars->pFuncStop && pPars->pFuncStop(pPars->RunId) )
+            if ( Ga2_ManCheckStop(pPars) )
                 goto finish;
             // remember current limits
             int nConflsBeg = sat_solver2_nconflicts(p->pSat);
@@ -1622,7 +1671,7 @@ int Gia_ManPerformGla( Gia_Man_t * pAig, Abs_Par_t * pPars )
             nVarsOld = p->nSatVars;
             for ( c = 0; ; c++ )
             {
-                if ( pPars->pFuncStop && pPars->pFuncStop(pPars->RunId) )
+                if ( Ga2_ManCheckStop(pPars) )
                 {
                     Status = l_Undef;
                     goto finish;
@@ -1798,6 +1847,12 @@ int Gia_ManPerformGla( Gia_Man_t * pAig, Abs_Par_t * pPars )
                     goto finish;
                 }
             }
+            // exchange abstractions with other workers
+            if ( pPars->pShare && Ga2_ManAbsExchange(p) )
+            {
+                Vec_IntFreeP( &pAig->vGateClasses );
+                pAig->vGateClasses = Ga2_ManAbsTranslate( p );
+            }
             // check the number of stable frames
             if ( p->pPars->nFramesNoChange == p->pPars->nFramesNoChangeLim )
             {
@@ -1853,7 +1908,7 @@ finish:
     if ( iFrameTryToProve >= 0 )
         Gia_GlaProveCancel( pPars->fVerbose );
     // analize the results
-    if ( !p->fUseNewLine )
+    if ( !p->fUseNewLine && !pPars->fSilent )
         Abc_Print( 1, "\n" );
     if ( RetValue == 1 )
         Abc_Print( 1, "GLA completed %d frames and proved abstraction derived in frame %d  ", p->pPars->iFrameProved+1, iFrameTryToProve );
@@ -1861,16 +1916,19 @@ finish:
     {
         Vec_IntFreeP( &pAig->vGateClasses );
         pAig->vGateClasses = Ga2_ManAbsTranslate( p );
-        if ( p->pSat && p->pPars->nTimeOut && Abc_Clock() >= p->pSat->nRuntimeLimit ) 
-            Abc_Print( 1, "GLA reached timeout %d sec in frame %d with a %d-stable abstraction.    ", p->pPars->nTimeOut, p->pPars->iFrameProved+1, p->pPars->nFramesNoChange );
-        else if ( p->pSat && pPars->nConfLimit && sat_solver2_nconflicts(p->pSat) >= pPars->nConfLimit )
-            Abc_Print( 1, "GLA exceeded %d conflicts in frame %d with a %d-stable abstraction.  ", pPars->nConfLimit, p->pPars->iFrameProved+1, p->pPars->nFramesNoChange );
-        else if ( pPars->nRatioMin2 && Vec_IntSize(p->vAbs) >= p->nMarked * pPars->nRatioMin2 / 100 )
-            Abc_Print( 1, "GLA found that the size of abstraction exceeds %d %% in frame %d during refinement.  ", pPars->nRatioMin2, p->pPars->iFrameProved+1 );
-        else if ( pPars->nRatioMin && Vec_IntSize(p->vAbs) >= p->nMarked * pPars->nRatioMin / 100 )
-            Abc_Print( 1, "GLA found that the size of abstraction exceeds %d %% in frame %d.  ", pPars->nRatioMin, p->pPars->iFrameProved+1 );
-        else
-            Abc_Print( 1, "GLA finished %d frames and produced a %d-stable abstraction.  ", p->pPars->iFrameProved+1, p->pPars->nFramesNoChange );
+        if ( !pPars->fSilent )
+        {
+            if ( p->pSat && p->pPars->nTimeOut && Abc_Clock() >= p->pSat->nRuntimeLimit ) 
+                Abc_Print( 1, "GLA reached timeout %d sec in frame %d with a %d-stable abstraction.    ", p->pPars->nTimeOut, p->pPars->iFrameProved+1, p->pPars->nFramesNoChange );
+            else if ( p->pSat && pPars->nConfLimit && sat_solver2_nconflicts(p->pSat) >= pPars->nConfLimit )
+                Abc_Print( 1, "GLA exceeded %d conflicts in frame %d with a %d-stable abstraction.  ", pPars->nConfLimit, p->pPars->iFrameProved+1, p->pPars->nFramesNoChange );
+            else if ( pPars->nRatioMin2 && Vec_IntSize(p->vAbs) >= p->nMarked * pPars->nRatioMin2 / 100 )
+                Abc_Print( 1, "GLA found that the size of abstraction exceeds %d %% in frame %d during refinement.  ", pPars->nRatioMin2, p->pPars->iFrameProved+1 );
+            else if ( pPars->nRatioMin && Vec_IntSize(p->vAbs) >= p->nMarked * pPars->nRatioMin / 100 )
+                Abc_Print( 1, "GLA found that the size of abstraction exceeds %d %% in frame %d.  ", pPars->nRatioMin, p->pPars->iFrameProved+1 );
+            else
+                Abc_Print( 1, "GLA finished %d frames and produced a %d-stable abstraction.  ", p->pPars->iFrameProved+1, p->pPars->nFramesNoChange );
+        }
         p->pPars->iFrame = p->pPars->iFrameProved;
     }
     else
@@ -1879,12 +1937,14 @@ finish:
             Abc_Print( 1, "\n" );
         if ( !Gia_ManVerifyCex( pAig, pAig->pCexSeq, 0 ) )
             Abc_Print( 1, "    Gia_ManPerformGlaOld(): CEX verification has failed!\n" );
-        Abc_Print( 1, "True counter-example detected in frame %d.  ", f );
+        if ( !pPars->fSilent )
+            Abc_Print( 1, "True counter-example detected in frame %d.  ", f );
         p->pPars->iFrame = f - 1;
         Vec_IntFreeP( &pAig->vGateClasses );
         RetValue = 0;
     }
-    Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    if ( !pPars->fSilent )
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
     if ( p->pPars->fVerbose )
     {
         p->timeOther = (Abc_Clock() - clk) - p->timeUnsat - p->timeSat - p->timeCex - p->timeInit;
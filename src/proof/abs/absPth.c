@@ -196,6 +196,234 @@ int Gia_GlaProveCheck( int fVerbose )
 
 #endif // pthreads are used
 
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the state shared by concurrent GLA workers
+typedef struct Abs_GlaShare_t_ Abs_GlaShare_t;
+struct Abs_GlaShare_t_
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t  Mutex;          // protects the shared state
+#endif
+    volatile int     fStop;          // set when one of the workers is done
+    int              iWinner;        // the first worker who is done
+    int              iFrameBest;     // the frames covered by the best abstraction
+    Vec_Int_t *      vGatesBest;     // the best abstraction
+    int              nVersions;      // the number of abstractions published
+    int              nAdopted;       // the number of abstractions adopted
+    int           (* pFuncStop)(int); // the callback of the caller
+    int              RunId;          // the run ID of the caller
+};
+
+// one GLA worker
+typedef struct Abs_GlaWorker_t_ Abs_GlaWorker_t;
+struct Abs_GlaWorker_t_
+{
+    Gia_Man_t *      pGia;           // the copy of the AIG
+    Abs_Par_t        Pars;           // the parameters of this worker
+    int              RetValue;       // the result of this worker
+};
+
+static inline void Abs_GlaShareLock( Abs_GlaShare_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    int status = pthread_mutex_lock( &p->Mutex );  assert( status == 0 );
+#endif
+}
+static inline void Abs_GlaShareUnlock( Abs_GlaShare_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    int status = pthread_mutex_unlock( &p->Mutex );  assert( status == 0 );
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Exchanges abstractions between concurrent GLA workers.]
+
+  Description [If the abstraction of the worker covers more frames than
+  the best abstraction, it becomes the best one. If it covers fewer frames
+  and the best abstraction was not seen by this worker, returns a copy of
+  the best abstraction, which the worker should add to its own. Otherwise,
+  returns NULL. The version of the last abstraction published or seen by
+  the worker is kept in piVersion.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Gia_GlaShareExchange( void * pShare, int iFrame, Vec_Int_t * vGateClasses, int * piVersion )
+{
+    Abs_GlaShare_t * p = (Abs_GlaShare_t *)pShare;
+    Vec_Int_t * vGates = NULL;
+    Abs_GlaShareLock( p );
+    if ( iFrame > p->iFrameBest )
+    {
+        Vec_IntFreeP( &p->vGatesBest );
+        p->vGatesBest = Vec_IntDup( vGateClasses );
+        p->iFrameBest = iFrame;
+        *piVersion = ++p->nVersions;
+    }
+    else if ( iFrame < p->iFrameBest && *piVersion < p->nVersions )
+    {
+        vGates = Vec_IntDup( p->vGatesBest );
+        *piVersion = p->nVersions;
+        p->nAdopted++;
+    }
+    Abs_GlaShareUnlock( p );
+    return vGates;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the concurrent GLA workers should stop.]
+
+  Description [The workers stop when one of them is done or when the
+  callback of the caller asks to stop.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_GlaShareStop( void * pShare )
+{
+    Abs_GlaShare_t * p = (Abs_GlaShare_t *)pShare;
+    return p->fStop || (p->pFuncStop && p->pFuncStop(p->RunId));
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs one GLA worker.]
+
+  Description [The first worker to finish stops the other ones.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abs_GlaWorkerThread( void * pArg )
+{
+    Abs_GlaWorker_t * pWorker = (Abs_GlaWorker_t *)pArg;
+    Abs_GlaShare_t * p = (Abs_GlaShare_t *)pWorker->Pars.pShare;
+    pWorker->RetValue = Gia_ManPerformGla( pWorker->pGia, &pWorker->Pars );
+    Abs_GlaShareLock( p );
+    if ( !p->fStop )
+        p->iWinner = pWorker->Pars.RunId;
+    p->fStop = 1;
+    Abs_GlaShareUnlock( p );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs gate-level abstraction using concurrent workers.]
+
+  Description [Each worker runs GLA on its own copy of the AIG using a
+  different random seed of the SAT solver and different refinement
+  heuristics, so that the workers see different counter-examples.
+  After each timeframe, the worker whose abstraction covers the largest
+  number of frames publishes it, and the workers lagging behind add it
+  to their abstractions. When one worker is done, the other ones are
+  stopped. The result is a real counter-example, if found, or else the
+  abstraction covering the largest number of frames, or else the smallest
+  one among them.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManPerformGlaPar( Gia_Man_t * pAig, Abs_Par_t * pPars )
+{
+    Abs_GlaShare_t * p;
+    Abs_GlaWorker_t * pWorkers, * pWorker, * pBest = NULL;
+    Vec_Ptr_t * vWorkers = Vec_PtrAlloc( pPars->nProcs );
+    abctime clk = Abc_Clock();
+    int i, nGates, nGatesBest = 0, RetValue;
+    assert( pPars->nProcs > 1 && pPars->pShare == NULL );
+    assert( !pPars->fDumpVabs && !pPars->fDumpMabs && !pPars->fCallProver );
+    p = ABC_CALLOC( Abs_GlaShare_t, 1 );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_init( &p->Mutex, NULL );
+#endif
+    p->iWinner    = -1;
+    p->iFrameBest = -1;
+    p->pFuncStop  = pPars->pFuncStop;
+    p->RunId      = pPars->RunId;
+    // prepare the workers
+    pWorkers = ABC_CALLOC( Abs_GlaWorker_t, pPars->nProcs );
+    for ( i = 0; i < pPars->nProcs; i++ )
+    {
+        pWorker = pWorkers + i;
+        pWorker->pGia = Gia_ManDup( pAig );
+        pWorker->pGia->vGateClasses = Vec_IntDup( pAig->vGateClasses );
+        pWorker->Pars = *pPars;
+        pWorker->Pars.nSeed         = pPars->nSeed + i;
+        pWorker->Pars.fNewRefine   ^= (i & 1);
+        pWorker->Pars.fPropFanout  ^= ((i >> 1) & 1);
+        pWorker->Pars.fVerbose      = 0;
+        pWorker->Pars.fVeryVerbose  = 0;
+        pWorker->Pars.fSilent       = 1;
+        pWorker->Pars.RunId         = i;
+        pWorker->Pars.pFuncStop     = NULL;
+        pWorker->Pars.pShare        = p;
+        Vec_PtrPush( vWorkers, pWorker );
+    }
+    if ( pPars->fVerbose )
+        Abc_Print( 1, "Running gate-level abstraction (GLA) with %d concurrent workers.\n", pPars->nProcs );
+    Util_ProcessThreads( Abs_GlaWorkerThread, vWorkers, pPars->nProcs + 1, 0, 0 );
+    // select the result
+    for ( i = 0; i < pPars->nProcs; i++ )
+    {
+        pWorker = pWorkers + i;
+        nGates = pWorker->pGia->vGateClasses ? Gia_GlaCountFlops(pWorker->pGia, pWorker->pGia->vGateClasses) + Gia_GlaCountNodes(pWorker->pGia, pWorker->pGia->vGateClasses) : 0;
+        if ( pPars->fVerbose )
+            Abc_Print( 1, "Worker %2d : Seed = %3d  NewRef = %s  Fanout = %s  Frames = %5d  Gates = %8d  %s\n", 
+                i, pWorker->Pars.nSeed, pWorker->Pars.fNewRefine ? "yes" : " no", pWorker->Pars.fPropFanout ? "yes" : " no", 
+                pWorker->Pars.iFrame+1, nGates, pWorker->RetValue == 0 ? "(cex)" : (i == p->iWinner ? "(done)" : "") );
+        if ( pBest == NULL || 
+             (pWorker->RetValue == 0) > (pBest->RetValue == 0) ||
+            ((pWorker->RetValue == 0) == (pBest->RetValue == 0) && pWorker->Pars.iFrame > pBest->Pars.iFrame) ||
+            ((pWorker->RetValue == 0) == (pBest->RetValue == 0) && pWorker->Pars.iFrame == pBest->Pars.iFrame && nGates < nGatesBest) )
+            pBest = pWorker, nGatesBest = nGates;
+    }
+    // transfer the result
+    Vec_IntFreeP( &pAig->vGateClasses );
+    Abc_CexFreeP( &pAig->pCexSeq );
+    ABC_SWAP( Vec_Int_t *, pAig->vGateClasses, pBest->pGia->vGateClasses );
+    ABC_SWAP( Abc_Cex_t *, pAig->pCexSeq, pBest->pGia->pCexSeq );
+    pPars->iFrame          = pBest->Pars.iFrame;
+    pPars->iFrameProved    = pBest->Pars.iFrameProved;
+    pPars->nFramesNoChange = pBest->Pars.nFramesNoChange;
+    RetValue = pBest->RetValue;
+    if ( RetValue == 0 )
+        Abc_Print( 1, "True counter-example detected in frame %d.  ", pAig->pCexSeq->iFrame );
+    else
+        Abc_Print( 1, "GLA with %d workers finished %d frames and produced a %d-stable abstraction (%d published, %d adopted).  ", 
+            pPars->nProcs, pPars->iFrame+1, pPars->nFramesNoChange, p->nVersions, p->nAdopted );
+    Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    // clean up
+    for ( i = 0; i < pPars->nProcs; i++ )
+        Gia_ManStop( pWorkers[i].pGia );
+    ABC_FREE( pWorkers );
+    Vec_PtrFree( vWorkers );
+    Vec_IntFreeP( &p->vGatesBest );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_destroy( &p->Mutex );
+#endif
+    ABC_FREE( p );
+    return RetValue;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
@@ -82,6 +82,7 @@ struct Rnm_Man_t_
     int             nCalls;          // total number of calls
     int             nRefines;        // total refined objects
     int             nVisited;        // visited during justification
+    int             nFilters;        // the number of calls to filtering
     // statistics  
     abctime         timeFwd;         // forward propagation
     abctime         timeBwd;         // backward propagation
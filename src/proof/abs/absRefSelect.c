@@ -206,14 +206,13 @@ Vec_Int_t * Rnm_ManFilterSelected( Rnm_Man_t * p, Vec_Int_t * vOldPPis )
 ***********************************************************************/
 Vec_Int_t * Rnm_ManFilterSelectedNew( Rnm_Man_t * p, Vec_Int_t * vOldPPis )
 {
-    static int Counter = 0;
     int fVerbose = 0;
     Vec_Int_t * vNewPPis, * vFanins, * vFanins2;
     Gia_Obj_t * pObj, * pFanin, * pFanin2;
     int i, k, k2, RetValue, Counters[3] = {0};
 
     // return full set of PPIs once in a while
-    if ( ++Counter % 9 == 0 )
+    if ( ++p->nFilters % 9 == 0 )
         return Vec_IntDup( vOldPPis );
     return Rnm_ManFilterSelected( p, vOldPPis );
 
@@ -56,6 +56,9 @@ struct Pln_Man_t_
     Vec_Int_t *    vOrder;    // order of collapsing
     int            nBuilds;   // built monomials
     int            nUsed;     // used monomials
+    int            nCompacts; // the number of compactions
+    int            nMemLimit; // memory limit in MB (0 = no limit)
+    int            fAborted;  // the memory limit is reached
 };
 
 ////////////////////////////////////////////////////////////////////////
@@ -114,6 +117,11 @@ void Pln_ManStop( Pln_Man_t * p )
     Vec_IntFree( p->vOrder );
     ABC_FREE( p );
 }
+double Pln_ManMemory( Pln_Man_t * p )
+{
+    return Hsh_VecManMemory(p->pHashC) + Hsh_VecManMemory(p->pHashM) + Vec_QueMemory(p->vQue) + 
+        Vec_FltMemory(p->vCounts) + Vec_IntMemory(p->vCoefs) + Vec_IntMemory(p->vOrder);
+}
 int Pln_ManCompare3( int * pData0, int * pData1 )
 {
     if ( pData0[0] < pData1[0] ) return -1;
@@ -337,13 +345,77 @@ void Gia_PolynBuildOne( Pln_Man_t * p, int iMono )
     else   
         Gia_PolynBuildAdd( p, p->vTempC[0], p->vTempM[3] );   //  C * x * y
 }
-void Gia_PolynBuild( Gia_Man_t * pGia, Vec_Int_t * vOrder, int fSigned, int fVerbose, int fVeryVerbose )
+
+/**Function*************************************************************
+
+  Synopsis    [Removes the monomials whose coefficients are zero.]
+
+  Description [The monomials are never removed from the hash tables,
+  so the tables are mostly filled with the monomials, which were
+  substituted by the fanins of their last nodes. This procedure
+  rebuilds the tables using only the monomials that are still used
+  and the constants they refer to.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pln_ManCompact( Pln_Man_t * p )
 {
-    abctime clk = Abc_Clock();//, clk2 = 0;
+    Hsh_VecMan_t * pHashC = Hsh_VecManStart( 2 * p->nUsed + 1000 );
+    Hsh_VecMan_t * pHashM = Hsh_VecManStart( 2 * p->nUsed + 1000 );
+    Vec_Int_t * vCoefs  = Vec_IntAlloc( 2 * p->nUsed + 1000 );
+    Vec_Flt_t * vCounts = Vec_FltAlloc( 2 * p->nUsed + 1000 );
+    Vec_Int_t * vQueue  = Vec_IntAlloc( Vec_QueSize(p->vQue) );
+    int iMono, iConst, iMonoNew;
+    Vec_IntClear( p->vTempC[0] );
+    Hsh_VecManAdd( pHashC, p->vTempC[0] );
+    Vec_IntForEachEntry( p->vCoefs, iConst, iMono )
+    {
+        if ( iMono > 0 && iConst == 0 )
+            continue;
+        iMonoNew = Hsh_VecManAdd( pHashM, Hsh_VecReadEntry(p->pHashM, iMono) );
+        assert( iMonoNew == Vec_IntSize(vCoefs) );
+        Vec_IntPush( vCoefs, iConst ? Hsh_VecManAdd(pHashC, Hsh_VecReadEntry(p->pHashC, iConst)) : 0 );
+        Vec_FltPush( vCounts, Vec_FltEntry(p->vCounts, iMono) );
+        if ( Vec_QueIsMember(p->vQue, iMono) )
+            Vec_IntPush( vQueue, iMonoNew );
+    }
+    Vec_QueClear( p->vQue );
+    ABC_SWAP( Hsh_VecMan_t *, p->pHashC, pHashC );
+    ABC_SWAP( Hsh_VecMan_t *, p->pHashM, pHashM );
+    ABC_SWAP( Vec_Int_t, *p->vCoefs, *vCoefs );
+    ABC_SWAP( Vec_Flt_t, *p->vCounts, *vCounts );
+    Vec_IntForEachEntry( vQueue, iMono, iConst )
+        Vec_QuePush( p->vQue, iMono );
+    Hsh_VecManStop( pHashC );
+    Hsh_VecManStop( pHashM );
+    Vec_IntFree( vCoefs );
+    Vec_FltFree( vCounts );
+    Vec_IntFree( vQueue );
+    p->nCompacts++;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs backward rewriting of the outputs.]
+
+  Description [The first procedure adds the signature of the outputs.
+  The second procedure substitutes the monomials until only the inputs
+  are left. It returns 0 if rewriting is stopped because the memory
+  limit is reached.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_PolynBuildOutputs( Pln_Man_t * p, int fSigned )
+{
+    Gia_Man_t * pGia = p->pGia;
     Gia_Obj_t * pObj; 
-    Vec_Bit_t * vPres = Vec_BitStart( Gia_ManObjNum(pGia) );
-    int i, iMono, iDriver, LevPrev, LevCur, Iter, Line = 0;
-    Pln_Man_t * p = Pln_ManAlloc( pGia, vOrder );
+    int i, iDriver;
     Gia_ManForEachCoReverse( pGia, pObj, i )
     {
         Vec_IntFill( p->vTempC[0], 1,  i+1 );      //  2^i
@@ -373,6 +445,12 @@ void Gia_PolynBuild( Gia_Man_t * pGia, Vec_Int_t * vOrder, int fSigned, int fVer
                 Gia_PolynBuildAdd( p, p->vTempC[0], p->vTempM[0] );   //  C * Driver
         }
     }
+}
+int Gia_PolynBuildRewrite( Pln_Man_t * p, int fVerbose, int fVeryVerbose )
+{
+    Gia_Man_t * pGia = p->pGia;
+    Vec_Bit_t * vPres = Vec_BitStart( Gia_ManObjNum(pGia) );
+    int iMono, LevPrev, LevCur, Iter, Line = 0;
     LevPrev = -1;
     for ( Iter = 0; ; Iter++ )
     {
@@ -380,6 +458,16 @@ void Gia_PolynBuild( Gia_Man_t * pGia, Vec_Int_t * vOrder, int fSigned, int fVer
         //abctime temp = Abc_Clock();
         if ( Vec_QueSize(p->vQue) == 0 )
             break;
+        if ( (Iter & 0xFFF) == 0 )
+        {
+            if ( Hsh_VecSize(p->pHashM) > 2 * p->nUsed + 100000 )
+                Pln_ManCompact( p );
+            if ( p->nMemLimit && Pln_ManMemory(p) > (double)p->nMemLimit * (1 << 20) )
+            {
+                p->fAborted = 1;
+                break;
+            }
+        }
         iMono = Vec_QuePop(p->vQue);
 
         // report
@@ -406,10 +494,42 @@ void Gia_PolynBuild( Gia_Man_t * pGia, Vec_Int_t * vOrder, int fSigned, int fVer
         //clk2 += Abc_Clock() - temp;
     }
     //Abc_PrintTime( 1, "Time2", clk2 );
-    Pln_ManPrintFinal( p, fVerbose, fVeryVerbose );
+    Vec_BitFree( vPres );
+    return Vec_QueSize(p->vQue) == 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the polynomial of the outputs by backward rewriting.]
+
+  Description [Rewriting is stopped when the memory used by the manager
+  exceeds the memory limit (nMemLimit in MB, 0 = no limit). Returns 0
+  if rewriting is stopped.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_PolynBuildMem( Gia_Man_t * pGia, Vec_Int_t * vOrder, int fSigned, int nMemLimit, int fVerbose, int fVeryVerbose )
+{
+    abctime clk = Abc_Clock();
+    Pln_Man_t * p = Pln_ManAlloc( pGia, vOrder );
+    int RetValue;
+    p->nMemLimit = nMemLimit;
+    Gia_PolynBuildOutputs( p, fSigned );
+    RetValue = Gia_PolynBuildRewrite( p, fVerbose, fVeryVerbose );
+    if ( RetValue )
+        Pln_ManPrintFinal( p, fVerbose, fVeryVerbose );
+    else
+        printf( "Rewriting is stopped after reaching the memory limit (%d MB).  ", nMemLimit );
     Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
     Pln_ManStop( p );
-    Vec_BitFree( vPres );
+    return RetValue;
+}
+void Gia_PolynBuild( Gia_Man_t * pGia, Vec_Int_t * vOrder, int fSigned, int fVerbose, int fVeryVerbose )
+{
+    Gia_PolynBuildMem( pGia, vOrder, fSigned, 0, fVerbose, fVeryVerbose );
 }
 
 
@@ -930,6 +930,189 @@ int Cec_ManSimSimulateRoundSavePhase( Cec_ManSim_t * p, Vec_Ptr_t * vInfoCis, Ve
     return Cec_ManSimSimulateRoundInt( p, vInfoCis, vInfoCos, pSave );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Refines the class of the node if it has changed nodes.]
+
+  Description [The nodes, which are not in the fanout, get the constant
+  simulation info for the time of refinement.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cec_ManSimIncrRefineClass( Cec_ManSim_t * p, int iRepr )
+{
+    Gia_Man_t * pAig = p->pAig;
+    unsigned * pRes;
+    int k, w, Ent, fChanged = 0;
+    Gia_ClassForEachObj( pAig, iRepr, Ent )
+        if ( Vec_IntEntry(pAig->vTimeStamps, Ent) == pAig->iTimeStamp )
+        {
+            fChanged = 1;
+            break;
+        }
+    if ( !fChanged )
+        return;
+    Vec_IntClear( p->vClassTemp );
+    Gia_ClassForEachObj( pAig, iRepr, Ent )
+    {
+        Vec_IntPush( p->vClassTemp, Ent );
+        if ( Vec_IntEntry(pAig->vTimeStamps, Ent) == pAig->iTimeStamp )
+            continue;
+        pRes = Cec_ManSimSimRef( p, Ent );
+        pRes[0] = 1;
+        for ( w = 1; w <= p->nWords; w++ )
+            pRes[w] = Gia_ManObj(pAig, Ent)->fPhase ? ~0 : 0;
+    }
+    Cec_ManSimClassRefineOne( p, iRepr );
+    Vec_IntForEachEntry( p->vClassTemp, Ent, k )
+        Cec_ManSimSimDeref( p, Ent );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates one round incrementally.]
+
+  Description [Simulates only the transitive fanout of the CIs, which have
+  non-zero patterns, and refines only the classes containing the nodes in
+  the fanout. The CI patterns, which are not assigned by the counter-examples,
+  should be zero, so that the nodes outside of the fanout have the value of
+  their phase in all patterns. The AIG should have the time stamps of all
+  objects allocated and the phases assigned. Returns the number of PO entry
+  if failed; 0 otherwise.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cec_ManSimSimulateRoundIncr( Cec_ManSim_t * p, Vec_Ptr_t * vInfoCis, Vec_Ptr_t * vInfoCos )
+{
+    Gia_Man_t * pAig = p->pAig;
+    Gia_Obj_t * pObj;
+    unsigned * pRes0, * pRes1, * pRes, * pConst[2];
+    int i, k, w, iCiId = 0, iCoId = 0;
+    assert( pAig->vTimeStamps != NULL && vInfoCis != NULL );
+    if ( p->pBestState )
+        return Cec_ManSimSimulateRound( p, vInfoCis, vInfoCos );
+    // prepare internal storage
+    if ( p->nWordsOld != p->nWords )
+        Cec_ManSimMemRelink( p );
+    p->nMemsMax = 0;
+    // the info of the nodes outside of the fanout
+    pConst[0] = ABC_CALLOC( unsigned, p->nWords + 1 );
+    pConst[1] = ABC_ALLOC( unsigned, p->nWords + 1 );
+    for ( w = 0; w <= p->nWords; w++ )
+        pConst[1][w] = ~0;
+    pAig->iTimeStamp++;
+    Vec_IntClear( p->vRefinedC );
+    Gia_ManForEachObj1( pAig, pObj, i )
+    {
+        if ( Gia_ObjIsCi(pObj) ) 
+        {
+            pRes0 = (unsigned *)Vec_PtrEntry( vInfoCis, iCiId++ );
+            // make sure the first pattern is always zero
+            pRes0[0] ^= (pRes0[0] & 1);
+            if ( Gia_ObjValue(pObj) == 0 || Cec_ManSimCompareConst(pRes0, p->nWords) )
+                goto classes;
+            Vec_IntWriteEntry( pAig->vTimeStamps, i, pAig->iTimeStamp );
+            pRes = Cec_ManSimSimRef( p, i );
+            for ( w = 1; w <= p->nWords; w++ )
+                pRes[w] = pRes0[w-1];
+            goto references;
+        }
+        if ( Gia_ObjIsCo(pObj) )
+        {
+            if ( Vec_IntEntry(pAig->vTimeStamps, Gia_ObjFaninId0(pObj,i)) == pAig->iTimeStamp )
+                pRes0 = Cec_ManSimSimDeref( p, Gia_ObjFaninId0(pObj,i) );
+            else
+                pRes0 = pConst[Gia_ObjFanin0(pObj)->fPhase];
+            if ( vInfoCos )
+            {
+                pRes = (unsigned *)Vec_PtrEntry( vInfoCos, iCoId++ );
+                if ( Gia_ObjFaninC0(pObj) )
+                    for ( w = 1; w <= p->nWords; w++ )
+                        pRes[w-1] = ~pRes0[w];
+                else 
+                    for ( w = 1; w <= p->nWords; w++ )
+                        pRes[w-1] = pRes0[w];
+            }
+            continue;
+        }
+        if ( Vec_IntEntry(pAig->vTimeStamps, Gia_ObjFaninId0(pObj,i)) != pAig->iTimeStamp &&
+             Vec_IntEntry(pAig->vTimeStamps, Gia_ObjFaninId1(pObj,i)) != pAig->iTimeStamp )
+            goto classes;
+        Vec_IntWriteEntry( pAig->vTimeStamps, i, pAig->iTimeStamp );
+        pRes = Cec_ManSimSimRef( p, i );
+        if ( Vec_IntEntry(pAig->vTimeStamps, Gia_ObjFaninId0(pObj,i)) == pAig->iTimeStamp )
+            pRes0 = Cec_ManSimSimDeref( p, Gia_ObjFaninId0(pObj,i) );
+        else
+            pRes0 = pConst[Gia_ObjFanin0(pObj)->fPhase];
+        if ( Vec_IntEntry(pAig->vTimeStamps, Gia_ObjFaninId1(pObj,i)) == pAig->iTimeStamp )
+            pRes1 = Cec_ManSimSimDeref( p, Gia_ObjFaninId1(pObj,i) );
+        else
+            pRes1 = pConst[Gia_ObjFanin1(pObj)->fPhase];
+        if ( Gia_ObjFaninC0(pObj) )
+        {
+            if ( Gia_ObjFaninC1(pObj) )
+                for ( w = 1; w <= p->nWords; w++ )
+                    pRes[w] = ~(pRes0[w] | pRes1[w]);
+            else
+                for ( w = 1; w <= p->nWords; w++ )
+                    pRes[w] = ~pRes0[w] & pRes1[w];
+        }
+        else
+        {
+            if ( Gia_ObjFaninC1(pObj) )
+                for ( w = 1; w <= p->nWords; w++ )
+                    pRes[w] = pRes0[w] & ~pRes1[w];
+            else
+                for ( w = 1; w <= p->nWords; w++ )
+                    pRes[w] = pRes0[w] & pRes1[w];
+        }
+
+references:
+        // if this node is candidate constant, collect it
+        if ( Gia_ObjIsConst(pAig, i) && !Cec_ManSimCompareConst(pRes + 1, p->nWords) )
+        {
+            pRes[0]++;
+            Vec_IntPush( p->vRefinedC, i );
+        }
+        // if the node belongs to a class, save it
+        if ( Gia_ObjIsClass(pAig, i) )
+            pRes[0]++;
+classes:
+        // if this is the last node of the class, process it
+        if ( Gia_ObjIsTail(pAig, i) )
+            Cec_ManSimIncrRefineClass( p, Gia_ObjRepr(pAig, i) );
+    }
+    ABC_FREE( pConst[0] );
+    ABC_FREE( pConst[1] );
+
+    if ( p->pPars->fConstCorr )
+    {
+        Vec_IntForEachEntry( p->vRefinedC, i, k )
+        {
+            Gia_ObjSetRepr( pAig, i, GIA_VOID );
+            Cec_ManSimSimDeref( p, i );
+        }
+        Vec_IntClear( p->vRefinedC );
+    }
+
+    if ( Vec_IntSize(p->vRefinedC) > 0 )
+        Cec_ManSimProcessRefined( p, p->vRefinedC );
+    assert( iCiId == Gia_ManCiNum(pAig) );
+    assert( vInfoCos == NULL || iCoId == Gia_ManCoNum(pAig) );
+    assert( p->nMems == 1 );
+    if ( p->nMems != 1 )
+        Abc_Print( 1, "Cec_ManSimSimulateRoundIncr(): Memory management error!\n" );
+    if ( p->pPars->fVeryVerbose )
+        Gia_ManEquivPrintClasses( pAig, 0, Cec_MemUsage(p) );
+    return Cec_ManSimAnalyzeOutputs( p );
+}
+
 
 
 /**Function*************************************************************
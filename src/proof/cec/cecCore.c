@@ -140,6 +140,7 @@ void Cec_ManFraSetDefaultParams( Cec_ParFra_t * p )
     p->fColorDiff     =       0;  // miter with separate outputs
     p->fSatSweeping   =       0;  // enable SAT sweeping
     p->fUseCones      =       0;  // use cones
+    p->fIncrSim       =       0;  // resimulate only the fanout of counter-examples
     p->fVeryVerbose   =       0;  // verbose stats
     p->fVerbose       =       0;  // verbose stats
     p->iOutFail       =      -1;  // the failed output
@@ -403,6 +404,7 @@ Gia_Man_t * Cec_ManSatSweeping( Gia_Man_t * pAig, Cec_ParFra_t * pPars, int fSil
     pParsSat->fVerbose = pPars->fVeryVerbose;
     // simulation patterns
     pPat = Cec_ManPatStart();
+    pPat->fZeroFill = pPars->fIncrSim;
     //pPat->fVerbose = pPars->fVeryVerbose;
 
     // start equivalence classes
@@ -60,6 +60,7 @@ struct Cec_ManPat_t_
     int              nPatLitsMin;    // total number of literals in minimized recent patterns
     int              nPatLitsMinAll; // total number of literals in minimized all patterns
     int              nSeries;        // simulation series
+    int              fZeroFill;      // fill unassigned pattern bits with zeros
     int              fVerbose;       // verbose stats
     // runtime statistics
     abctime          timeFind;       // detecting the pattern  
@@ -435,6 +436,7 @@ extern int                  Cec_ManSimClassesPrepare( Cec_ManSim_t * p, int Leve
 extern int                  Cec_ManSimClassesRefine( Cec_ManSim_t * p );
 extern int                  Cec_ManSimSimulateRound( Cec_ManSim_t * p, Vec_Ptr_t * vInfoCis, Vec_Ptr_t * vInfoCos );
 extern int                  Cec_ManSimSimulateRoundSavePhase( Cec_ManSim_t * p, Vec_Ptr_t * vInfoCis, Vec_Ptr_t * vInfoCos, unsigned * pSave );
+extern int                  Cec_ManSimSimulateRoundIncr( Cec_ManSim_t * p, Vec_Ptr_t * vInfoCis, Vec_Ptr_t * vInfoCos );
 extern int                  Cec_ManSimRefineMappedFrame( Cec_ManSim_t * p, unsigned * pValues, Vec_Int_t * vLits, int iBase, int nWords );
 /*=== cecIso.c ============================================================*/
 extern int *                Cec_ManDetectIsomorphism( Gia_Man_t * p );
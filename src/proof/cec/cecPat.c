@@ -462,7 +462,10 @@ Vec_Ptr_t * Cec_ManPatCollectPatterns( Cec_ManPat_t *  pMan, int nInputs, int nW
     int nBits = 32 * nWords;
     abctime clk = Abc_Clock();
     vInfo = Vec_PtrAllocSimInfo( nInputs, nWords );
-    Gia_ManRandomInfo( vInfo, 0, 0, nWords );
+    if ( pMan->fZeroFill )
+        Vec_PtrCleanSimInfo( vInfo, 0, nWords );
+    else
+        Gia_ManRandomInfo( vInfo, 0, 0, nWords );
     vPres = Vec_PtrAllocSimInfo( nInputs, nWords );
     Vec_PtrCleanSimInfo( vPres, 0, nWords );
     while ( pMan->iStart < Vec_StrSize(pMan->vStorage) )
@@ -476,7 +479,10 @@ Vec_Ptr_t * Cec_ManPatCollectPatterns( Cec_ManPat_t *  pMan, int nInputs, int nW
         if ( k == nBits-1 )
         {
             Vec_PtrReallocSimInfo( vInfo );
-            Gia_ManRandomInfo( vInfo, 0, nWords, 2*nWords );
+            if ( pMan->fZeroFill )
+                Vec_PtrCleanSimInfo( vInfo, nWords, 2*nWords );
+            else
+                Gia_ManRandomInfo( vInfo, 0, nWords, 2*nWords );
             Vec_PtrReallocSimInfo( vPres );
             Vec_PtrCleanSimInfo( vPres, nWords, 2*nWords );
             nWords *= 2;
@@ -190,6 +190,8 @@ int Cec_ManFraClassesUpdate( Cec_ManFra_t * p, Cec_ManSim_t * pSim, Cec_ManPat_t
     Vec_Ptr_t * vInfo;
     Gia_Obj_t * pObj, * pObjOld, * pReprOld;
     int i, k, iRepr, iNode;
+    // fall back to full simulation if the AIG has its own simulation info
+    int fIncrSim = p->pPars->fIncrSim && !p->pAig->vTimeStamps && !p->pAig->nSimWords && !p->pAig->vSims;
     abctime clk;
 clk = Abc_Clock();
     vInfo = Cec_ManPatCollectPatterns( pPat, Gia_ManCiNum(p->pAig), pSim->nWords );
@@ -198,15 +200,27 @@ clk = Abc_Clock();
     if ( vInfo != NULL )
     {
         Gia_ManCreateValueRefs( p->pAig );
+        if ( fIncrSim )
+        {
+            // the time stamps are not kept because the AIG is replaced after each update
+            p->pAig->iTimeStamp  = 1;
+            p->pAig->vTimeStamps = Vec_IntStart( Gia_ManObjNum(p->pAig) );
+            Gia_ManSetPhase( p->pAig );
+        }
         for ( i = 0; i < pPat->nSeries; i++ )
         {
             Cec_ManFraCreateInfo( pSim, pSim->vCiSimInfo, vInfo, i );
-            if ( Cec_ManSimSimulateRound( pSim, pSim->vCiSimInfo, pSim->vCoSimInfo ) )
+            if ( fIncrSim ? Cec_ManSimSimulateRoundIncr( pSim, pSim->vCiSimInfo, pSim->vCoSimInfo ) :
+                            Cec_ManSimSimulateRound( pSim, pSim->vCiSimInfo, pSim->vCoSimInfo ) )
             {
+                if ( fIncrSim )
+                    Vec_IntFreeP( &p->pAig->vTimeStamps );
                 Vec_PtrFree( vInfo );
                 return 1;
             }
         }
+        if ( fIncrSim )
+            Vec_IntFreeP( &p->pAig->vTimeStamps );
         Vec_PtrFree( vInfo );
     }
 p->timeSim += Abc_Clock() - clk;
@@ -148,6 +148,8 @@ extern void          Dch_ManStop( Dch_Man_t * p );
 extern void          Dch_ManSatSolverRecycle( Dch_Man_t * p );
 /*=== dchSat.c ===================================================*/
 extern int           Dch_NodesAreEquiv( Dch_Man_t * p, Aig_Obj_t * pObj1, Aig_Obj_t * pObj2 );
+/*=== dchPth.c ===================================================*/
+extern void          Dch_ManSweepPar( Aig_Man_t * pAig, Dch_Pars_t * pPars );
 /*=== dchSim.c ===================================================*/
 extern Dch_Cla_t *   Dch_CreateCandEquivClasses( Aig_Man_t * pAig, int nWords, int fVerbose );
 /*=== dchSimSat.c ===================================================*/
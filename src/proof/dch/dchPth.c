@@ -0,0 +1,397 @@
+/**CFile****************************************************************
+
+  FileName    [dchPth.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Choice computation for tech-mapping.]
+
+  Synopsis    [Proving candidate equivalences on several threads.]
+
+  Author      []
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 19, 2026.]
+
+  Revision    [$Id: dchPth.c,v 1.00 2026/10/19 00:00:00 Exp $]
+
+***********************************************************************/
+
+#include "dchInt.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define DCH_SUB_MAX 4   // the max number of sub-representatives tried for a node
+
+// the data of one thread
+typedef struct Dch_Thr_t_ Dch_Thr_t;
+struct Dch_Thr_t_
+{
+    Aig_Man_t *      pAig;           // the shared AIG (read-only)
+    Dch_Pars_t *     pPars;          // choicing parameters
+    Vec_Int_t *      vClasses;       // classes given to this thread (repr, size, members)
+    Vec_Int_t *      vResult;        // pairs (node, proved representative)
+    // SAT solving
+    sat_solver *     pSat;           // recyclable SAT solver
+    int              nSatVars;       // the counter of SAT variables
+    Vec_Int_t *      vSatLits;       // mapping of each node into its SAT literal
+    Vec_Int_t *      vProved;        // mapping of each node into its proved equivalent (literal)
+    Vec_Int_t *      vUsedNodes;     // nodes whose SAT vars are assigned
+    Vec_Int_t *      vSubs;          // sub-representatives of the current class
+    int              nCallsSince;    // the number of calls since the last recycle
+    // statistics
+    int              nNodes;         // the number of class members
+    int              nRecycles;      // the number of times SAT solver was recycled
+    int              nSatCalls;      // the number of SAT calls
+    int              nSatCallsUnsat; // the number of unsat SAT calls
+    int              nSatCallsSat;   // the number of sat SAT calls
+    int              nSatFailsReal;  // the number of timeouts
+    abctime          timeSat;        // solving SAT
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Recycles the SAT solver of the thread.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Dch_ThrSatSolverRecycle( Dch_Thr_t * p )
+{
+    int Lit, i, iObj;
+    if ( p->pSat )
+    {
+        Vec_IntForEachEntry( p->vUsedNodes, iObj, i )
+            Vec_IntWriteEntry( p->vSatLits, iObj, 0 );
+        Vec_IntClear( p->vUsedNodes );
+        sat_solver_delete( p->pSat );
+        p->nRecycles++;
+    }
+    p->pSat = sat_solver_new();
+    sat_solver_setnvars( p->pSat, 1000 );
+    // var 0 is not used
+    // var 1 is reserved for const1 node - add the clause
+    p->nSatVars = 1;
+    Lit = toLit( p->nSatVars );
+    sat_solver_addclause( p->pSat, &Lit, &Lit + 1 );
+    Vec_IntWriteEntry( p->vSatLits, Aig_ObjId(Aig_ManConst1(p->pAig)), Abc_Var2Lit(p->nSatVars++, 0) );
+    Vec_IntPush( p->vUsedNodes, Aig_ObjId(Aig_ManConst1(p->pAig)) );
+    p->nCallsSince = 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the CNF of the cone of the node to the solver.]
+
+  Description [Returns the SAT literal of the node. The nodes proved
+  equivalent by this thread are replaced by their representatives,
+  which makes the cones of the later nodes smaller, similar to fraiging.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Dch_ThrCnfNodeAdd_rec( Dch_Thr_t * p, Aig_Obj_t * pObj )
+{
+    int iLit, iLit0, iLit1, iProved;
+    if ( (iLit = Vec_IntEntry(p->vSatLits, Aig_ObjId(pObj))) )
+        return iLit;
+    if ( (iProved = Vec_IntEntry(p->vProved, Aig_ObjId(pObj))) >= 0 )
+        iLit = Abc_LitNotCond( Dch_ThrCnfNodeAdd_rec(p, Aig_ManObj(p->pAig, Abc_Lit2Var(iProved))), Abc_LitIsCompl(iProved) );
+    else if ( Aig_ObjIsNode(pObj) )
+    {
+        iLit0 = Abc_LitNotCond( Dch_ThrCnfNodeAdd_rec(p, Aig_ObjFanin0(pObj)), Aig_ObjFaninC0(pObj) );
+        iLit1 = Abc_LitNotCond( Dch_ThrCnfNodeAdd_rec(p, Aig_ObjFanin1(pObj)), Aig_ObjFaninC1(pObj) );
+        iLit = Abc_Var2Lit( p->nSatVars++, 0 );
+        sat_solver_setnvars( p->pSat, p->nSatVars );
+        sat_solver_add_and( p->pSat, Abc_Lit2Var(iLit), Abc_Lit2Var(iLit0), Abc_Lit2Var(iLit1), Abc_LitIsCompl(iLit0), Abc_LitIsCompl(iLit1), 0 );
+    }
+    else
+    {
+        iLit = Abc_Var2Lit( p->nSatVars++, 0 );
+        sat_solver_setnvars( p->pSat, p->nSatVars );
+    }
+    Vec_IntWriteEntry( p->vSatLits, Aig_ObjId(pObj), iLit );
+    Vec_IntPush( p->vUsedNodes, Aig_ObjId(pObj) );
+    return iLit;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs equivalence test for the two nodes.]
+
+  Description [Checks whether the node is equal to the representative up
+  to the difference in their phases. The representative can be constant 1.
+  Returns 1 if equivalent, 0 if not, and -1 if undecided.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Dch_ThrNodesAreEquiv( Dch_Thr_t * p, Aig_Obj_t * pRepr, Aig_Obj_t * pObj )
+{
+    int fCompl = pRepr->fPhase ^ pObj->fPhase;
+    int iLitRepr, iLitObj, pLits[2], RetValue, k;
+    abctime clk;
+    assert( pRepr != pObj );
+    p->nCallsSince++;
+    // check if SAT solver needs recycling
+    if ( p->pSat == NULL ||
+        (p->pPars->nSatVarMax &&
+         p->nSatVars > p->pPars->nSatVarMax &&
+         p->nCallsSince > p->pPars->nCallsRecycle) )
+        Dch_ThrSatSolverRecycle( p );
+    // if the nodes do not have SAT variables, allocate them
+    iLitRepr = Dch_ThrCnfNodeAdd_rec( p, pRepr );
+    iLitObj  = Abc_LitNotCond( Dch_ThrCnfNodeAdd_rec(p, pObj), fCompl );
+    if ( iLitRepr == iLitObj )
+        return 1;
+    if ( iLitRepr == Abc_LitNot(iLitObj) )
+        return 0;
+    // check both implications (one is enough for the constant)
+    for ( k = 0; k < 2; k++ )
+    {
+        if ( k == 1 && pRepr == Aig_ManConst1(p->pAig) )
+            break;
+        // solve under assumptions: Repr = !k and Obj ^ fCompl = k
+        pLits[0] = Abc_LitNotCond( iLitRepr, k );
+        pLits[1] = Abc_LitNotCond( iLitObj, !k );
+        p->nSatCalls++;
+clk = Abc_Clock();
+        RetValue = sat_solver_solve( p->pSat, pLits, pLits + 2,
+            (ABC_INT64_T)p->pPars->nBTLimit, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
+p->timeSat += Abc_Clock() - clk;
+        if ( RetValue == l_True )
+        {
+            p->nSatCallsSat++;
+            return 0;
+        }
+        if ( RetValue == l_Undef )
+        {
+            p->nSatFailsReal++;
+            return -1;
+        }
+        p->nSatCallsUnsat++;
+        // record the proved implication
+        pLits[0] = lit_neg( pLits[0] );
+        pLits[1] = lit_neg( pLits[1] );
+        RetValue = sat_solver_addclause( p->pSat, pLits, pLits + 2 );
+        assert( RetValue );
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Proves the classes given to one thread.]
+
+  Description [The members of each class are considered in the topological
+  order. A member is first compared with the class representative. If this
+  equivalence is disproved, it is compared with the members that were
+  disproved earlier (sub-representatives), which approximates the refinement
+  of the class performed by the sequential sweeping.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Dch_ThrProveClasses( void * pArg )
+{
+    Dch_Thr_t * p = (Dch_Thr_t *)pArg;
+    Aig_Obj_t * pRepr, * pObj, * pSub;
+    int i, k, s, nSize, iRepr, iSub, RetValue;
+    for ( i = 0; i < Vec_IntSize(p->vClasses); i += 2 + nSize )
+    {
+        iRepr = Vec_IntEntry( p->vClasses, i );
+        nSize = Vec_IntEntry( p->vClasses, i+1 );
+        pRepr = Aig_ManObj( p->pAig, iRepr );
+        Vec_IntFill( p->vSubs, 1, iRepr );
+        for ( k = 0; k < nSize; k++ )
+        {
+            pObj = Aig_ManObj( p->pAig, Vec_IntEntry(p->vClasses, i+2+k) );
+            p->nNodes++;
+            RetValue = 0;
+            Vec_IntForEachEntryStop( p->vSubs, iSub, s, Abc_MinInt(Vec_IntSize(p->vSubs), DCH_SUB_MAX) )
+            {
+                pSub = Aig_ManObj( p->pAig, iSub );
+                RetValue = Dch_ThrNodesAreEquiv( p, pSub, pObj );
+                if ( RetValue == 1 )
+                {
+                    Vec_IntWriteEntry( p->vProved, Aig_ObjId(pObj), Abc_Var2Lit(iSub, pSub->fPhase ^ pObj->fPhase) );
+                    Vec_IntPushTwo( p->vResult, Aig_ObjId(pObj), iSub );
+                    break;
+                }
+                if ( RetValue == -1 )
+                    break;
+            }
+            // the node differs from all sub-representatives of a non-constant class
+            if ( RetValue == 0 && pRepr != Aig_ManConst1(p->pAig) )
+                Vec_IntPush( p->vSubs, Aig_ObjId(pObj) );
+        }
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Distributes the candidate classes among the threads.]
+
+  Description [Each class is given to the thread with the smallest number
+  of members collected so far. Members of the constant class are distributed
+  individually. The result does not depend on the timing of the threads.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Dch_ManDistributeClasses( Aig_Man_t * pAig, Dch_Thr_t * pThrs, int nThrs )
+{
+    Vec_Int_t * vMembers = Vec_IntStart( Aig_ManObjNumMax(pAig) );
+    Vec_Int_t * vNexts = Vec_IntStart( Aig_ManObjNumMax(pAig) );
+    Vec_Int_t * vLast = Vec_IntStart( Aig_ManObjNumMax(pAig) );
+    Aig_Obj_t * pObj, * pRepr;
+    int i, t, iObj, tBest;
+    // link the members of each class in the topological order
+    Aig_ManForEachObj( pAig, pObj, i )
+    {
+        if ( (pRepr = Aig_ObjRepr(pAig, pObj)) == NULL )
+            continue;
+        if ( Vec_IntEntry(vLast, Aig_ObjId(pRepr)) )
+            Vec_IntWriteEntry( vNexts, Vec_IntEntry(vLast, Aig_ObjId(pRepr)), i );
+        else
+            Vec_IntWriteEntry( vNexts, Aig_ObjId(pRepr), i );
+        Vec_IntWriteEntry( vLast, Aig_ObjId(pRepr), i );
+        Vec_IntAddToEntry( vMembers, Aig_ObjId(pRepr), 1 );
+    }
+    // assign the classes to the threads
+    Aig_ManForEachObj( pAig, pObj, i )
+    {
+        if ( Vec_IntEntry(vMembers, i) == 0 )
+            continue;
+        tBest = 0;
+        for ( t = 1; t < nThrs; t++ )
+            if ( Vec_IntSize(pThrs[t].vClasses) < Vec_IntSize(pThrs[tBest].vClasses) )
+                tBest = t;
+        if ( pObj == Aig_ManConst1(pAig) )
+        {
+            for ( t = tBest, iObj = Vec_IntEntry(vNexts, i); iObj; iObj = Vec_IntEntry(vNexts, iObj), t = (t + 1) % nThrs )
+            {
+                Vec_IntPushTwo( pThrs[t].vClasses, i, 1 );
+                Vec_IntPush( pThrs[t].vClasses, iObj );
+            }
+            continue;
+        }
+        Vec_IntPushTwo( pThrs[tBest].vClasses, i, Vec_IntEntry(vMembers, i) );
+        for ( iObj = Vec_IntEntry(vNexts, i); iObj; iObj = Vec_IntEntry(vNexts, iObj) )
+            Vec_IntPush( pThrs[tBest].vClasses, iObj );
+    }
+    Vec_IntFree( vMembers );
+    Vec_IntFree( vNexts );
+    Vec_IntFree( vLast );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs SAT sweeping of candidate classes on several threads.]
+
+  Description [Derives candidate equivalence classes using simulation,
+  partitions them among the threads, each of which proves its classes
+  using its own SAT solver and cone CNF, and merges the proved
+  equivalences into the representatives of the AIG in the order of
+  threads, so that the result is deterministic.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Dch_ManSweepPar( Aig_Man_t * pAig, Dch_Pars_t * pPars )
+{
+    Dch_Cla_t * pClasses;
+    Dch_Thr_t * pThrs, * p;
+    Vec_Ptr_t * vThrs;
+    int i, k, iObj, iRepr, nLits, nReprs = 0;
+    int nThrs = pPars->nProcs;
+    abctime clk = Abc_Clock();
+    // reset random numbers
+    Aig_ManRandom(1);
+    // compute candidate equivalence classes
+    pClasses = Dch_CreateCandEquivClasses( pAig, pPars->nWords, pPars->fVerbose );
+    nLits = Dch_ClassesLitNum( pClasses );
+    // distribute the classes
+    pThrs = ABC_CALLOC( Dch_Thr_t, nThrs );
+    vThrs = Vec_PtrAlloc( nThrs );
+    for ( i = 0; i < nThrs; i++ )
+    {
+        p = pThrs + i;
+        p->pAig       = pAig;
+        p->pPars      = pPars;
+        p->vClasses   = Vec_IntAlloc( 1000 );
+        p->vResult    = Vec_IntAlloc( 1000 );
+        p->vSatLits   = Vec_IntStart( Aig_ManObjNumMax(pAig) );
+        p->vProved    = Vec_IntStartFull( Aig_ManObjNumMax(pAig) );
+        p->vUsedNodes = Vec_IntAlloc( 1000 );
+        p->vSubs      = Vec_IntAlloc( 100 );
+        Vec_PtrPush( vThrs, p );
+    }
+    Dch_ManDistributeClasses( pAig, pThrs, nThrs );
+    Dch_ClassesStop( pClasses );
+    if ( pPars->fVerbose )
+        Abc_PrintTime( 1, "Candidate classes", Abc_Clock() - clk );
+    // prove the classes
+    Util_ProcessThreads( Dch_ThrProveClasses, vThrs, nThrs + 1, 0, 0 );
+    // merge the proved equivalences
+    ABC_FREE( pAig->pReprs );
+    Aig_ManReprStart( pAig, Aig_ManObjNumMax(pAig) );
+    for ( i = 0; i < nThrs; i++ )
+    {
+        p = pThrs + i;
+        Vec_IntForEachEntryDouble( p->vResult, iObj, iRepr, k )
+            Aig_ObjSetRepr( pAig, Aig_ManObj(pAig, iObj), Aig_ManObj(pAig, iRepr) );
+        nReprs += Vec_IntSize(p->vResult) / 2;
+        if ( pPars->fVerbose )
+            Abc_Print( 1, "Thread %2d : Members = %6d. Calls = %6d. Unsat = %6d. Sat = %6d. Fail = %6d. Recycles = %3d.  SAT time = %7.2f sec\n",
+                i, p->nNodes, p->nSatCalls, p->nSatCallsUnsat, p->nSatCallsSat, p->nSatFailsReal, p->nRecycles, 1.0*((double)(p->timeSat))/((double)CLOCKS_PER_SEC) );
+        if ( p->pSat )
+            sat_solver_delete( p->pSat );
+        Vec_IntFree( p->vClasses );
+        Vec_IntFree( p->vResult );
+        Vec_IntFree( p->vSatLits );
+        Vec_IntFree( p->vProved );
+        Vec_IntFree( p->vUsedNodes );
+        Vec_IntFree( p->vSubs );
+    }
+    ABC_FREE( pThrs );
+    Vec_PtrFree( vThrs );
+    if ( pPars->fVerbose )
+    {
+        Abc_Print( 1, "Choices   : Lits = %6d. Reprs = %5d. Threads = %d.\n", nLits, nReprs, pPars->nProcs );
+        Abc_PrintTime( 1, "Parallel choice computation time", Abc_Clock() - clk );
+    }
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -103,6 +103,8 @@ int Inter_ManPerformInterpolation( Aig_Man_t * pAig, Inter_ManParams_t * pPars,
         printf( "Property trivially fails in the initial state.\n" );
         return 0;
     }
+    if ( pPars->nProcs > 1 )
+        return Inter_ManPerformInterpolationPar( pAig, pPars, piFrame );
 /*
     if ( Inter_ManCheckAllStates(pAig) )
     {
@@ -196,6 +198,15 @@ p->timeEqu += Abc_Clock() - clk;
         // iterate the interpolation procedure
         for ( i = 0; ; i++ )
         {
+            if ( pPars->pFuncStop && pPars->pFuncStop(pPars->RunId) )
+            {
+                if ( pPars->fVerbose )
+                    printf( "Interpolation was stopped by the callback.\n" );
+                p->timeTotal = Abc_Clock() - clkTotal;
+                Inter_ManStop( p, 0 );
+                Inter_CheckStop( pCheck );
+                return -1;
+            }
             if ( pPars->nFramesMax && p->nFrames + i >= pPars->nFramesMax )
             { 
                 if ( pPars->fVerbose )
@@ -216,6 +227,9 @@ p->timeEqu += Abc_Clock() - clk;
             }
             else 
 #endif
+            if ( pPars->fUseProof )
+                RetValue = Inter_ManPerformOneStepPrf( p, pPars->fUseBackward, nTimeNewOut );
+            else
                 RetValue = Inter_ManPerformOneStep( p, pPars->fUseBias, pPars->fUseBackward, nTimeNewOut );
 
             if ( pPars->fVerbose )
@@ -264,6 +278,11 @@ p->timeEqu += Abc_Clock() - clk;
                     if ( pPars->fVerbose )
                         printf( "Reached timeout (%d seconds).\n",  pPars->nSecLimit );
                 }
+                else if ( pPars->pFuncStop && pPars->pFuncStop(pPars->RunId) ) // stopped
+                {
+                    if ( pPars->fVerbose )
+                        printf( "Interpolation was stopped by the callback.\n" );
+                }
                 else
                 {
                     assert( p->nConfCur >= p->nConfLimit );
@@ -70,6 +70,9 @@ struct Inter_Man_t_
     int              nConfLimit;   // the limit on the number of conflicts
     int              fVerbose;     // the verbosiness flag
     char *           pFileName;
+    int              RunId;        // the ID of this run
+    int(*pFuncStop)(int);          // the callback to terminate
+    double           dMemProof;    // the peak memory of the resolution proof
     // runtime
     abctime          timeRwr;
     abctime          timeCnf;
@@ -125,6 +128,12 @@ extern int             Inter_ManPerformOneStep( Inter_Man_t * p, int fUseBias, i
 extern int             Inter_ManPerformOneStepM114p( Inter_Man_t * p, int fUsePudlak, int fUseOther );
 #endif
 
+/*=== intPrf.c ============================================================*/
+extern int             Inter_ManPerformOneStepPrf( Inter_Man_t * p, int fUseBackward, abctime nTimeNewOut );
+
+/*=== intPth.c ============================================================*/
+extern int             Inter_ManPerformInterpolationPar( Aig_Man_t * pAig, Inter_ManParams_t * pPars, int * piFrame );
+
 /*=== intUtil.c ============================================================*/
 extern int             Inter_ManCheckInitialState( Aig_Man_t * p );
 extern int             Inter_ManCheckAllStates( Aig_Man_t * p );
@@ -53,6 +53,8 @@ Inter_Man_t * Inter_ManCreate( Aig_Man_t * pAig, Inter_ManParams_t * pPars )
     p->nConfLimit = pPars->nBTLimit;
     p->fVerbose = pPars->fVerbose;
     p->pFileName = pPars->pFileName;
+    p->RunId = pPars->RunId;
+    p->pFuncStop = pPars->pFuncStop;
     p->pAig = pAig;
     if ( pPars->fDropInvar )
         p->vInters = Vec_PtrAlloc( 100 );
@@ -138,6 +140,8 @@ void Inter_ManStop( Inter_Man_t * p, int fProved )
         ABC_PRTP( "Containment", p->timeEqu,   p->timeTotal );
         ABC_PRTP( "Other      ", p->timeOther, p->timeTotal );
         ABC_PRTP( "TOTAL      ", p->timeTotal, p->timeTotal );
+        if ( p->dMemProof )
+            printf( "Peak memory of the resolution proof = %.2f MB.\n", p->dMemProof / (1<<20) );
     }
 
     if ( p->vInters )
@@ -0,0 +1,307 @@
+/**CFile****************************************************************
+
+  FileName    [intPrf.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Interpolation engine.]
+
+  Synopsis    [Interpolation using the trimmed resolution proof.]
+
+  Author      []
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 19, 2026.]
+
+  Revision    [$Id: intPrf.c,v 1.00 2026/10/19 00:00:00 Exp $]
+
+***********************************************************************/
+
+#include "intInt.h"
+#include "sat/bsat/satSolver2.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the partial interpolants of the root clauses
+typedef struct Inter_Prf_t_ Inter_Prf_t;
+struct Inter_Prf_t_
+{
+    sat_solver2 *    pSat;         // the proof-logging SAT solver
+    Aig_Man_t *      pInter;       // the interpolant manager (CIs = global variables)
+    Vec_Int_t *      vVarMap;      // maps global variables into CI numbers
+    Vec_Int_t *      vClaLits;     // maps root clause IDs into AIG literals
+    int              fMarkA;       // the clauses added are the clauses of A
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Adds one clause while recording its partial interpolant.]
+
+  Description [Returns 0 if the clause is false under the top-level
+  assignments. For the clauses of A, the partial interpolant is the OR
+  of their global literals. For the clauses of B, it is constant 1.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Inter_ManPrfAddClause( Inter_Prf_t * p, int * pBeg, int * pEnd )
+{
+    Aig_Obj_t * pObj;
+    int * pLit, iCi;
+    // the proof-logging solver cannot take a clause that is already false
+    for ( pLit = pBeg; pLit < pEnd; pLit++ )
+        if ( p->pSat->assigns[lit_var(*pLit)] != !lit_sign(*pLit) )
+            break;
+    if ( pLit == pEnd )
+        return 0;
+    // derive the partial interpolant
+    if ( p->fMarkA )
+    {
+        pObj = Aig_ManConst0( p->pInter );
+        for ( pLit = pBeg; pLit < pEnd; pLit++ )
+            if ( (iCi = Vec_IntEntry(p->vVarMap, lit_var(*pLit))) >= 0 )
+                pObj = Aig_Or( p->pInter, pObj, Aig_NotCond(Aig_ManCi(p->pInter, iCi), lit_sign(*pLit)) );
+    }
+    else
+        pObj = Aig_ManConst1( p->pInter );
+    // the clause ID is its entry in the map
+    sat_solver2_addclause( p->pSat, pBeg, pEnd, Vec_IntSize(p->vClaLits) );
+    Vec_IntPush( p->vClaLits, Aig_ObjToLit(pObj) );
+    return 1;
+}
+static int Inter_ManPrfAddPair( Inter_Prf_t * p, int iVar0, int iVar1 )
+{
+    int Lits[2];
+    Lits[0] = toLitCond( iVar0, 0 );
+    Lits[1] = toLitCond( iVar1, 1 );
+    if ( !Inter_ManPrfAddClause( p, Lits, Lits+2 ) )
+        return 0;
+    Lits[0] = toLitCond( iVar0, 1 );
+    Lits[1] = toLitCond( iVar1, 0 );
+    return Inter_ManPrfAddClause( p, Lits, Lits+2 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Loads the clauses of A and B into the proof-logging solver.]
+
+  Description [Follows Inter_ManDeriveSatSolver(). Returns 0 if one of
+  the clauses is false under the top-level assignments.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Inter_ManDeriveSatSolverPrf( Inter_Prf_t * p,
+    Aig_Man_t * pInter, Cnf_Dat_t * pCnfInter,
+    Aig_Man_t * pAig, Cnf_Dat_t * pCnfAig,
+    Aig_Man_t * pFrames, Cnf_Dat_t * pCnfFrames,
+    Vec_Int_t * vVarsAB, int fUseBackward )
+{
+    Aig_Obj_t * pObj, * pObj2;
+    int i, Var, nVars = pCnfInter->nVars + pCnfAig->nVars + pCnfFrames->nVars;
+    // global variables are the state variables of the timeframes
+    Vec_IntClear( vVarsAB );
+    if ( fUseBackward )
+    {
+        Aig_ManForEachCo( pFrames, pObj, i )
+        {
+            assert( pCnfFrames->pVarNums[pObj->Id] >= 0 );
+            Vec_IntPush( vVarsAB, pCnfFrames->pVarNums[pObj->Id] );
+        }
+    }
+    else
+    {
+        Aig_ManForEachCi( pFrames, pObj, i )
+        {
+            if ( i == Aig_ManRegNum(pAig) )
+                break;
+            Vec_IntPush( vVarsAB, pCnfFrames->pVarNums[pObj->Id] );
+        }
+    }
+    Vec_IntFill( p->vVarMap, nVars, -1 );
+    Vec_IntForEachEntry( vVarsAB, Var, i )
+    {
+        Vec_IntWriteEntry( p->vVarMap, Var, i );
+        Aig_IthVar( p->pInter, i );
+    }
+    // the variables of A follow those of the timeframes
+    sat_solver2_setnvars( p->pSat, nVars );
+    for ( Var = pCnfFrames->nVars; Var < nVars; Var++ )
+        var_set_partA( p->pSat, Var, 1 );
+
+    // add clauses of A
+    p->fMarkA = 1;
+    // interpolant
+    for ( i = 0; i < pCnfInter->nClauses; i++ )
+        if ( !Inter_ManPrfAddClause( p, pCnfInter->pClauses[i], pCnfInter->pClauses[i+1] ) )
+            return 0;
+    // connector clauses
+    if ( fUseBackward )
+    {
+        Saig_ManForEachLi( pAig, pObj2, i )
+        {
+            if ( Saig_ManRegNum(pAig) == Aig_ManCiNum(pInter) )
+                pObj = Aig_ManCi( pInter, i );
+            else
+            {
+                assert( Aig_ManCiNum(pAig) == Aig_ManCiNum(pInter) );
+                pObj = Aig_ManCi( pInter, Aig_ManCiNum(pAig)-Saig_ManRegNum(pAig) + i );
+            }
+            if ( !Inter_ManPrfAddPair( p, pCnfInter->pVarNums[pObj->Id], pCnfAig->pVarNums[pObj2->Id] ) )
+                return 0;
+        }
+    }
+    else
+    {
+        Aig_ManForEachCi( pInter, pObj, i )
+        {
+            pObj2 = Saig_ManLo( pAig, i );
+            if ( !Inter_ManPrfAddPair( p, pCnfInter->pVarNums[pObj->Id], pCnfAig->pVarNums[pObj2->Id] ) )
+                return 0;
+        }
+    }
+    // one timeframe
+    for ( i = 0; i < pCnfAig->nClauses; i++ )
+        if ( !Inter_ManPrfAddClause( p, pCnfAig->pClauses[i], pCnfAig->pClauses[i+1] ) )
+            return 0;
+    // connector clauses
+    if ( fUseBackward )
+    {
+        Aig_ManForEachCo( pFrames, pObj, i )
+        {
+            pObj2 = Saig_ManLo( pAig, i );
+            if ( !Inter_ManPrfAddPair( p, pCnfFrames->pVarNums[pObj->Id], pCnfAig->pVarNums[pObj2->Id] ) )
+                return 0;
+        }
+    }
+    else
+    {
+        Aig_ManForEachCi( pFrames, pObj, i )
+        {
+            if ( i == Aig_ManRegNum(pAig) )
+                break;
+            pObj2 = Saig_ManLi( pAig, i );
+            if ( !Inter_ManPrfAddPair( p, pCnfFrames->pVarNums[pObj->Id], pCnfAig->pVarNums[pObj2->Id] ) )
+                return 0;
+        }
+    }
+    // add clauses of B
+    p->fMarkA = 0;
+    for ( i = 0; i < pCnfFrames->nClauses; i++ )
+        if ( !Inter_ManPrfAddClause( p, pCnfFrames->pClauses[i], pCnfFrames->pClauses[i+1] ) )
+            return 0;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs one SAT run with interpolation.]
+
+  Description [Uses the proof-logging SAT solver, which trims the
+  resolution proof to the part reachable from the live learned clauses
+  each time the learned clauses are reduced. The memory used by the
+  proof is proportional to the current clause database rather than
+  to the number of conflicts, which is the case when the complete
+  trace is stored and replayed by Inta_ManInterpolate(). The interpolant
+  is computed directly from the proof of the empty clause.
+  Returns 1 if proven. 0 if failed. -1 if undecided.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Inter_ManPerformOneStepPrf( Inter_Man_t * p, int fUseBackward, abctime nTimeNewOut )
+{
+    Inter_Prf_t Prf, * pPrf = &Prf;
+    int status, RetValue, Lit;
+    abctime clk;
+
+    // derive the SAT solver
+    memset( pPrf, 0, sizeof(Inter_Prf_t) );
+    pPrf->pSat     = sat_solver2_new();
+    pPrf->pSat->pPrf1 = Vec_SetAlloc( 20 );
+    pPrf->pInter   = Aig_ManStart( 10000 );
+    pPrf->vVarMap  = Vec_IntAlloc( 0 );
+    pPrf->vClaLits = Vec_IntAlloc( 1000 );
+    Vec_IntPush( pPrf->vClaLits, -1 ); // clause IDs start from 1
+    Cnf_DataLift( p->pCnfAig,   p->pCnfFrames->nVars );
+    Cnf_DataLift( p->pCnfInter, p->pCnfFrames->nVars + p->pCnfAig->nVars );
+    RetValue = Inter_ManDeriveSatSolverPrf( pPrf, p->pInter, p->pCnfInter, p->pAigTrans, p->pCnfAig, p->pFrames, p->pCnfFrames, p->vVarsAB, fUseBackward );
+    Cnf_DataLift( p->pCnfAig,   -p->pCnfFrames->nVars );
+    Cnf_DataLift( p->pCnfInter, -p->pCnfFrames->nVars -p->pCnfAig->nVars );
+    if ( RetValue == 0 )
+    {
+        // the clauses are trivially UNSAT; derive the interpolant using the complete trace
+        sat_solver2_delete( pPrf->pSat );
+        Aig_ManStop( pPrf->pInter );
+        Vec_IntFree( pPrf->vVarMap );
+        Vec_IntFree( pPrf->vClaLits );
+        return Inter_ManPerformOneStep( p, 0, fUseBackward, nTimeNewOut );
+    }
+
+    // set runtime limit
+    if ( nTimeNewOut )
+        sat_solver2_set_runtime_limit( pPrf->pSat, nTimeNewOut );
+
+    // solve the problem
+clk = Abc_Clock();
+    status = sat_solver2_solve( pPrf->pSat, NULL, NULL, (ABC_INT64_T)p->nConfLimit, (ABC_INT64_T)0, (ABC_INT64_T)0, (ABC_INT64_T)0 );
+    p->nConfCur = pPrf->pSat->stats.conflicts;
+p->timeSat += Abc_Clock() - clk;
+    p->dMemProof = Abc_MaxDouble( p->dMemProof, sat_solver2_memory_proof_peak(pPrf->pSat) );
+
+    if ( status == l_False )
+        RetValue = 1;
+    else if ( status == l_True )
+        RetValue = 0;
+    else
+        RetValue = -1;
+
+    // create the resulting manager
+    if ( RetValue == 1 )
+    {
+clk = Abc_Clock();
+        Lit = Sat_ProofInterpolantLit( pPrf->pSat, pPrf->pInter, pPrf->vClaLits );
+        if ( Lit >= 0 )
+        {
+            Aig_ObjCreateCo( pPrf->pInter, Aig_ObjFromLit(pPrf->pInter, Lit) );
+            Aig_ManCleanup( pPrf->pInter );
+            p->pInterNew = pPrf->pInter;
+            pPrf->pInter = NULL;
+        }
+        else
+        {
+            printf( "Inter_ManPerformOneStepPrf(): The proof of the empty clause is not available.\n" );
+            RetValue = -1;
+        }
+p->timeInt += Abc_Clock() - clk;
+    }
+    sat_solver2_delete( pPrf->pSat );
+    if ( pPrf->pInter )
+        Aig_ManStop( pPrf->pInter );
+    Vec_IntFree( pPrf->vVarMap );
+    Vec_IntFree( pPrf->vClaLits );
+    return RetValue;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -0,0 +1,283 @@
+/**CFile****************************************************************
+
+  FileName    [intPth.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Interpolation engine.]
+
+  Synopsis    [Running several interpolation variants concurrently.]
+
+  Author      []
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 19, 2026.]
+
+  Revision    [$Id: intPth.c,v 1.00 2026/10/19 00:00:00 Exp $]
+
+***********************************************************************/
+
+#include "intInt.h"
+#include "opt/dar/dar.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#if defined(_WIN32) && !defined(__MINGW32__)
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// the state shared by concurrent interpolation workers
+typedef struct Inter_Share_t_ Inter_Share_t;
+struct Inter_Share_t_
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t  Mutex;          // protects the shared state
+#endif
+    volatile int     fStop;          // set when one of the workers is done
+    int              iWinner;        // the first worker who is done
+    abctime          nTimeToStop;    // the runtime limit of the portfolio
+    int           (* pFuncStop)(int); // the callback of the caller
+    int              RunId;          // the run ID of the caller
+};
+
+// one interpolation worker
+typedef struct Inter_Worker_t_ Inter_Worker_t;
+struct Inter_Worker_t_
+{
+    Aig_Man_t *        pAig;         // the copy of the AIG
+    Inter_ManParams_t  Pars;         // the parameters of this worker
+    Inter_Share_t *    pShare;       // the shared state
+    int                iFrame;       // the frame of the counter-example
+    int                RetValue;     // the result of this worker
+    abctime            Time;         // the runtime of this worker
+};
+
+// the shared state of the worker running in this thread (set from the worker data)
+#ifdef _MSC_VER
+static __declspec(thread) Inter_Share_t * s_pInterShare = NULL;
+#else
+static __thread Inter_Share_t * s_pInterShare = NULL;
+#endif
+
+// call back procedure for the workers
+static int Inter_ShareStop( int RunId )
+{
+    Inter_Share_t * p = s_pInterShare;
+    return p->fStop || (p->nTimeToStop && Abc_Clock() > p->nTimeToStop) || (p->pFuncStop && p->pFuncStop(p->RunId));
+}
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Derives parameters of one interpolation variant.]
+
+  Description [Variant 0 uses the parameters given by the user. Other
+  variants combine three modes (the user's mode, toggled backward
+  interpolation, and one more step of inductive containment checking)
+  with toggling rewriting of the timeframes, using the property in two
+  last timeframes, and biasing decisions to global variables, starting
+  from the combinations with fewer changes. Biasing is not toggled when
+  the proof-logging solver is used because it ignores biasing. When all
+  combinations are used, the next variants keep adding steps of
+  inductive containment checking. All variants are different.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Inter_ManDeriveVariant( Inter_ManParams_t * p, int iVariant )
+{
+    // the toggles are 1 = rewriting, 2 = two frames, 4 = biasing
+    int nToggles = p->fUseProof ? 4 : 8; // the first four do not toggle biasing
+    int i, k, Mode = -1, Toggle = 0, nCount = 0, nExtra = 0;
+    // enumerate the combinations of modes and toggles by the number of changes
+    for ( k = 0; k <= 4 && Mode == -1; k++ )
+    for ( i = 0; i < 3 * nToggles; i++ )
+    {
+        int iMode = i / nToggles, iToggle = i % nToggles;
+        if ( (iMode > 0) + (iToggle & 1) + ((iToggle >> 1) & 1) + ((iToggle >> 2) & 1) != k )
+            continue;
+        if ( nCount++ == iVariant )
+        {
+            Mode = iMode, Toggle = iToggle;
+            break;
+        }
+    }
+    if ( Mode == -1 ) // all combinations are used
+    {
+        iVariant -= 3 * nToggles;
+        Mode     = 2;
+        nExtra   = 1 + iVariant / nToggles;
+        Toggle   = iVariant % nToggles;
+    }
+    if ( Mode == 1 )
+    {
+        p->fUseBackward ^= 1;
+        if ( p->fUseBackward ) // backward interpolation works with the transition into the initial state
+            p->fTransLoop = 1, p->nFramesK = 1;
+    }
+    else if ( Mode == 2 )
+    {
+        p->fUseBackward = 0;
+        p->nFramesK += 1 + nExtra;
+        p->fTransLoop = 1;
+    }
+    if ( Toggle & 1 )
+        p->fRewrite ^= 1;
+    if ( Toggle & 2 )
+        p->fUseTwoFrames ^= 1;
+    if ( Toggle & 4 )
+        p->fUseBias ^= 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs one interpolation worker.]
+
+  Description [The first worker to finish with a proof or a counter-example
+  stops the other ones.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Inter_ManWorkerThread( void * pArg )
+{
+    Inter_Worker_t * pWorker = (Inter_Worker_t *)pArg;
+    Inter_Share_t * p = pWorker->pShare;
+    abctime clk = Abc_Clock();
+    s_pInterShare = p;
+    pWorker->RetValue = Inter_ManPerformInterpolation( pWorker->pAig, &pWorker->Pars, &pWorker->iFrame );
+    pWorker->Time = Abc_Clock() - clk;
+    if ( pWorker->RetValue != -1 )
+    {
+#ifdef ABC_USE_PTHREADS
+        int status = pthread_mutex_lock( &p->Mutex );  assert( status == 0 );
+#endif
+        if ( !p->fStop )
+            p->iWinner = pWorker->Pars.RunId;
+        p->fStop = 1;
+#ifdef ABC_USE_PTHREADS
+        status = pthread_mutex_unlock( &p->Mutex );  assert( status == 0 );
+#endif
+    }
+    s_pInterShare = NULL;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs several interpolation variants concurrently.]
+
+  Description [Each worker runs interpolation on its own copy of the AIG
+  using a different variant of the interpolation procedure. The first
+  worker to prove the property or to find a counter-example stops the
+  other ones. Returns 1 if proven. 0 if failed. -1 if undecided.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Inter_ManPerformInterpolationPar( Aig_Man_t * pAig, Inter_ManParams_t * pPars, int * piFrame )
+{
+    Inter_Share_t * p;
+    Inter_Worker_t * pWorkers, * pWorker, * pBest = NULL;
+    Vec_Ptr_t * vWorkers = Vec_PtrAlloc( pPars->nProcs );
+    Dar_RwrPar_t ParsRwr;
+    int i, RetValue;
+    assert( pPars->nProcs > 1 );
+    p = ABC_CALLOC( Inter_Share_t, 1 );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_init( &p->Mutex, NULL );
+#endif
+    p->iWinner     = -1;
+    p->nTimeToStop = pPars->nSecLimit ? pPars->nSecLimit * CLOCKS_PER_SEC + Abc_Clock() : 0;
+    p->pFuncStop   = pPars->pFuncStop;
+    p->RunId       = pPars->RunId;
+    // prepare the workers
+    pWorkers = ABC_CALLOC( Inter_Worker_t, pPars->nProcs );
+    for ( i = 0; i < pPars->nProcs; i++ )
+    {
+        pWorker = pWorkers + i;
+        pWorker->pAig   = Aig_ManDupSimple( pAig );
+        pWorker->pShare = p;
+        pWorker->iFrame = -1;
+        pWorker->Pars   = *pPars;
+        Inter_ManDeriveVariant( &pWorker->Pars, i );
+        pWorker->Pars.nProcs     = 0;
+        pWorker->Pars.nSecLimit  = 0;
+        pWorker->Pars.fDropInvar = pPars->fDropInvar && i == 0;
+        pWorker->Pars.fVerbose   = 0;
+        pWorker->Pars.RunId      = i;
+        pWorker->Pars.pFuncStop  = Inter_ShareStop;
+        Vec_PtrPush( vWorkers, pWorker );
+    }
+    // the rewriting library is shared by the workers and should be prepared in advance
+    Dar_ManDefaultRwrParams( &ParsRwr );
+    Dar_LibPrepare( ParsRwr.nSubgMax );
+    if ( pPars->fVerbose )
+        printf( "Running %d interpolation variants concurrently.\n", pPars->nProcs );
+    Util_ProcessThreads( Inter_ManWorkerThread, vWorkers, pPars->nProcs + 1, 0, 0 );
+    // select the result
+    pBest = p->iWinner >= 0 ? pWorkers + p->iWinner : pWorkers;
+    for ( i = 0; i < pPars->nProcs; i++ )
+    {
+        pWorker = pWorkers + i;
+        if ( pBest->RetValue == -1 && pWorker->Pars.iFrameMax > pBest->Pars.iFrameMax )
+            pBest = pWorker;
+        if ( !pPars->fVerbose )
+            continue;
+        printf( "Worker %2d : Back = %s  K = %d  Trans = %s  Bias = %s  Rwr = %s  Two = %s  Frames = %4d  %-7s  ", i,
+            pWorker->Pars.fUseBackward ? "yes" : " no", pWorker->Pars.nFramesK, pWorker->Pars.fTransLoop ? "yes" : " no",
+            pWorker->Pars.fUseBias ? "yes" : " no", pWorker->Pars.fRewrite ? "yes" : " no", pWorker->Pars.fUseTwoFrames ? "yes" : " no",
+            pWorker->Pars.iFrameMax + 1, pWorker->RetValue == 1 ? "proved" : pWorker->RetValue == 0 ? "failed" : "undec" );
+        ABC_PRT( "Time", pWorker->Time );
+    }
+    // transfer the result
+    if ( pBest->RetValue == 0 )
+    {
+        Abc_CexFreeP( &pAig->pSeqModel );
+        ABC_SWAP( Abc_Cex_t *, pAig->pSeqModel, pBest->pAig->pSeqModel );
+    }
+    else if ( pBest->RetValue == -1 && p->nTimeToStop && Abc_Clock() > p->nTimeToStop )
+        printf( "Reached timeout (%d seconds).\n",  pPars->nSecLimit );
+    *piFrame = pBest->iFrame;
+    pPars->iFrameMax = pBest->Pars.iFrameMax;
+    RetValue = pBest->RetValue;
+    // clean up
+    for ( i = 0; i < pPars->nProcs; i++ )
+        Aig_ManStop( pWorkers[i].pAig );
+    ABC_FREE( pWorkers );
+    Vec_PtrFree( vWorkers );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_destroy( &p->Mutex );
+#endif
+    ABC_FREE( p );
+    return RetValue;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
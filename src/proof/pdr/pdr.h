@@ -73,6 +73,7 @@ struct Pdr_Par_t_
     int fSolveAll;        // do not stop when found a SAT output
     int fStoreCex;        // enable storing counter-examples in MO mode
     int fUseBridge;       // use bridge interface
+    Abc_CexStore_t * pCexStore; // adds CEXes of failed outputs in MO mode without keeping them
     int fUsePropOut;      // use property output
     int nFailOuts;        // the number of failed outputs
     int nDropOuts;        // the number of timed out outputs
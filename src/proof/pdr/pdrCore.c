@@ -1456,7 +1456,7 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
                     p->pAig->pSeqModel = pCexNew;
                     return 0; // SAT
                 }
-                pCexNew = (p->pPars->fUseBridge || p->pPars->fStoreCex) ? Abc_CexMakeTriv( Aig_ManRegNum(p->pAig), Saig_ManPiNum(p->pAig), Saig_ManPoNum(p->pAig), iFrame*Saig_ManPoNum(p->pAig)+p->iOutCur ) : (Abc_Cex_t *)(ABC_PTRINT_T)1;
+                pCexNew = (p->pPars->fUseBridge || p->pPars->fStoreCex || p->pPars->pCexStore) ? Abc_CexMakeTriv( Aig_ManRegNum(p->pAig), Saig_ManPiNum(p->pAig), Saig_ManPoNum(p->pAig), iFrame*Saig_ManPoNum(p->pAig)+p->iOutCur ) : (Abc_Cex_t *)(ABC_PTRINT_T)1;
                 p->pPars->nFailOuts++;
                 if ( p->pPars->vOutMap ) Vec_IntWriteEntry( p->pPars->vOutMap, p->iOutCur, 0 );
                 if ( !p->pPars->fNotVerbose )
@@ -1465,6 +1465,12 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
                 assert( Vec_PtrEntry(p->vCexes, p->iOutCur) == NULL );
                 if ( p->pPars->fUseBridge )
                     Gia_ManToBridgeResult( stdout, 0, pCexNew, pCexNew->iPo );
+                if ( p->pPars->pCexStore )
+                {
+                    Abc_CexStoreAdd( p->pPars->pCexStore, pCexNew, NULL );
+                    Abc_CexFree( pCexNew );
+                    pCexNew = (Abc_Cex_t *)(ABC_PTRINT_T)1;
+                }
                 Vec_PtrWriteEntry( p->vCexes, p->iOutCur, pCexNew );
                 if ( p->pPars->pFuncOnFail && p->pPars->pFuncOnFail(p->iOutCur, p->pPars->fStoreCex ? (Abc_Cex_t *)Vec_PtrEntry(p->vCexes, p->iOutCur) : NULL) )
                 {
@@ -1573,11 +1579,17 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
                             return 0; // SAT
                         }
                         p->pPars->nFailOuts++;
-                        pCexNew = (p->pPars->fUseBridge || p->pPars->fStoreCex) ? Pdr_ManDeriveCex(p) : (Abc_Cex_t *)(ABC_PTRINT_T)1;
+                        pCexNew = (p->pPars->fUseBridge || p->pPars->fStoreCex || p->pPars->pCexStore) ? Pdr_ManDeriveCex(p) : (Abc_Cex_t *)(ABC_PTRINT_T)1;
                         if ( p->pPars->vOutMap ) Vec_IntWriteEntry( p->pPars->vOutMap, p->iOutCur, 0 );
                         assert( Vec_PtrEntry(p->vCexes, p->iOutCur) == NULL );
                         if ( p->pPars->fUseBridge )
                             Gia_ManToBridgeResult( stdout, 0, pCexNew, pCexNew->iPo );
+                        if ( p->pPars->pCexStore )
+                        {
+                            Abc_CexStoreAdd( p->pPars->pCexStore, pCexNew, NULL );
+                            Abc_CexFree( pCexNew );
+                            pCexNew = (Abc_Cex_t *)(ABC_PTRINT_T)1;
+                        }
                         Vec_PtrWriteEntry( p->vCexes, p->iOutCur, pCexNew );
                         if ( p->pPars->pFuncOnFail && p->pPars->pFuncOnFail(p->iOutCur, p->pPars->fStoreCex ? (Abc_Cex_t *)Vec_PtrEntry(p->vCexes, p->iOutCur) : NULL) )
                         {
@@ -1796,6 +1808,9 @@ int Pdr_ManSolve( Aig_Man_t * pAig, Pdr_Par_t * pPars )
         assert( p->pAig->vSeqModelVec == NULL );
         p->pAig->vSeqModelVec = p->vCexes;
         p->vCexes = NULL;
+        // the counter-examples are verified together in one simulation pass
+        if ( Gia_ManVerifyCexesAig( p->pAig, p->pAig->vSeqModelVec, NULL ) )
+            Abc_Print( 1, "Pdr_ManSolve(): Counter-example verification has FAILED.\n" );
     }
     if ( p->pPars->fDumpInv )
     {
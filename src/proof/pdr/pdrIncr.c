@@ -840,6 +840,9 @@ int IPdr_ManSolve( Aig_Man_t * pAig, Pdr_Par_t * pPars )
             assert( p->pAig->vSeqModelVec == NULL );
             p->pAig->vSeqModelVec = p->vCexes;
             p->vCexes = NULL;
+            // the counter-examples are verified together in one simulation pass
+            if ( Gia_ManVerifyCexesAig( p->pAig, p->pAig->vSeqModelVec, NULL ) )
+                Abc_Print( 1, "IPdr_ManSolve(): Counter-example verification has FAILED.\n" );
         }
         if ( p->pPars->fDumpInv )
         {
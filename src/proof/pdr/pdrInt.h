@@ -126,6 +126,8 @@ struct Pdr_Man_t_
     int         nCexesTotal;
     // terminary simulation
     Txs3_Man_t * pTxs3;      
+    Gia_Man_t *  pGiaX;      // AIG for bit-parallel ternary simulation
+    Gia_XsimMan_t * pXsim;   // bit-parallel ternary simulation
     // internal use
     Vec_Int_t * vPrio;     // priority flops
     Vec_Int_t * vLits;     // array of literals
@@ -282,6 +282,11 @@ Pdr_Man_t * Pdr_ManStart( Aig_Man_t * pAig, Pdr_Par_t * pPars, Vec_Int_t * vPrio
     p->pCnfMan  = Cnf_ManStart();
     // ternary simulation
     p->pTxs3    = pPars->fNewXSim ? Txs3_ManStart( p, pAig, p->vPrio ) : NULL;
+    if ( !pPars->fNewXSim && Aig_ManObjNum(pAig) == Aig_ManObjNumMax(pAig) ) // the object IDs are the same in Gia
+    {
+        p->pGiaX = Gia_ManFromAigSimple( pAig );
+        p->pXsim = Gia_XsimManStart( p->pGiaX, 4 );
+    }
     // additional AIG data-members
     if ( pAig->pFanData == NULL )
         Aig_ManFanoutStart( pAig );
@@ -370,6 +375,10 @@ void Pdr_ManStop( Pdr_Man_t * p )
     // terminary simulation
     if ( p->pPars->fNewXSim )
         Txs3_ManStop( p->pTxs3 );
+    if ( p->pXsim )
+        Gia_XsimManStop( p->pXsim );
+    if ( p->pGiaX )
+        Gia_ManStop( p->pGiaX );
     // internal use
     Vec_IntFreeP( &p->vPrio   );  // priority flops
     Vec_IntFree( p->vLits     );  // array of literals
@@ -429,7 +438,8 @@ Abc_Cex_t * Pdr_ManDeriveCex( Pdr_Man_t * p )
             Abc_InfoSetBit( pCex->pData, pCex->nRegs + f * pCex->nPis + Abc_Lit2Var(Lit) );
         }
     assert( f == nFrames );
-    if ( !Saig_ManVerifyCex(p->pAig, pCex) )
+    // when solving all outputs, the counter-examples are verified together at the end
+    if ( !p->pPars->fSolveAll && !Saig_ManVerifyCex(p->pAig, pCex) )
         printf( "CEX for output %d is not valid.\n", p->iOutCur );
     return pCex;
 }
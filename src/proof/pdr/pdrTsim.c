@@ -404,7 +404,8 @@ Pdr_ManPrintCex( p->pAig, vCiObjs, vCiVals, NULL );
     RetValue = Pdr_ManSimDataInit( p->pAig, vCiObjs, vCiVals, vNodes, vCoObjs, vCoVals, NULL );
     assert( RetValue );
 
-    // iteratively remove flops
+    // collect flops in the order of trying to remove them
+    Vec_IntClear( vVisits );
     if ( p->pPars->fFlopPrio )
     {
         // collect flops and sort them by priority
@@ -417,45 +418,36 @@ Pdr_ManPrintCex( p->pAig, vCiObjs, vCiVals, NULL );
             Vec_IntPush( vRes, Entry );
         }
         Vec_IntSelectSortCost( Vec_IntArray(vRes), Vec_IntSize(vRes), vPrio );
-
         // try removing flops starting from low-priority to high-priority
-        Vec_IntClear( vCi2Rem );
         Vec_IntForEachEntry( vRes, Entry, i )
-        {
-            pObj = Aig_ManCi( p->pAig, Saig_ManPiNum(p->pAig) + Entry );
-            assert( Saig_ObjIsLo( p->pAig, pObj ) );
-            Vec_IntClear( vUndo );
-            if ( Pdr_ManExtendOne( p->pAig, pObj, vUndo, vVisits ) )
-                Vec_IntPush( vCi2Rem, Aig_ObjId(pObj) );
-            else
-                Pdr_ManExtendUndo( p->pAig, vUndo );
-        }
+            Vec_IntPush( vVisits, Aig_ObjId(Aig_ManCi(p->pAig, Saig_ManPiNum(p->pAig) + Entry)) );
     }
     else
     {
-        // try removing low-priority flops first
-        Vec_IntClear( vCi2Rem );
+        // try removing low-priority flops first and high-priority flops next
         Aig_ManForEachObjVec( vCiObjs, p->pAig, pObj, i )
-        {
-            if ( !Saig_ObjIsLo( p->pAig, pObj ) )
-                continue;
-            Entry = Aig_ObjCioId(pObj) - Saig_ManPiNum(p->pAig);
-            if ( Vec_IntEntry(vPrio, Entry) )
-                continue;
-            Vec_IntClear( vUndo );
-            if ( Pdr_ManExtendOne( p->pAig, pObj, vUndo, vVisits ) )
-                Vec_IntPush( vCi2Rem, Aig_ObjId(pObj) );
-            else
-                Pdr_ManExtendUndo( p->pAig, vUndo );
-        }
-        // try removing high-priority flops next
+            if ( Saig_ObjIsLo( p->pAig, pObj ) && !Vec_IntEntry(vPrio, Aig_ObjCioId(pObj) - Saig_ManPiNum(p->pAig)) )
+                Vec_IntPush( vVisits, Aig_ObjId(pObj) );
         Aig_ManForEachObjVec( vCiObjs, p->pAig, pObj, i )
+            if ( Saig_ObjIsLo( p->pAig, pObj ) && Vec_IntEntry(vPrio, Aig_ObjCioId(pObj) - Saig_ManPiNum(p->pAig)) )
+                Vec_IntPush( vVisits, Aig_ObjId(pObj) );
+    }
+
+    // iteratively remove flops
+    if ( p->pXsim )
+    {
+        // try many flops at once (the object IDs are the same in the AIG and in the GIA)
+        Gia_XsimManSetCone( p->pXsim, vCiObjs, vNodes, vCoObjs );
+        Gia_XsimManLift( p->pXsim, vCiVals, vVisits, vCi2Rem );
+    }
+    else
+    {
+        Vec_IntClear( vRes );
+        Vec_IntAppend( vRes, vVisits );
+        Vec_IntClear( vCi2Rem );
+        Aig_ManForEachObjVec( vRes, p->pAig, pObj, i )
         {
-            if ( !Saig_ObjIsLo( p->pAig, pObj ) )
-                continue;
-            Entry = Aig_ObjCioId(pObj) - Saig_ManPiNum(p->pAig);
-            if ( !Vec_IntEntry(vPrio, Entry) )
-                continue;
+            assert( Saig_ObjIsLo( p->pAig, pObj ) );
             Vec_IntClear( vUndo );
             if ( Pdr_ManExtendOne( p->pAig, pObj, vUndo, vVisits ) )
                 Vec_IntPush( vCi2Rem, Aig_ObjId(pObj) );
@@ -102,6 +102,7 @@ struct Ssw_RarPars_t_
     int              nRandSeed;
     int              TimeOut;
     int              TimeOutGap;
+    int              nProcs;
     int              fSolveAll;
     int              fSetLastState;
     int              fVerbose;
@@ -23,6 +23,16 @@
 #include "base/main/main.h"
 #include "sat/bmc/bmc.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#if defined(_WIN32) && !defined(__MINGW32__)
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -58,6 +68,33 @@ struct Ssw_RarMan_t_
     Vec_Ptr_t *    vCexes;
 };
 
+// the shared detector of the shallowest counter-example
+typedef struct Ssw_RarBest_t_ Ssw_RarBest_t;
+struct Ssw_RarBest_t_
+{
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t Mutex;       // protects the fields below
+#endif
+    volatile int   nFramesBest;  // frames simulated by the batch before failing
+    volatile int   iBatchBest;   // the batch that failed
+    abctime        nTimeToStop;  // the shared runtime limit
+};
+
+// the batch of patterns simulated by one thread
+typedef struct Ssw_RarThr_t_ Ssw_RarThr_t;
+struct Ssw_RarThr_t_
+{
+    Ssw_RarPars_t  Pars;         // parameters of the batch
+    Ssw_RarMan_t * pMan;         // simulation data of the batch
+    Ssw_RarBest_t* pBest;        // shared counter-example detector
+    int            iBatch;       // the batch number
+    int            nSeedBase;    // the first random seed of the batch
+    int            nRounds;      // the number of rounds simulated
+    int            nRestarts;    // the number of restarts
+    int            nSeedFail;    // the random seed used when the batch failed
+    int            iFrameFail;   // the failed frame
+};
+
 
 static inline int  Ssw_RarGetBinPat( Ssw_RarMan_t * p, int iBin, int iPat )
 {
@@ -110,6 +147,7 @@ void Ssw_RarSetDefaultParams( Ssw_RarPars_t * p )
     p->nRandSeed     =   0;
     p->TimeOut       =   0;
     p->TimeOutGap    =   0;
+    p->nProcs        =   0;
     p->fSolveAll     =   0;
     p->fDropSatOuts  =   0;
     p->fSetLastState =   0;
@@ -660,7 +698,8 @@ void Ssw_RarManSimulate( Ssw_RarMan_t * p, Vec_Int_t * vInit, int fUpdate, int f
     Ssw_RarManInitialize( p, vInit );
     Vec_PtrClear( p->vUpdConst );
     Vec_PtrClear( p->vUpdClass );
-    Aig_ManIncrementTravId( p->pAig );
+    if ( fUpdate )
+        Aig_ManIncrementTravId( p->pAig );
     // check comb inputs
     if ( fUpdate )
     Aig_ManForEachCi( p->pAig, pObj, i )
@@ -961,6 +1000,197 @@ int Ssw_RarCheckTrivial( Aig_Man_t * pAig, int fVerbose )
     return 0;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if another batch has failed earlier.]
+
+  Description [The batches are ordered by the number of frames simulated
+  before the failure and then by the batch number.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Ssw_RarBestIsEarlier( Ssw_RarBest_t * pBest, int nFrames, int iBatch )
+{
+    int RetValue;
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_lock( &pBest->Mutex );
+#endif
+    RetValue = pBest->nFramesBest < nFrames || (pBest->nFramesBest == nFrames && pBest->iBatchBest < iBatch);
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_unlock( &pBest->Mutex );
+#endif
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates one batch of patterns.]
+
+  Description [The batch has its own simulation data, flop state, and
+  random seed, so that the batches can be simulated concurrently. The
+  batch stops when it fails or when another batch has failed after
+  simulating fewer frames. As a result, the detected counter-example
+  does not depend on the order, in which the batches are scheduled.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Ssw_RarSimulateBatch( void * pArg )
+{
+    Ssw_RarThr_t * pThr = (Ssw_RarThr_t *)pArg;
+    Ssw_RarBest_t * pBest = pThr->pBest;
+    Ssw_RarPars_t * pPars = &pThr->Pars;
+    Ssw_RarMan_t * p = pThr->pMan;
+    int r, f, nFrames = 0, nSavedSeed = pPars->nRandSeed;
+    Ssw_RarManPrepareRandom( pThr->nSeedBase + nSavedSeed );
+    for ( r = 0; !pPars->nRounds || (pThr->nRestarts * pPars->nRestart + r < pPars->nRounds); r++ )
+    {
+        pThr->nRounds = pThr->nRestarts * pPars->nRestart + r;
+        for ( f = 0; f < pPars->nFrames; f++, nFrames++ )
+        {
+            // quit if another batch has failed earlier
+            if ( pBest->nFramesBest <= nFrames && Ssw_RarBestIsEarlier( pBest, nFrames, pThr->iBatch ) )
+                return 0;
+            if ( pBest->nTimeToStop && Abc_Clock() > pBest->nTimeToStop )
+                return 0;
+            Ssw_RarManSimulate( p, f ? NULL : p->vInits, 0, 0 );
+            if ( !Ssw_RarManCheckNonConstOutputs( p, r * pPars->nFrames + f, 0 ) )
+                continue;
+            // record the failure
+            pThr->nSeedFail  = pThr->nSeedBase + nSavedSeed;
+            pThr->iFrameFail = r * pPars->nFrames + f;
+#ifdef ABC_USE_PTHREADS
+            pthread_mutex_lock( &pBest->Mutex );
+#endif
+            if ( nFrames < pBest->nFramesBest || (nFrames == pBest->nFramesBest && pThr->iBatch < pBest->iBatchBest) )
+            {
+                pBest->nFramesBest = nFrames;
+                pBest->iBatchBest  = pThr->iBatch;
+            }
+#ifdef ABC_USE_PTHREADS
+            pthread_mutex_unlock( &pBest->Mutex );
+#endif
+            return 1;
+        }
+        // get initialization patterns
+        if ( pPars->nRestart && r == pPars->nRestart )
+        {
+            r = -1;
+            nSavedSeed = (nSavedSeed + 1) % 1000;
+            Ssw_RarManPrepareRandom( pThr->nSeedBase + nSavedSeed );
+            Vec_IntFill( p->vInits, Aig_ManRegNum(p->pAig) * pPars->nWords, 0 );
+            pThr->nRestarts++;
+            Vec_IntClear( p->vPatBests );
+        }
+        else
+            Ssw_RarTransferPatterns( p, p->vInits );
+    }
+    pThr->nRounds = pThr->nRestarts * pPars->nRestart + r;
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Perform sequential simulation of several batches.]
+
+  Description [Each batch is simulated by a separate thread, using a
+  different random seed, for the given number of rounds. The AIG is shared
+  by the threads and is not modified. The counter-example is derived from
+  the batch that failed after simulating the smallest number of frames.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Ssw_RarSimulateMt( Aig_Man_t * pAig, Ssw_RarPars_t * pPars )
+{
+    Ssw_RarBest_t Best, * pBest = &Best;
+    Ssw_RarThr_t * pThrs, * pThr;
+    Vec_Ptr_t * vThrs;
+    int i, nRounds = 0, RetValue = -1;
+    int nBatches = pPars->nProcs;
+    abctime clkTotal = Abc_Clock();
+    assert( !pPars->fSolveAll && nBatches > 1 && nBatches <= 100 );
+    if ( pPars->fVerbose )
+        Abc_Print( 1, "Rarity simulation with %d batches of %d words, %d frames, %d rounds, %d restart, %d seed, and %d sec timeout.\n",
+            nBatches, pPars->nWords, pPars->nFrames, pPars->nRounds, pPars->nRestart, pPars->nRandSeed, pPars->TimeOut );
+    // start the detector
+    memset( pBest, 0, sizeof(Ssw_RarBest_t) );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_init( &pBest->Mutex, NULL );
+#endif
+    pBest->nFramesBest = ABC_INFINITY;
+    pBest->iBatchBest  = nBatches;
+    if ( pPars->TimeOut )
+        pBest->nTimeToStop = pPars->TimeOut * CLOCKS_PER_SEC + clkTotal;
+    if ( pPars->TimeOutGap && (!pBest->nTimeToStop || pBest->nTimeToStop > pPars->TimeOutGap * CLOCKS_PER_SEC + clkTotal) )
+        pBest->nTimeToStop = pPars->TimeOutGap * CLOCKS_PER_SEC + clkTotal;
+    // start the batches
+    pThrs = ABC_CALLOC( Ssw_RarThr_t, nBatches );
+    vThrs = Vec_PtrAlloc( nBatches );
+    for ( i = 0; i < nBatches; i++ )
+    {
+        pThr = pThrs + i;
+        pThr->Pars         = *pPars;
+        pThr->Pars.nProcs  = 0;
+        pThr->pMan         = Ssw_RarManStart( pAig, &pThr->Pars );
+        pThr->pMan->vInits = Vec_IntStart( Aig_ManRegNum(pAig) * pPars->nWords );
+        pThr->pBest        = pBest;
+        pThr->iBatch       = i;
+        pThr->nSeedBase    = 1000 * i;
+        Vec_PtrPush( vThrs, pThr );
+    }
+    Util_ProcessThreads( Ssw_RarSimulateBatch, vThrs, nBatches + 1, 0, 0 );
+    for ( i = 0; i < nBatches; i++ )
+        nRounds += pThrs[i].nRounds;
+    // derive the counter-example
+    if ( pBest->iBatchBest < nBatches )
+    {
+        pThr = pThrs + pBest->iBatchBest;
+        if ( pPars->fVerbose )
+            Abc_Print( 1, "Batch %d failed after simulating %d frames. The batches simulated %d rounds.\n", pThr->iBatch, pBest->nFramesBest, nRounds );
+        Ssw_RarManPrepareRandom( pThr->nSeedFail );
+        pAig->pSeqModel = Ssw_RarDeriveCex( pThr->pMan, pThr->iFrameFail, pThr->pMan->iFailPo, pThr->pMan->iFailPat, pPars->fVerbose );
+        if ( !pPars->fSilent )
+        {
+            Abc_Print( 1, "Output %d of miter \"%s\" was asserted in frame %d.  ", pAig->pSeqModel->iPo, pAig->pName, pAig->pSeqModel->iFrame );
+            Abc_PrintTime( 1, "Time", Abc_Clock() - clkTotal );
+        }
+        RetValue = 0;
+    }
+    else
+    {
+        pThr = pThrs;
+        if ( !pPars->fSilent )
+        {
+            Abc_Print( 1, "Simulation of %d frames for %d rounds in %d batches did not assert POs.  ", pPars->nFrames, nRounds, nBatches );
+            if ( pBest->nTimeToStop && Abc_Clock() > pBest->nTimeToStop )
+                Abc_Print( 1, "Reached timeout (%d sec).  ", pPars->TimeOutGap && (!pPars->TimeOut || pPars->TimeOutGap < pPars->TimeOut) ? pPars->TimeOutGap : pPars->TimeOut );
+            Abc_PrintTime( 1, "Time", Abc_Clock() - clkTotal );
+        }
+    }
+    if ( pPars->fSetLastState )
+    {
+        Vec_IntShrink( pThr->pMan->vInits, Aig_ManRegNum(pAig) );
+        pAig->pData = pThr->pMan->vInits;  pThr->pMan->vInits = NULL;
+    }
+    // cleanup
+    for ( i = 0; i < nBatches; i++ )
+        Ssw_RarManStop( pThrs[i].pMan );
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_destroy( &pBest->Mutex );
+#endif
+    Vec_PtrFree( vThrs );
+    ABC_FREE( pThrs );
+    return RetValue;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Perform sequential simulation.]
@@ -988,6 +1218,8 @@ int Ssw_RarSimulate( Aig_Man_t * pAig, Ssw_RarPars_t * pPars )
     assert( Aig_ManRegNum(pAig) > 0 );
     assert( Aig_ManConstrNum(pAig) == 0 );
     ABC_FREE( pAig->pSeqModel );
+    if ( pPars->nProcs > 1 && !pPars->fSolveAll && pPars->pFuncProgress == NULL )
+        return Ssw_RarSimulateMt( pAig, pPars );
     // consider the case of empty AIG
 //    if ( Aig_ManNodeNum(pAig) == 0 )
 //        return -1;
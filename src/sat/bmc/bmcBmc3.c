@@ -27,6 +27,7 @@
 #include "sat/cadical/ccadical.h"
 #include "misc/vec/vecHsh.h"
 #include "misc/vec/vecWec.h"
+#include "aig/gia/giaAig.h"
 #include "bmc.h"
 
 ABC_NAMESPACE_IMPL_START
@@ -1504,7 +1505,7 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
     unsigned * pInfo;
     int RetValue = -1, fFirst = 1, nJumpFrame = 0, fUnfinished = 0;
     int nOutDigits = Abc_Base10Log( Saig_ManPoNum(pAig) );
-    int i, f, k, Lit, status;
+    int i, f, k, Lit, status, nSatVarsSolved;
     abctime clk, clk2, clkSatRun, clkOther = 0, clkTotal = Abc_Clock();
     abctime nTimeUnsat = 0, nTimeSat = 0, nTimeUndec = 0, clkOne = 0;
     abctime nTimeToStopNG, nTimeToStop;
@@ -1793,11 +1794,14 @@ nTimeSat += clkSatRun;
                         nOutDigits, i, f, nOutDigits, pPars->nFailOuts, nOutDigits, Saig_ManPoNum(pAig) );
                 if ( p->vCexes == NULL )
                     p->vCexes = Vec_PtrStart( Saig_ManPoNum(pAig) );
-                pCexNew = (p->pPars->fUseBridge || pPars->fStoreCex) ? Saig_ManGenerateCex( p, f, i ) : (Abc_Cex_t *)(ABC_PTRINT_T)1;
+                pCexNew = (p->pPars->fUseBridge || pPars->fStoreCex || pPars->pCexStore) ? Saig_ManGenerateCex( p, f, i ) : (Abc_Cex_t *)(ABC_PTRINT_T)1;
                 pCexNew0 = NULL;
-                if ( p->pPars->fUseBridge )
+                if ( pPars->pCexStore )
+                    Abc_CexStoreAdd( pPars->pCexStore, pCexNew, NULL );
+                if ( p->pPars->fUseBridge || pPars->pCexStore )
                 {
-                    Gia_ManToBridgeResult( stdout, 0, pCexNew, pCexNew->iPo );
+                    if ( p->pPars->fUseBridge )
+                        Gia_ManToBridgeResult( stdout, 0, pCexNew, pCexNew->iPo );
                     //Abc_CexFree( pCexNew );
                     pCexNew0 = pCexNew; 
                     pCexNew = (Abc_Cex_t *)(ABC_PTRINT_T)1;
@@ -1825,6 +1829,7 @@ nTimeSat += clkSatRun;
                 }
 
                 // check if other outputs failed under the same counter-example
+                nSatVarsSolved = p->nSatVars;
                 Saig_ManForEachPo( pAig, pObj, k )
                 {
                     Abc_Cex_t * pCexDup;
@@ -1835,7 +1840,14 @@ nTimeSat += clkSatRun;
                         continue;
                     // check if this output is solved
                     Lit = Saig_ManBmcCreateCnf( p, pObj, f );
-                    if ( p->pSat2 )
+                    // skip constant 0 and the variables added after solving, which have no value
+                    if ( Lit == 0 || (Lit > 1 && lit_var(Lit) >= nSatVarsSolved) )
+                        continue;
+                    if ( Lit == 1 )
+                    {
+                        // constant 1 is asserted under any counter-example
+                    }
+                    else if ( p->pSat2 )
                     {
                         if ( satoko_read_cex_varvalue(p->pSat2, lit_var(Lit)) == Abc_LitIsCompl(Lit) )
                             continue;
@@ -1860,17 +1872,20 @@ nTimeSat += clkSatRun;
                     if ( !pPars->fNotVerbose )
                         Abc_Print( 1, "Output %*d was asserted in frame %2d (solved %*d out of %*d outputs).\n",  
                             nOutDigits, k, f, nOutDigits, pPars->nFailOuts, nOutDigits, Saig_ManPoNum(pAig) );
+                    // set the output number
+                    if ( pCexNew0 )
+                        pCexNew0->iPo = k;
                     // report to the bridge
                     if ( p->pPars->fUseBridge )
-                    {
-                        // set the output number
-                        pCexNew0->iPo = k;
                         Gia_ManToBridgeResult( stdout, 0, pCexNew0, pCexNew0->iPo );
-                    }
+                    // add to the storage
+                    if ( pPars->pCexStore )
+                        Abc_CexStoreAdd( pPars->pCexStore, pCexNew0, NULL );
                     // remember solved output
                     //Vec_PtrWriteEntry( p->vCexes, k, Abc_CexDup(pCexNew, Saig_ManRegNum(pAig)) );
                     pCexDup = Abc_CexDup(pCexNew, Saig_ManRegNum(pAig));
-                    pCexDup->iPo = k;
+                    if ( pCexDup != (Abc_Cex_t *)(ABC_PTRINT_T)1 )
+                        pCexDup->iPo = k;
                     Vec_PtrWriteEntry( p->vCexes, k, pCexDup );
                 }
                 Abc_CexFreeP( &pCexNew0 );
@@ -1942,6 +1957,26 @@ finish:
         Abc_Print( 1, "\n" );
     }
     Saig_Bmc3ManStop( p );
+    // verify the counter-examples of all outputs in one simulation pass
+    // and drop those that failed, so that their outputs remain undecided
+    if ( pAig->vSeqModelVec )
+    {
+        Vec_Int_t * vFailed = Vec_IntAlloc( 0 );
+        if ( Gia_ManVerifyCexesAig( pAig, pAig->vSeqModelVec, vFailed ) )
+        {
+            Abc_Print( 1, "Saig_ManBmcScalable(): Counter-example verification has FAILED for %d outputs, which are now undecided.\n", Vec_IntSize(vFailed) );
+            Vec_IntForEachEntry( vFailed, i, k )
+            {
+                Abc_Cex_t * pCexBad = (Abc_Cex_t *)Vec_PtrEntry( pAig->vSeqModelVec, i );
+                Abc_CexFree( pCexBad );
+                Vec_PtrWriteEntry( pAig->vSeqModelVec, i, NULL );
+            }
+            pPars->nFailOuts -= Vec_IntSize(vFailed);
+            if ( pPars->nFailOuts == 0 && RetValue == 0 )
+                RetValue = -1;
+        }
+        Vec_IntFree( vFailed );
+    }
     fflush( stdout );
     if ( pLogFile )
         fclose( pLogFile );
@@ -73,17 +73,29 @@ static inline void Gia_ManTerSimInfoSet( unsigned * pInfo, int i, int Value )
 ***********************************************************************/
 Vec_Ptr_t * Bmc_MnaTernary( Gia_Man_t * p, int nFrames, int nFramesAdd, int fVerbose, int * iFirst )
 {
+    Gia_XsimMan_t * pXsim;
+    Vec_Int_t * vCis, * vNodes, * vCos;
     Vec_Ptr_t * vStates;
     unsigned * pState;
     int nStateWords = Abc_BitWordNum( 2*Gia_ManCoNum(p) );
     Gia_Obj_t * pObj, * pObjRo;
-    int f, i, Count[4];
+    word MaskX = ~(word)0;
+    int f, i, Value, Count[4];
     abctime clk = Abc_Clock();
-    Gia_ManConst0(p)->Value = GIA_ZER;
+    // the whole AIG is simulated with one pattern
+    vCis   = Vec_IntAlloc( Gia_ManCiNum(p) );
+    vNodes = Vec_IntAlloc( Gia_ManAndNum(p) );
+    vCos   = Vec_IntAlloc( Gia_ManCoNum(p) );
+    Gia_ManForEachCi( p, pObj, i )
+        Vec_IntPush( vCis, Gia_ObjId(p, pObj) );
+    Gia_ManForEachAnd( p, pObj, i )
+        Vec_IntPush( vNodes, i );
+    Gia_ManForEachCo( p, pObj, i )
+        Vec_IntPush( vCos, Gia_ObjId(p, pObj) );
+    pXsim = Gia_XsimManStart( p, 1 );
+    Gia_XsimManSetCone( pXsim, vCis, vNodes, vCos );
     Gia_ManForEachPi( p, pObj, i )
-        pObj->Value = GIA_UND;
-    Gia_ManForEachRi( p, pObj, i )
-        pObj->Value = GIA_ZER;
+        Gia_XsimManSetCi( pXsim, Gia_ObjId(p, pObj), 0 ), Gia_XsimManSetCiX( pXsim, Gia_ObjId(p, pObj), &MaskX );
     *iFirst = -1;
     vStates = Vec_PtrAlloc( 100 );
     for ( f = 0; ; f++ )
@@ -96,14 +108,18 @@ Vec_Ptr_t * Bmc_MnaTernary( Gia_Man_t * p, int nFrames, int nFramesAdd, int fVer
             break;
         // aassign CI values
         Gia_ManForEachRiRo( p, pObj, pObjRo, i )
-            pObjRo->Value = pObj->Value;
-        Gia_ManForEachAnd( p, pObj, i )
-            pObj->Value = Gia_XsimAndCond( Gia_ObjFanin0(pObj)->Value, Gia_ObjFaninC0(pObj), Gia_ObjFanin1(pObj)->Value, Gia_ObjFaninC1(pObj) );
+        {
+            Value = f ? Gia_XsimManValue( pXsim, Gia_ObjId(p, pObj), 0 ) : GIA_ZER;
+            Gia_XsimManSetCi( pXsim, Gia_ObjId(p, pObjRo), Value == GIA_ONE );
+            if ( Value == GIA_UND )
+                Gia_XsimManSetCiX( pXsim, Gia_ObjId(p, pObjRo), &MaskX );
+        }
+        Gia_XsimManSimulate( pXsim );
         // compute and save CO values
         pState = ABC_ALLOC( unsigned, nStateWords );
         Gia_ManForEachCo( p, pObj, i )
         {
-            pObj->Value = Gia_XsimNotCond( Gia_ObjFanin0(pObj)->Value, Gia_ObjFaninC0(pObj) );
+            pObj->Value = Gia_XsimManValue( pXsim, Gia_ObjId(p, pObj), 0 );
             Gia_ManTerSimInfoSet( pState, i, pObj->Value );
             if ( *iFirst == -1 && i < Gia_ManPoNum(p) && pObj->Value == GIA_UND )
                 *iFirst = f;
@@ -119,6 +135,10 @@ Vec_Ptr_t * Bmc_MnaTernary( Gia_Man_t * p, int nFrames, int nFramesAdd, int fVer
             f, Count[GIA_ZER], Count[GIA_ONE], Count[GIA_UND], Gia_ManRegNum(p), 
             Gia_ManPo(p, 0)->Value == GIA_UND ? "x" : "0" );  
     }
+    Gia_XsimManStop( pXsim );
+    Vec_IntFree( vCis );
+    Vec_IntFree( vNodes );
+    Vec_IntFree( vCos );
 //    assert( Vec_PtrSize(vStates) == nFrames );
     if ( fVerbose )
         printf( "Finished %d frames. First x-valued PO is in frame %d.  ", nFrames, *iFirst );
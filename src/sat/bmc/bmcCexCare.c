@@ -28,6 +28,28 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+// the worker minimizing batches of counter-examples
+typedef struct Bmc_CareWorker_t_ Bmc_CareWorker_t;
+struct Bmc_CareWorker_t_
+{
+    Gia_Man_t *     p;          // the AIG (shared and not modified)
+    Vec_Ptr_t *     vCexes;     // the counter-examples (shared)
+    Vec_Ptr_t *     vCares;     // the care-sets (shared, each entry is written by one worker)
+    Vec_Int_t *     vOrder;     // the counter-examples in the order of their length (shared)
+    Vec_Bit_t *     vPrefs;     // the fanin to justify the zero of each node (shared)
+    int             iWorker;    // the number of this worker
+    int             nWorkers;   // the number of workers
+    Vec_Int_t *     vBatch;     // the counter-examples of the current batch
+    Vec_Wrd_t *     vSims;      // the values of the objects in one frame
+    Vec_Wrd_t *     vCare;      // the care-set of the objects in one frame
+    Vec_Wrd_t *     vStates;    // the values of the flops in all frames
+    Vec_Wrd_t *     vNext;      // the care-set of the flops in the next frame
+    int             nFailed;    // the number of counter-examples, which do not fail the output
+};
+
+static inline word Bmc_CareSim0( word * pSims, Gia_Obj_t * pObj, int i ) { return Gia_ObjFaninC0(pObj) ? ~pSims[Gia_ObjFaninId0(pObj, i)] : pSims[Gia_ObjFaninId0(pObj, i)]; }
+static inline word Bmc_CareSim1( word * pSims, Gia_Obj_t * pObj, int i ) { return Gia_ObjFaninC1(pObj) ? ~pSims[Gia_ObjFaninId1(pObj, i)] : pSims[Gia_ObjFaninId1(pObj, i)]; }
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -444,6 +466,288 @@ Abc_Cex_t * Bmc_CexCareSatBasedMinimize( Aig_Man_t * p, int nRealPis, Abc_Cex_t
     return pCexMin;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Simulates one frame of the batch of counter-examples.]
+
+  Description [Bit k of the simulation words belongs to the k-th 
+  counter-example of the batch. The flop values of the frame should be
+  already stored.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmc_CexCareBatchSimulate( Bmc_CareWorker_t * p, int f )
+{
+    word * pStates = Vec_WrdArray( p->vStates ) + f * Gia_ManRegNum(p->p);
+    Gia_ManCexesSimulateFrame( p->p, p->vCexes, Vec_IntArray(p->vBatch), Vec_IntSize(p->vBatch), f, pStates, Vec_WrdArray(p->vSims) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the care-sets of one batch of counter-examples.]
+
+  Description [The forward pass records the flop values in each frame.
+  The backward pass re-simulates the frames in the reverse order and 
+  propagates the care-sets of all counter-examples of the batch from the 
+  failed outputs towards the primary inputs, one simulation word at a time.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmc_CexCareBatchOne( Bmc_CareWorker_t * p, int nFrames )
+{
+    Gia_Man_t * pGia = p->p;
+    Gia_Obj_t * pObj; Abc_Cex_t * pCex, * pCexCare;
+    word * pSims, * pCare, * pStates, * pNext;
+    int i, k, f, iCex, iFan0, iFan1, nRegs = Gia_ManRegNum(pGia);
+    Vec_WrdFill( p->vStates, nFrames * nRegs, 0 );
+    Vec_WrdFill( p->vNext, nRegs, 0 );
+    pSims   = Vec_WrdArray( p->vSims );
+    pCare   = Vec_WrdArray( p->vCare );
+    pStates = Vec_WrdArray( p->vStates );
+    pNext   = Vec_WrdArray( p->vNext );
+    // the initial states are given by the counter-examples
+    Vec_IntForEachEntry( p->vBatch, iCex, k )
+    {
+        pCex = (Abc_Cex_t *)Vec_PtrEntry( p->vCexes, iCex );
+        for ( i = 0; i < nRegs; i++ )
+            if ( Abc_InfoHasBit( pCex->pData, i ) )
+                pStates[i] |= (word)1 << k;
+    }
+    // forward pass
+    for ( f = 0; f < nFrames - 1; f++ )
+    {
+        Bmc_CexCareBatchSimulate( p, f );
+        Gia_ManForEachRi( pGia, pObj, i )
+            pStates[(f + 1) * nRegs + i] = pSims[Gia_ObjId(pGia, pObj)];
+    }
+    // backward pass
+    for ( f = nFrames - 1; f >= 0; f-- )
+    {
+        Bmc_CexCareBatchSimulate( p, f );
+        memset( pCare, 0, sizeof(word) * Gia_ManObjNum(pGia) );
+        Gia_ManForEachRi( pGia, pObj, i )
+            pCare[Gia_ObjId(pGia, pObj)] = pNext[i];
+        Vec_IntForEachEntry( p->vBatch, iCex, k )
+        {
+            pCex = (Abc_Cex_t *)Vec_PtrEntry( p->vCexes, iCex );
+            if ( pCex->iFrame != f )
+                continue;
+            pObj = Gia_ManPo( pGia, pCex->iPo );
+            if ( (pSims[Gia_ObjId(pGia, pObj)] >> k) & 1 )
+            {
+                pCare[Gia_ObjId(pGia, pObj)] |= (word)1 << k;
+                continue;
+            }
+            // the counter-example does not fail the output
+            pCexCare = (Abc_Cex_t *)Vec_PtrEntry( p->vCares, iCex );
+            Vec_PtrWriteEntry( p->vCares, iCex, NULL );
+            Abc_CexFree( pCexCare );
+            p->nFailed++;
+        }
+        Gia_ManForEachCo( pGia, pObj, i )
+            pCare[Gia_ObjFaninId0p(pGia, pObj)] |= pCare[Gia_ObjId(pGia, pObj)];
+        Gia_ManForEachAndReverse( pGia, pObj, i )
+        {
+            word Care = pCare[i], Sim0, Sim1, Both0;
+            if ( Care == 0 )
+                continue;
+            iFan0 = Gia_ObjFaninId0( pObj, i );
+            iFan1 = Gia_ObjFaninId1( pObj, i );
+            Sim0  = Bmc_CareSim0( pSims, pObj, i );
+            Sim1  = Bmc_CareSim1( pSims, pObj, i );
+            // the fanin is needed if the other fanin is one
+            Both0 = Care & ~Sim0 & ~Sim1 & ~pCare[iFan0] & ~pCare[iFan1];
+            pCare[iFan0] |= Care & Sim1;
+            pCare[iFan1] |= Care & Sim0;
+            // if both fanins are zero and none of them is needed yet, take the preferred one
+            pCare[Vec_BitEntry(p->vPrefs, i) ? iFan1 : iFan0] |= Both0;
+        }
+        // record the primary inputs
+        Gia_ManForEachPi( pGia, pObj, i )
+        {
+            word Care = pCare[Gia_ObjId(pGia, pObj)];
+            if ( Care == 0 )
+                continue;
+            Vec_IntForEachEntry( p->vBatch, iCex, k )
+                if ( ((Care >> k) & 1) && (pCexCare = (Abc_Cex_t *)Vec_PtrEntry(p->vCares, iCex)) )
+                    Abc_InfoSetBit( pCexCare->pData, pCexCare->nRegs + pCexCare->nPis * f + i );
+        }
+        // the flops are justified in the previous frame
+        Gia_ManForEachRo( pGia, pObj, i )
+            pNext[i] = pCare[Gia_ObjId(pGia, pObj)];
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Minimizes the batches of counter-examples of one worker.]
+
+  Description [The workers take the batches of 64 counter-examples 
+  in the round-robin order.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_CexCareBatchWorker( void * pArg )
+{
+    Bmc_CareWorker_t * p = (Bmc_CareWorker_t *)pArg;
+    Abc_Cex_t * pCex;
+    int b, i, iCex, nFrames, nBatches = (Vec_IntSize(p->vOrder) + 63) / 64;
+    for ( b = p->iWorker; b < nBatches; b += p->nWorkers )
+    {
+        Vec_IntClear( p->vBatch );
+        nFrames = 0;
+        for ( i = 64 * b; i < Abc_MinInt(64 * (b + 1), Vec_IntSize(p->vOrder)); i++ )
+        {
+            iCex = Vec_IntEntry( p->vOrder, i );
+            pCex = (Abc_Cex_t *)Vec_PtrEntry( p->vCexes, iCex );
+            nFrames = Abc_MaxInt( nFrames, pCex->iFrame + 1 );
+            Vec_IntPush( p->vBatch, iCex );
+        }
+        Bmc_CexCareBatchOne( p, nFrames );
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the care-sets of many counter-examples.]
+
+  Description [Returns the array of care-sets, which has the same size as
+  the array of counter-examples. The care-set is NULL if the counter-example
+  is not recorded, does not match the AIG, or does not fail its output. The
+  counter-examples of similar length are packed into 64-bit simulation
+  words and the batches are minimized by nProcs concurrent workers.
+  When both fanins of an AND node are zero, the care-set prefers the
+  primary input and then the fanin with the smaller level, so the result
+  may differ from that of Bmc_CexCareMinimizeAig(), which tries several
+  priority orders for each counter-example.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Ptr_t * Bmc_CexCareMinimizeBatch( Gia_Man_t * p, Vec_Ptr_t * vCexes, int nProcs, int fCheck, int fVerbose )
+{
+    Vec_Ptr_t * vCares = Vec_PtrStart( Vec_PtrSize(vCexes) );
+    Vec_Ptr_t * vWorkers;
+    Vec_Int_t * vOrder = Vec_IntAlloc( Vec_PtrSize(vCexes) );
+    Vec_Int_t * vCosts = Vec_IntStart( Vec_PtrSize(vCexes) );
+    Vec_Bit_t * vPrefs = Vec_BitStart( Gia_ManObjNum(p) );
+    Bmc_CareWorker_t * pWorkers;
+    Abc_Cex_t * pCex, * pCexCare;
+    Gia_Obj_t * pObj, * pFan0, * pFan1;
+    int i, nBatches, nFailed = 0, nBits = 0, nCares = 0, nCheckFails = 0;
+    abctime clk = Abc_Clock();
+    // collect the counter-examples and sort them by length
+    Vec_PtrForEachEntry( Abc_Cex_t *, vCexes, pCex, i )
+    {
+        if ( pCex == NULL || pCex == (Abc_Cex_t *)(ABC_PTRINT_T)1 )
+            continue;
+        if ( pCex->nPis != Gia_ManPiNum(p) || pCex->nRegs != Gia_ManRegNum(p) || pCex->iPo >= Gia_ManPoNum(p) )
+        {
+            printf( "Counter-example %d does not match the AIG.\n", i );
+            continue;
+        }
+        pCexCare = Abc_CexAlloc( pCex->nRegs, pCex->nPis, pCex->iFrame + 1 );
+        pCexCare->iPo    = pCex->iPo;
+        pCexCare->iFrame = pCex->iFrame;
+        Vec_PtrWriteEntry( vCares, i, pCexCare );
+        Vec_IntWriteEntry( vCosts, i, pCex->iFrame );
+        Vec_IntPush( vOrder, i );
+    }
+    Abc_MergeSortCost2( Vec_IntArray(vOrder), Vec_IntSize(vOrder), Vec_IntArray(vCosts) );
+    Vec_IntFree( vCosts );
+    // select the fanin to justify the zero value
+    Gia_ManLevelNum( p );
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        pFan0 = Gia_ObjFanin0(pObj);
+        pFan1 = Gia_ObjFanin1(pObj);
+        if ( Gia_ObjIsPi(p, pFan0) != Gia_ObjIsPi(p, pFan1) )
+        {
+            if ( Gia_ObjIsPi(p, pFan1) )
+                Vec_BitWriteEntry( vPrefs, i, 1 );
+        }
+        else if ( Gia_ObjLevel(p, pFan1) < Gia_ObjLevel(p, pFan0) )
+            Vec_BitWriteEntry( vPrefs, i, 1 );
+    }
+    // minimize the batches
+    nBatches = (Vec_IntSize(vOrder) + 63) / 64;
+    nProcs   = Abc_MaxInt( 1, Abc_MinInt(nProcs, nBatches) );
+    pWorkers = ABC_CALLOC( Bmc_CareWorker_t, nProcs );
+    vWorkers = Vec_PtrAlloc( nProcs );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        pWorkers[i].p        = p;
+        pWorkers[i].vCexes   = vCexes;
+        pWorkers[i].vCares   = vCares;
+        pWorkers[i].vOrder   = vOrder;
+        pWorkers[i].vPrefs   = vPrefs;
+        pWorkers[i].iWorker  = i;
+        pWorkers[i].nWorkers = nProcs;
+        pWorkers[i].vBatch   = Vec_IntAlloc( 64 );
+        pWorkers[i].vSims    = Vec_WrdStart( Gia_ManObjNum(p) );
+        pWorkers[i].vCare    = Vec_WrdStart( Gia_ManObjNum(p) );
+        pWorkers[i].vStates  = Vec_WrdAlloc( 0 );
+        pWorkers[i].vNext    = Vec_WrdAlloc( 0 );
+        Vec_PtrPush( vWorkers, pWorkers + i );
+    }
+    if ( nProcs == 1 )
+        Bmc_CexCareBatchWorker( pWorkers );
+    else
+        Util_ProcessThreads( Bmc_CexCareBatchWorker, vWorkers, nProcs + 1, 0, 0 );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        nFailed += pWorkers[i].nFailed;
+        Vec_IntFree( pWorkers[i].vBatch );
+        Vec_WrdFree( pWorkers[i].vSims );
+        Vec_WrdFree( pWorkers[i].vCare );
+        Vec_WrdFree( pWorkers[i].vStates );
+        Vec_WrdFree( pWorkers[i].vNext );
+    }
+    ABC_FREE( pWorkers );
+    Vec_PtrFree( vWorkers );
+    // verify the results
+    Vec_PtrForEachEntry( Abc_Cex_t *, vCares, pCexCare, i )
+    {
+        if ( pCexCare == NULL )
+            continue;
+        pCex = (Abc_Cex_t *)Vec_PtrEntry( vCexes, i );
+        nBits  += pCex->nPis * (pCex->iFrame + 1);
+        nCares += Abc_CexCountOnes( pCexCare );
+        if ( fCheck && !Bmc_CexVerify( p, pCex, pCexCare ) )
+        {
+            printf( "Care-set verification has failed for counter-example %d.\n", i );
+            nCheckFails++;
+        }
+    }
+    if ( nFailed )
+        printf( "Counter-examples (%d) do not fail the outputs.\n", nFailed );
+    if ( Vec_IntSize(vOrder) == nFailed )
+        printf( "There are no counter-examples to minimize.\n" );
+    else if ( fCheck && !nCheckFails )
+        printf( "Care-set verification succeeded for all counter-examples.\n" );
+    if ( fVerbose )
+    {
+        printf( "Minimized %d counter-examples in %d batches using %d workers.  ", Vec_IntSize(vOrder) - nFailed, nBatches, nProcs );
+        printf( "Care PI bits = %d (out of %d) (%.2f %%).  ", nCares, nBits, 100.0 * nCares / Abc_MaxInt(nBits, 1) );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    Vec_IntFree( vOrder );
+    Vec_BitFree( vPrefs );
+    return vCares;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Verifies the care set of the counter-example.]
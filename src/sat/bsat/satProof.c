@@ -925,6 +925,60 @@ void * Proof_DeriveCore( Vec_Set_t * vProof, int hRoot )
     return vCore;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Computes interpolant of the proof.]
+
+  Description [The AIG manager has one CI for each global variable.
+  Array vClaLits maps the IDs of root clauses into the AIG literals
+  of their partial interpolants: the OR of global literals for the
+  clauses of A and constant 1 for the clauses of B. The resolution 
+  steps on the variables of A are marked in the proof records.
+  Returns the AIG literal of the interpolant or -1 if there is no proof.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Proof_DeriveInterpolant( Vec_Set_t * vProof, int hRoot, void * pMan, Vec_Int_t * vClaLits )
+{
+    Aig_Man_t * pAig = (Aig_Man_t *)pMan;
+    Vec_Int_t Roots = { 1, 1, &hRoot }, * vRoots = &Roots;
+    Vec_Int_t * vUsed;
+    satset * pNode, * pFanin;
+    Aig_Obj_t * pObj = NULL, * pTemp;
+    int i, k;
+    if ( hRoot == -1 )
+        return -1;
+    // collect visited nodes in the topological order
+    vUsed = Proof_CollectUsedIter( vProof, vRoots, 1 );
+    // compute partial interpolants of the nodes
+    Proof_ForeachNodeVec( vUsed, vProof, pNode, i )
+    {
+        Proof_NodeForeachFanin( vProof, pNode, pFanin, k )
+        {
+            if ( pFanin == NULL ) // root clause
+                pTemp = Aig_ObjFromLit( pAig, Vec_IntEntry(vClaLits, pNode->pEnts[k] >> 2) );
+            else // proof node
+                pTemp = Aig_ObjFromLit( pAig, pFanin->Id );
+            if ( k == 0 )
+                pObj = pTemp;
+            else if ( pNode->pEnts[k] & 2 ) // variable of A
+                pObj = Aig_Or( pAig, pObj, pTemp );
+            else // global variable
+                pObj = Aig_And( pAig, pObj, pTemp );
+        }
+        // the node is not visited again, so its ID can store the literal
+        pNode->Id = Aig_ObjToLit( pObj );
+    }
+    // the root comes last
+    assert( Vec_IntEntryLast(vUsed) == hRoot );
+    Proof_CleanCollected( vProof, vUsed );
+    Vec_IntFree( vUsed );
+    return Aig_ObjToLit( pObj );
+}
+
 
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
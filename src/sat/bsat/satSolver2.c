@@ -1569,6 +1569,7 @@ void sat_solver2_reducedb(sat_solver2* s)
     if ( s->pPrf1 )
     {
         extern int Sat_ProofReduce( Vec_Set_t * vProof, void * pRoots, int hProofPivot );
+        s->dPrfPeak = Abc_MaxDouble( s->dPrfPeak, 8.0 * Vec_SetHandCurrent(s->pPrf1) );
         s->hProofPivot = Sat_ProofReduce( s->pPrf1, &s->claProofs, s->hProofPivot );
     }
 
@@ -1737,6 +1738,12 @@ double sat_solver2_memory_proof( sat_solver2* s )
         Mem += Vec_ReportMemory( s->pPrf1 );
     return Mem;
 }
+double sat_solver2_memory_proof_peak( sat_solver2* s )
+{
+    if ( s->pPrf1 == NULL )
+        return 0;
+    return Abc_MaxDouble( s->dPrfPeak, 8.0 * Vec_SetHandCurrent(s->pPrf1) );
+}
 
 
 // find the clause in the watcher lists
@@ -1994,5 +2001,12 @@ void * Sat_ProofCore( sat_solver2 * s )
     }
     return NULL;
 }
+int Sat_ProofInterpolantLit( sat_solver2 * s, void * pAig, void * vClaLits )
+{
+    extern int Proof_DeriveInterpolant( Vec_Set_t * vProof, int hRoot, void * pMan, Vec_Int_t * vClaLits );
+    if ( s->pPrf1 )
+        return Proof_DeriveInterpolant( s->pPrf1, s->hProofLast, pAig, (Vec_Int_t *)vClaLits );
+    return -1;
+}
 
 ABC_NAMESPACE_IMPL_END
@@ -54,6 +54,7 @@ extern void         sat_solver2_rollback(sat_solver2* s);
 extern void         sat_solver2_reducedb(sat_solver2* s);
 extern double       sat_solver2_memory( sat_solver2* s, int fAll );
 extern double       sat_solver2_memory_proof( sat_solver2* s );
+extern double       sat_solver2_memory_proof_peak( sat_solver2* s );
 
 extern void         sat_solver2_setnvars(sat_solver2* s,int n);
 
@@ -69,6 +70,7 @@ extern void         var_set_partA  (sat_solver2* s, int v, int partA);
 
 // proof-based APIs
 extern void *       Sat_ProofCore( sat_solver2 * s );
+extern int          Sat_ProofInterpolantLit( sat_solver2 * s, void * pAig, void * vClaLits );
 extern void *       Sat_ProofInterpolant( sat_solver2 * s, void * pGloVars );
 extern word *       Sat_ProofInterpolantTruth( sat_solver2 * s, void * pGloVars );
 extern void         Sat_ProofCheck( sat_solver2 * s );
@@ -165,6 +167,7 @@ struct sat_solver2_t
     int             hProofLast;     // in proof-logging mode, the ID of the final conflict clause (conf_final)
     Prf_Man_t *     pPrf2;          // another proof manager
     double          dPrfMemory;     // memory used by the proof-logger
+    double          dPrfPeak;       // the peak memory of the proof (pPrf1) before it is reduced
     Int2_Man_t *    pInt2;          // interpolation manager
     int             tempInter;      // temporary storage for the interpolant
 
@@ -20,6 +20,16 @@
 
 #include "cnf.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#if defined(_WIN32) && !defined(__MINGW32__)
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -27,7 +37,19 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#ifdef ABC_USE_PTHREADS
+// each thread uses its own manager, which is freed when the thread exits
+static pthread_key_t  s_KeyManCnf;
+static pthread_once_t s_OnceManCnf = PTHREAD_ONCE_INIT;
+static void Cnf_ManStopKey( void * pMan )        { Cnf_ManStop( (Cnf_Man_t *)pMan );                          }
+static void Cnf_ManStartKey()                    { pthread_key_create( &s_KeyManCnf, Cnf_ManStopKey );        }
+static inline Cnf_Man_t * Cnf_ManGet()           { pthread_once( &s_OnceManCnf, Cnf_ManStartKey ); return (Cnf_Man_t *)pthread_getspecific( s_KeyManCnf ); }
+static inline void Cnf_ManSet( Cnf_Man_t * p )   { pthread_once( &s_OnceManCnf, Cnf_ManStartKey ); pthread_setspecific( s_KeyManCnf, p ); }
+#else
 static Cnf_Man_t * s_pManCnf = NULL;
+static inline Cnf_Man_t * Cnf_ManGet()           { return s_pManCnf;                                          }
+static inline void Cnf_ManSet( Cnf_Man_t * p )   { s_pManCnf = p;                                             }
+#endif
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -45,22 +67,22 @@ static Cnf_Man_t * s_pManCnf = NULL;
 ***********************************************************************/
 void Cnf_ManPrepare()
 {
-    if ( s_pManCnf == NULL )
+    if ( Cnf_ManGet() == NULL )
     {
 //        printf( "\n\nCreating CNF manager!!!!!\n\n" );
-        s_pManCnf = Cnf_ManStart();
+        Cnf_ManSet( Cnf_ManStart() );
     }
 }
 Cnf_Man_t * Cnf_ManRead()
 {
-    return s_pManCnf;
+    return Cnf_ManGet();
 }
 void Cnf_ManFree()
 {
-    if ( s_pManCnf == NULL )
+    if ( Cnf_ManGet() == NULL )
         return;
-    Cnf_ManStop( s_pManCnf );
-    s_pManCnf = NULL;
+    Cnf_ManStop( Cnf_ManGet() );
+    Cnf_ManSet( NULL );
 }
 
 
@@ -165,7 +187,30 @@ p->timeSave = Abc_Clock() - clk;
 Cnf_Dat_t * Cnf_Derive( Aig_Man_t * pAig, int nOutputs )
 {
     Cnf_ManPrepare();
-    return Cnf_DeriveWithMan( s_pManCnf, pAig, nOutputs );
+    return Cnf_DeriveWithMan( Cnf_ManRead(), pAig, nOutputs );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Converts AIG into CNF while writing clauses concurrently.]
+
+  Description [Cuts and mapping are computed as in Cnf_Derive(). The clauses
+  of the mapped nodes are written by several threads. The resulting CNF is
+  the same as the one produced by Cnf_Derive().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Cnf_Dat_t * Cnf_DerivePar( Aig_Man_t * pAig, int nOutputs, int nProcs )
+{
+    Cnf_Dat_t * pCnf;
+    Cnf_ManPrepare();
+    Cnf_ManRead()->nProcs = nProcs;
+    pCnf = Cnf_DeriveWithMan( Cnf_ManRead(), pAig, nOutputs );
+    Cnf_ManRead()->nProcs = 0;
+    return pCnf;
 }
  
 /**Function*************************************************************
@@ -219,7 +264,7 @@ p->timeSave = Abc_Clock() - clk;
 Cnf_Dat_t * Cnf_DeriveOther( Aig_Man_t * pAig, int fSkipTtMin )
 {
     Cnf_ManPrepare();
-    return Cnf_DeriveOtherWithMan( s_pManCnf, pAig, fSkipTtMin );
+    return Cnf_DeriveOtherWithMan( Cnf_ManRead(), pAig, fSkipTtMin );
 }
 
 #if 0
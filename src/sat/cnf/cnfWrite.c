@@ -27,6 +27,19 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+// the range of mapped nodes whose clauses are written by one thread
+typedef struct Cnf_Slice_t_ Cnf_Slice_t;
+struct Cnf_Slice_t_
+{
+    Cnf_Man_t *     p;               // the CNF manager
+    Cnf_Dat_t *     pCnf;            // the CNF being written
+    Vec_Ptr_t *     vMapped;         // the mapped nodes
+    int             iStart;          // the first node of the slice
+    int             iStop;           // the node following the last one
+    int             iClause;         // the first clause of the slice
+    int             iLiteral;        // the first literal of the slice
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -185,65 +198,203 @@ int Cnf_IsopWriteCube( int Cube, int nVars, int * pVars, int * pLiterals )
 
 /**Function*************************************************************
 
-  Synopsis    [Derives CNF for the mapping.]
+  Synopsis    [Counts clauses and literals of one mapped node.]
 
-  Description [The last argument shows the number of last outputs
-  of the manager, which will not be converted into clauses but the
-  new variables for which will be introduced.]
+  Description [Returns the number of clauses and adds the number of 
+  literals to the last argument.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-Cnf_Dat_t * Cnf_ManWriteCnf( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs )
+static inline int Cnf_ManCountNode( Cnf_Man_t * p, Aig_Obj_t * pObj, int * pnLits )
+{
+    Cnf_Cut_t * pCut = Cnf_ObjBestCut( pObj );
+    unsigned uTruth;
+    int nClauses = 0;
+    assert( Aig_ObjIsNode(pObj) );
+    // positive polarity of the cut
+    if ( pCut->nFanins < 5 )
+    {
+        uTruth = 0xFFFF & *Cnf_CutTruth(pCut);
+        *pnLits += Cnf_SopCountLiterals( p->pSops[uTruth], p->pSopSizes[uTruth] ) + p->pSopSizes[uTruth];
+        assert( p->pSopSizes[uTruth] >= 0 );
+        nClauses += p->pSopSizes[uTruth];
+    }
+    else
+    {
+        *pnLits += Cnf_IsopCountLiterals( pCut->vIsop[1], pCut->nFanins ) + Vec_IntSize(pCut->vIsop[1]);
+        nClauses += Vec_IntSize(pCut->vIsop[1]);
+    }
+    // negative polarity of the cut
+    if ( pCut->nFanins < 5 )
+    {
+        uTruth = 0xFFFF & ~*Cnf_CutTruth(pCut);
+        *pnLits += Cnf_SopCountLiterals( p->pSops[uTruth], p->pSopSizes[uTruth] ) + p->pSopSizes[uTruth];
+        assert( p->pSopSizes[uTruth] >= 0 );
+        nClauses += p->pSopSizes[uTruth];
+    }
+    else
+    {
+        *pnLits += Cnf_IsopCountLiterals( pCut->vIsop[0], pCut->nFanins ) + Vec_IntSize(pCut->vIsop[0]);
+        nClauses += Vec_IntSize(pCut->vIsop[0]);
+    }
+    return nClauses;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes clauses of the mapped nodes in the given range.]
+
+  Description [The clauses are written starting from the given clause
+  and literal. Reads only the variable numbers and the cuts, so that 
+  the non-overlapping ranges can be written concurrently.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cnf_ManWriteCnfNodes( Cnf_Man_t * p, Cnf_Dat_t * pCnf, Vec_Ptr_t * vMapped, int iStart, int iStop, int iClause, int iLiteral, Vec_Int_t * vSopTemp )
 {
-    int fChangeVariableOrder = 0; // should be set to 0 to improve performance
     Aig_Obj_t * pObj;
-    Cnf_Dat_t * pCnf;
     Cnf_Cut_t * pCut;
-    Vec_Int_t * vCover, * vSopTemp;
-    int OutVar, PoVar, pVars[32], * pLits, ** pClas;
+    Vec_Int_t * vCover;
+    int ** pClas = pCnf->pClauses + iClause;
+    int * pLits = pCnf->pClauses[0] + iLiteral;
+    int OutVar, pVars[32], i, k, Cube;
     unsigned uTruth;
-    int i, k, nLiterals, nClauses, Cube, Number;
-
-    // count the number of literals and clauses
-    nLiterals = 1 + Aig_ManCoNum( p->pManAig ) + 3 * nOutputs;
-    nClauses = 1 + Aig_ManCoNum( p->pManAig ) + nOutputs;
-    Vec_PtrForEachEntry( Aig_Obj_t *, vMapped, pObj, i )
+    for ( i = iStart; i < iStop; i++ )
     {
-        assert( Aig_ObjIsNode(pObj) );
+        pObj = (Aig_Obj_t *)Vec_PtrEntry( vMapped, i );
         pCut = Cnf_ObjBestCut( pObj );
 
+        // save variables of this cut
+        OutVar = pCnf->pVarNums[ pObj->Id ];
+        for ( k = 0; k < (int)pCut->nFanins; k++ )
+        {
+            pVars[k] = pCnf->pVarNums[ pCut->pFanins[k] ];
+            assert( pVars[k] <= Aig_ManObjNumMax(p->pManAig) );
+        }
+
         // positive polarity of the cut
         if ( pCut->nFanins < 5 )
         {
             uTruth = 0xFFFF & *Cnf_CutTruth(pCut);
-            nLiterals += Cnf_SopCountLiterals( p->pSops[uTruth], p->pSopSizes[uTruth] ) + p->pSopSizes[uTruth];
-            assert( p->pSopSizes[uTruth] >= 0 );
-            nClauses += p->pSopSizes[uTruth];
+            Cnf_SopConvertToVector( p->pSops[uTruth], p->pSopSizes[uTruth], vSopTemp );
+            vCover = vSopTemp;
         }
         else
+            vCover = pCut->vIsop[1];
+        Vec_IntForEachEntry( vCover, Cube, k )
         {
-            nLiterals += Cnf_IsopCountLiterals( pCut->vIsop[1], pCut->nFanins ) + Vec_IntSize(pCut->vIsop[1]);
-            nClauses += Vec_IntSize(pCut->vIsop[1]);
+            *pClas++ = pLits;
+            *pLits++ = 2 * OutVar; 
+            pLits += Cnf_IsopWriteCube( Cube, pCut->nFanins, pVars, pLits );
         }
+
         // negative polarity of the cut
         if ( pCut->nFanins < 5 )
         {
             uTruth = 0xFFFF & ~*Cnf_CutTruth(pCut);
-            nLiterals += Cnf_SopCountLiterals( p->pSops[uTruth], p->pSopSizes[uTruth] ) + p->pSopSizes[uTruth];
-            assert( p->pSopSizes[uTruth] >= 0 );
-            nClauses += p->pSopSizes[uTruth];
+            Cnf_SopConvertToVector( p->pSops[uTruth], p->pSopSizes[uTruth], vSopTemp );
+            vCover = vSopTemp;
         }
         else
+            vCover = pCut->vIsop[0];
+        Vec_IntForEachEntry( vCover, Cube, k )
         {
-            nLiterals += Cnf_IsopCountLiterals( pCut->vIsop[0], pCut->nFanins ) + Vec_IntSize(pCut->vIsop[0]);
-            nClauses += Vec_IntSize(pCut->vIsop[0]);
+            *pClas++ = pLits;
+            *pLits++ = 2 * OutVar + 1; 
+            pLits += Cnf_IsopWriteCube( Cube, pCut->nFanins, pVars, pLits );
+        }
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes clauses of the mapped nodes using several threads.]
+
+  Description [The mapped nodes are divided into slices with about the
+  same number of literals. Since the number of clauses and literals of 
+  each node is known in advance, each thread writes its slice directly
+  into the place where the sequential procedure would have written it.
+  As a result, the CNF does not depend on the number of threads.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cnf_ManWriteCnfSlice( void * pArg )
+{
+    Cnf_Slice_t * pSlice = (Cnf_Slice_t *)pArg;
+    Vec_Int_t * vSopTemp = Vec_IntAlloc( 1 << 16 );
+    Cnf_ManWriteCnfNodes( pSlice->p, pSlice->pCnf, pSlice->vMapped, pSlice->iStart, pSlice->iStop, pSlice->iClause, pSlice->iLiteral, vSopTemp );
+    Vec_IntFree( vSopTemp );
+    return 1;
+}
+static void Cnf_ManWriteCnfNodesPar( Cnf_Man_t * p, Cnf_Dat_t * pCnf, Vec_Ptr_t * vMapped, int nLiterals, int nProcs )
+{
+    Cnf_Slice_t * pSlices = ABC_CALLOC( Cnf_Slice_t, nProcs );
+    Vec_Ptr_t * vSlices = Vec_PtrAlloc( nProcs );
+    Aig_Obj_t * pObj;
+    int i, nClauses = 0, nLits = 0;
+    for ( i = 0; i < nProcs; i++ )
+    {
+        pSlices[i].p       = p;
+        pSlices[i].pCnf    = pCnf;
+        pSlices[i].vMapped = vMapped;
+    }
+    // find the boundaries of the slices
+    Vec_PtrPush( vSlices, pSlices );
+    Vec_PtrForEachEntry( Aig_Obj_t *, vMapped, pObj, i )
+    {
+        if ( Vec_PtrSize(vSlices) < nProcs && (word)nLits * nProcs >= (word)nLiterals * Vec_PtrSize(vSlices) )
+        {
+            pSlices[Vec_PtrSize(vSlices)-1].iStop = i;
+            pSlices[Vec_PtrSize(vSlices)].iStart   = i;
+            pSlices[Vec_PtrSize(vSlices)].iClause  = nClauses;
+            pSlices[Vec_PtrSize(vSlices)].iLiteral = nLits;
+            Vec_PtrPush( vSlices, pSlices + Vec_PtrSize(vSlices) );
         }
-//printf( "%d ", nClauses-(1 + Aig_ManCoNum( p->pManAig )) );
+        nClauses += Cnf_ManCountNode( p, pObj, &nLits );
     }
-//printf( "\n" );
+    pSlices[Vec_PtrSize(vSlices)-1].iStop = Vec_PtrSize(vMapped);
+    assert( nLits == nLiterals );
+    Util_ProcessThreads( Cnf_ManWriteCnfSlice, vSlices, nProcs + 1, 0, 0 );
+    Vec_PtrFree( vSlices );
+    ABC_FREE( pSlices );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives CNF for the mapping.]
+
+  Description [The last argument shows the number of last outputs
+  of the manager, which will not be converted into clauses but the
+  new variables for which will be introduced.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Cnf_Dat_t * Cnf_ManWriteCnf( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs )
+{
+    int fChangeVariableOrder = 0; // should be set to 0 to improve performance
+    Aig_Obj_t * pObj;
+    Cnf_Dat_t * pCnf;
+    Vec_Int_t * vSopTemp;
+    int OutVar, PoVar, * pLits, ** pClas;
+    int i, nLiterals, nClauses, nLitsNodes = 0, nClasNodes = 0, Number;
+
+    // count the number of literals and clauses
+    Vec_PtrForEachEntry( Aig_Obj_t *, vMapped, pObj, i )
+        nClasNodes += Cnf_ManCountNode( p, pObj, &nLitsNodes );
+    nLiterals = nLitsNodes + 1 + Aig_ManCoNum( p->pManAig ) + 3 * nOutputs;
+    nClauses = nClasNodes + 1 + Aig_ManCoNum( p->pManAig ) + nOutputs;
 
     // allocate CNF
     pCnf = ABC_CALLOC( Cnf_Dat_t, 1 );
@@ -318,54 +469,16 @@ Cnf_Dat_t * Cnf_ManWriteCnf( Cnf_Man_t * p, Vec_Ptr_t * vMapped, int nOutputs )
     }
 
     // assign the clauses
-    vSopTemp = Vec_IntAlloc( 1 << 16 );
-    pLits = pCnf->pClauses[0];
-    pClas = pCnf->pClauses;
-    Vec_PtrForEachEntry( Aig_Obj_t *, vMapped, pObj, i )
+    if ( p->nProcs > 1 && Vec_PtrSize(vMapped) >= 1000 * p->nProcs )
+        Cnf_ManWriteCnfNodesPar( p, pCnf, vMapped, nLitsNodes, p->nProcs );
+    else
     {
-        pCut = Cnf_ObjBestCut( pObj );
-
-        // save variables of this cut
-        OutVar = pCnf->pVarNums[ pObj->Id ];
-        for ( k = 0; k < (int)pCut->nFanins; k++ )
-        {
-            pVars[k] = pCnf->pVarNums[ pCut->pFanins[k] ];
-            assert( pVars[k] <= Aig_ManObjNumMax(p->pManAig) );
-        }
-
-        // positive polarity of the cut
-        if ( pCut->nFanins < 5 )
-        {
-            uTruth = 0xFFFF & *Cnf_CutTruth(pCut);
-            Cnf_SopConvertToVector( p->pSops[uTruth], p->pSopSizes[uTruth], vSopTemp );
-            vCover = vSopTemp;
-        }
-        else
-            vCover = pCut->vIsop[1];
-        Vec_IntForEachEntry( vCover, Cube, k )
-        {
-            *pClas++ = pLits;
-            *pLits++ = 2 * OutVar; 
-            pLits += Cnf_IsopWriteCube( Cube, pCut->nFanins, pVars, pLits );
-        }
-
-        // negative polarity of the cut
-        if ( pCut->nFanins < 5 )
-        {
-            uTruth = 0xFFFF & ~*Cnf_CutTruth(pCut);
-            Cnf_SopConvertToVector( p->pSops[uTruth], p->pSopSizes[uTruth], vSopTemp );
-            vCover = vSopTemp;
-        }
-        else
-            vCover = pCut->vIsop[0];
-        Vec_IntForEachEntry( vCover, Cube, k )
-        {
-            *pClas++ = pLits;
-            *pLits++ = 2 * OutVar + 1; 
-            pLits += Cnf_IsopWriteCube( Cube, pCut->nFanins, pVars, pLits );
-        }
+        vSopTemp = Vec_IntAlloc( 1 << 16 );
+        Cnf_ManWriteCnfNodes( p, pCnf, vMapped, 0, Vec_PtrSize(vMapped), 0, 0, vSopTemp );
+        Vec_IntFree( vSopTemp );
     }
-    Vec_IntFree( vSopTemp );
+    pLits = pCnf->pClauses[0] + nLitsNodes;
+    pClas = pCnf->pClauses + nClasNodes;
  
     // write the constant literal
     OutVar = pCnf->pVarNums[ Aig_ManConst1(p->pManAig)->Id ];
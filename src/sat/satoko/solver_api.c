@@ -659,6 +659,10 @@ void satoko_set_runid(satoko_t *s, int id)
 
 int satoko_read_cex_varvalue(satoko_t *s, int ivar)
 {
+    /* The variables assigned at the top level keep their value, while their
+     * saved polarity may be overwritten by an assumption */
+    if (var_value(s, ivar) != SATOKO_VAR_UNASSING)
+        return var_value(s, ivar) == SATOKO_LIT_TRUE;
     return satoko_var_polarity(s, ivar) == SATOKO_LIT_TRUE;
 }
 
@@ -51,4 +51,72 @@ TEST(GiaTest, CanAddAnAndGate) {
   Gia_ManStop(aig_manager);
 }
 
+TEST(GiaTest, CanRestoreCheckpoint) {
+  Gia_Man_t* aig_manager =  Gia_ManStart(100);
+  int input1 = Gia_ManAppendCi(aig_manager);
+  int input2 = Gia_ManAppendCi(aig_manager);
+  int and_output = Gia_ManAppendAnd(aig_manager, input1, Abc_LitNot(input2));
+  Gia_ManAppendCo(aig_manager, and_output);
+  aig_manager->pName = Abc_UtilStrsav((char *)"ckpt");
+  aig_manager->vFlopClasses = Vec_IntStartNatural(3);
+
+  char file_name[] = "gia_test_ckpt.ckpt";
+  ASSERT_TRUE(Gia_ManCkptWrite(aig_manager, file_name, 1));
+  Gia_Man_t* restored = Gia_ManCkptRead(file_name);
+  remove(file_name);
+
+  ASSERT_TRUE(restored != nullptr);
+  EXPECT_STREQ(restored->pName, "ckpt");
+  EXPECT_EQ(Gia_ManObjNum(restored), Gia_ManObjNum(aig_manager));
+  EXPECT_EQ(Gia_ManCiNum(restored), 2);
+  EXPECT_EQ(Gia_ManCoNum(restored), 1);
+  EXPECT_EQ(Gia_ObjFaninLit0p(restored, Gia_ManCo(restored, 0)), and_output);
+  EXPECT_TRUE(Vec_IntEqual(restored->vFlopClasses, aig_manager->vFlopClasses));
+  Gia_ManStop(restored);
+  Gia_ManStop(aig_manager);
+}
+
+TEST(GiaTest, CanLiftManyCandidates) {
+  // out = !a & (b_1 & ... & b_n) is 0 under a = 1, whatever the values of b_i
+  const int num_cands = 300;
+  Gia_Man_t* aig_manager = Gia_ManStart(2 * num_cands + 10);
+  Vec_Int_t* cis = Vec_IntAlloc(num_cands + 1);
+  Vec_Int_t* nodes = Vec_IntAlloc(num_cands);
+  Vec_Int_t* cos = Vec_IntAlloc(1);
+  Vec_Int_t* ci_vals = Vec_IntAlloc(num_cands + 1);
+  Vec_Int_t* cands = Vec_IntAlloc(num_cands);
+  Vec_Int_t* lifted = Vec_IntAlloc(num_cands);
+  int input_a = Gia_ManAppendCi(aig_manager);
+  Vec_IntPush(cis, Abc_Lit2Var(input_a));
+  Vec_IntPush(ci_vals, 1);
+  int conj = 1;
+  for (int i = 0; i < num_cands; i++) {
+    int input_b = Gia_ManAppendCi(aig_manager);
+    Vec_IntPush(cis, Abc_Lit2Var(input_b));
+    Vec_IntPush(ci_vals, i & 1);
+    Vec_IntPush(cands, Abc_Lit2Var(input_b));
+    conj = (conj == 1) ? input_b : Gia_ManAppendAnd(aig_manager, conj, input_b);
+    if (i > 0)
+      Vec_IntPush(nodes, Abc_Lit2Var(conj));
+  }
+  int output = Gia_ManAppendAnd(aig_manager, Abc_LitNot(input_a), conj);
+  Vec_IntPush(nodes, Abc_Lit2Var(output));
+  Vec_IntPush(cos, Abc_Lit2Var(Gia_ManAppendCo(aig_manager, output)));
+
+  // the candidates do not fit into one batch of 64 * 4 patterns
+  Gia_XsimMan_t* xsim = Gia_XsimManStart(aig_manager, 4);
+  Gia_XsimManSetCone(xsim, cis, nodes, cos);
+  EXPECT_EQ(Gia_XsimManLift(xsim, ci_vals, cands, lifted), num_cands);
+  EXPECT_TRUE(Vec_IntEqual(lifted, cands));
+
+  Gia_XsimManStop(xsim);
+  Vec_IntFree(cis);
+  Vec_IntFree(nodes);
+  Vec_IntFree(cos);
+  Vec_IntFree(ci_vals);
+  Vec_IntFree(cands);
+  Vec_IntFree(lifted);
+  Gia_ManStop(aig_manager);
+}
+
 ABC_NAMESPACE_IMPL_END